@@ -80,8 +80,7 @@ EmberMotifLog::~EmberMotifLog() {
 	logRecord->decrement();
 
 	if(0 == logRecord->getCount()) {
-		fclose(logRecord->getFile());
-		logRecord->invalidateFile();
+		logRecord->closeFile();
 	}
 }
 
@@ -96,16 +95,6 @@ void EmberMotifLog::logMotifEnd(const std::string& name, const int motifNum) {
         return;
     }
 
-	if(NULL != logRecord->getFile()) {
-		FILE* logFile = logRecord->getFile();
-
-		const char* nameChar = name.c_str();
-        std::string endTime = getElapsedSimTime().toStringBestSI();
-        const char* startTimeChar = start_time.c_str();
-
-        // File format:  job rank motifnum motif_name start_time end_time
-		fprintf(logFile, "%d %d %d %s %s %s\n", jobID, rank, motifNum, nameChar, startTimeChar, endTime.c_str());
-		fflush(logFile);
-
-	}
+    std::string endTime = getElapsedSimTime().toStringBestSI();
+	logRecord->writeLine(jobID, rank, motifNum, name.c_str(), start_time.c_str(), endTime.c_str());
 }
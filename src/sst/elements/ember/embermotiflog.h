@@ -19,12 +19,16 @@
 #include <stdio.h>
 #include <sst/core/componentExtension.h>
 
+#ifndef _SST_EMBER_DISABLE_PARALLEL
+#include <mutex>
+#endif
+
 namespace SST {
 namespace Ember {
 
 class EmberMotifLogRecord {
 	public:
-		EmberMotifLogRecord(const char* filePath) {
+		EmberMotifLogRecord(const char* filePath) : motifCount(0) {
 			loggerFile = fopen(filePath, "wt");
 		}
 
@@ -54,17 +58,36 @@ class EmberMotifLogRecord {
 			return motifCount;
 		}
 
-		FILE* getFile() {
-			return loggerFile;
+		// Engines on different threads share a record, so writes and
+		// the final close are serialized on the record
+		void writeLine(int jobID, int rank, int motifNum, const char* name,
+			const char* startTime, const char* endTime) {
+#ifndef _SST_EMBER_DISABLE_PARALLEL
+			std::lock_guard<std::mutex> lock(fileLock);
+#endif
+			if(NULL != loggerFile) {
+				// File format:  job rank motifnum motif_name start_time end_time
+				fprintf(loggerFile, "%d %d %d %s %s %s\n", jobID, rank, motifNum, name, startTime, endTime);
+				fflush(loggerFile);
+			}
 		}
 
-		void invalidateFile() {
-			loggerFile = NULL;
+		void closeFile() {
+#ifndef _SST_EMBER_DISABLE_PARALLEL
+			std::lock_guard<std::mutex> lock(fileLock);
+#endif
+			if(NULL != loggerFile) {
+				fclose(loggerFile);
+				loggerFile = NULL;
+			}
 		}
 
 	protected:
 		FILE* loggerFile;
 		uint32_t motifCount;
+#ifndef _SST_EMBER_DISABLE_PARALLEL
+		std::mutex fileLock;
+#endif
 };
 
 class EmberMotifLog : public ComponentExtension {
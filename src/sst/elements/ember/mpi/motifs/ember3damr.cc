@@ -25,8 +25,6 @@
 using namespace SST::Ember;
 using namespace SST::Hermes::MP;
 
-static std::map<uint32_t, int32_t>  blockToNodeMap;
-
 Ember3DAMRGenerator::Ember3DAMRGenerator(SST::ComponentId_t id, Params& params) :
 	EmberMessagePassingGenerator(id, params, "3DAMR")
 {
@@ -53,6 +51,8 @@ Ember3DAMRGenerator::Ember3DAMRGenerator(SST::ComponentId_t id, Params& params)
 
         if("binary" == params.find<std::string>("arg.filetype") ) {
         	meshType = 2;
+        } else if("indexed" == params.find<std::string>("arg.filetype") ) {
+        	meshType = 3;
         } else {
         	meshType = 1;
     	}
@@ -82,22 +82,22 @@ void Ember3DAMRGenerator::loadBlocks() {
 
     EmberAMRBinaryFile* amrFile = NULL;
 
-    if(2 == meshType) {
+    // The block to rank map is built once per mesh file and shared by every rank in the process
+    if(3 == meshType) {
+	meshIndex = Ember3DAMRMeshIndex::get(blockFilePath, true, out);
+    } else if(2 == meshType) {
+	meshIndex = Ember3DAMRMeshIndex::get(blockFilePath, false, out);
         amrFile = new EmberAMRBinaryFile(blockFilePath, out);
-
-	if(blockToNodeMap.empty()) {
-		amrFile->populateGlobalBlocks(&blockToNodeMap);
-	}
     } else {
 //        amrFile = new EmberAMRTextFile(blockFilePath, out);
-	out->fatal(CALL_INFO, -1, "Binary mesh files are the only type currently supported, use sst-meshconvert\n");
+	out->fatal(CALL_INFO, -1, "Binary and indexed mesh files are the only types currently supported, use sst-meshconvert and sst-meshindex\n");
     }
 
-	maxLevel   = amrFile->getMaxRefinement();
-	blockCount = amrFile->getBlockCount();
-	blocksX    = amrFile->getBlocksX();
-	blocksY    = amrFile->getBlocksY();
-	blocksZ    = amrFile->getBlocksZ();
+	maxLevel   = meshIndex->getMaxRefinement();
+	blockCount = meshIndex->getBlockCount();
+	blocksX    = meshIndex->getBlocksX();
+	blocksY    = meshIndex->getBlocksY();
+	blocksZ    = meshIndex->getBlocksZ();
 
 	out->verbose(CALL_INFO, 2, 0, "Loaded AMR block information: %" PRIu32 " blocks, %" PRIu32 " max refinement, blocks (X=%" PRIu32 ",Y=%" PRIu32 ",Z=%" PRIu32 ")\n",
 		blockCount, maxLevel, blocksX, blocksY, blocksZ);
@@ -159,10 +159,14 @@ void Ember3DAMRGenerator::loadBlocks() {
 		out->verbose(CALL_INFO, 4, 0, "Rank %" PRIu32 " loaded %d for rank %" PRIu32 "\n",
 			rank(), otherRankBlocks, currentRank);
 	}*/
-	amrFile->populateLocalBlocks(&localBlocks , rank());
+	if(NULL != amrFile) {
+		amrFile->populateLocalBlocks(&localBlocks , rank());
+	} else {
+		meshIndex->populateLocalBlocks(&localBlocks, rank(), out);
+	}
 
 	out->verbose(CALL_INFO, 2, 0, "Rank %" PRIu32 ", loaded %" PRIu32 " blocks locally and %" PRIu32 " remotely, stopped at line: %" PRIu32 ".\n", (uint32_t) rank(),
-		(uint32_t) localBlocks.size(), (uint32_t) blockToNodeMap.size(), line);
+		(uint32_t) localBlocks.size(), meshIndex->getBlockCount(), line);
 
 	out->verbose(CALL_INFO, 4, 0, "Performing AMR block wire up...\n");
 	uint32_t maxRequests = 0;
@@ -204,15 +208,15 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t commToBlock = calcBlockID((blockXPos / 2) + 1,
 				blockYPos / 2, blockZPos / 2, blockXUp);
 
-			std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+			const int32_t blockNode = meshIndex->getBlockNode(commToBlock);
 
-			if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
+			if(blockNode < 0 && isBlockLocal(commToBlock)) {
 				if( ! isBlockLocal(commToBlock) ) {
 					out->fatal(CALL_INFO, -1, "Could not locate block %" PRIu32 ", during wire up phase.\n", commToBlock);
 				}
 			} else {
 				// Projecting to coarse level
-				currentBlock->setCommXUp(blockNode->second, -1, -1, -1);
+				currentBlock->setCommXUp(blockNode, -1, -1, -1);
 				maxRequests++;
 			}
 		} else if(blockLevel < blockXUp) {
@@ -222,17 +226,17 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t x3 = calcBlockID(blockXPos * 2 + 2, blockYPos * 2,     blockZPos * 2 + 1, blockXUp);
 			const uint32_t x4 = calcBlockID(blockXPos * 2 + 2, blockYPos * 2 + 1, blockZPos * 2 + 1, blockXUp);
 
-			std::map<uint32_t, int32_t>::iterator blockNodeX1 = blockToNodeMap.find(x1);
-			std::map<uint32_t, int32_t>::iterator blockNodeX2 = blockToNodeMap.find(x2);
-			std::map<uint32_t, int32_t>::iterator blockNodeX3 = blockToNodeMap.find(x3);
-			std::map<uint32_t, int32_t>::iterator blockNodeX4 = blockToNodeMap.find(x4);
+			const int32_t blockNodeX1 = meshIndex->getBlockNode(x1);
+			const int32_t blockNodeX2 = meshIndex->getBlockNode(x2);
+			const int32_t blockNodeX3 = meshIndex->getBlockNode(x3);
+			const int32_t blockNodeX4 = meshIndex->getBlockNode(x4);
 
-			int32_t rankX1 = blockNodeX1->second;
-			int32_t rankX2 = blockNodeX2->second;
-			int32_t rankX3 = blockNodeX3->second;
-			int32_t rankX4 = blockNodeX4->second;
+			int32_t rankX1 = blockNodeX1;
+			int32_t rankX2 = blockNodeX2;
+			int32_t rankX3 = blockNodeX3;
+			int32_t rankX4 = blockNodeX4;
 
-			if( blockNodeX1 == blockToNodeMap.end() ) {
+			if( blockNodeX1 < 0 ) {
 				if( isBlockLocal(x1) ) {
 					rankX1 = -1;
 				} else {
@@ -240,7 +244,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeX2 == blockToNodeMap.end() ) {
+			if( blockNodeX2 < 0 ) {
 				if( isBlockLocal(x2) ) {
 					rankX2 = -1;
 				} else {
@@ -248,7 +252,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeX3 == blockToNodeMap.end() ) {
+			if( blockNodeX3 < 0 ) {
 				if( isBlockLocal(x3) ) {
 					rankX3 = -1;
 				} else {
@@ -256,7 +260,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeX4 == blockToNodeMap.end() ) {
+			if( blockNodeX4 < 0 ) {
 				if( isBlockLocal(x4) ) {
 					rankX4 = -1;
 				} else {
@@ -275,15 +279,15 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t blockNextToMe = calcBlockID(blockXPos + 1,
 				blockYPos, blockZPos, blockXUp);
 
-			std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+			const int32_t blockNextToMeNode = meshIndex->getBlockNode(blockNextToMe);
 
-			if(blockNextToMeNode == blockToNodeMap.end()) {
+			if(blockNextToMeNode < 0) {
 				if( ! isBlockLocal(blockNextToMe) ) {
 					out->fatal(CALL_INFO, -1, "X+ wireup for block failed to locate wire up on same refinement level (block=%" PRIu32 "\n",
 						blockNextToMe);
 				}
 			} else {
-				currentBlock->setCommXUp(blockNextToMeNode->second, -1, -1, -1);
+				currentBlock->setCommXUp(blockNextToMeNode, -1, -1, -1);
 				maxRequests++;
 			}
 		}
@@ -309,15 +313,15 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t commToBlock = calcBlockID((blockXPos / 2) - 1,
 				blockYPos / 2, blockZPos / 2, blockXDown);
 
-			std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+			const int32_t blockNode = meshIndex->getBlockNode(commToBlock);
 
-			if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
+			if(blockNode < 0 && isBlockLocal(commToBlock)) {
 				if( ! isBlockLocal(commToBlock) ) {
 					out->fatal(CALL_INFO, -1, "X- wireup for block failed to locate wire up partner (block: %" PRIu32 ")\n", commToBlock);
 				}
 			} else {
 				// Projecting to coarse level
-				currentBlock->setCommXDown(blockNode->second, -1, -1, -1);
+				currentBlock->setCommXDown(blockNode, -1, -1, -1);
 				maxRequests++;
 			}
 		} else if(blockLevel < blockXDown) {
@@ -333,17 +337,17 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t x3 = calcBlockID(blockXPos * 2 - 1, blockYPos * 2,     blockZPos * 2 + 1, blockXDown);
 			const uint32_t x4 = calcBlockID(blockXPos * 2 - 1, blockYPos * 2 + 1, blockZPos * 2 + 1, blockXDown);
 
-			std::map<uint32_t, int32_t>::iterator blockNodeX1 = blockToNodeMap.find(x1);
-			std::map<uint32_t, int32_t>::iterator blockNodeX2 = blockToNodeMap.find(x2);
-			std::map<uint32_t, int32_t>::iterator blockNodeX3 = blockToNodeMap.find(x3);
-			std::map<uint32_t, int32_t>::iterator blockNodeX4 = blockToNodeMap.find(x4);
+			const int32_t blockNodeX1 = meshIndex->getBlockNode(x1);
+			const int32_t blockNodeX2 = meshIndex->getBlockNode(x2);
+			const int32_t blockNodeX3 = meshIndex->getBlockNode(x3);
+			const int32_t blockNodeX4 = meshIndex->getBlockNode(x4);
 
-			int32_t rankX1 = blockNodeX1->second;
-			int32_t rankX2 = blockNodeX2->second;
-			int32_t rankX3 = blockNodeX3->second;
-			int32_t rankX4 = blockNodeX4->second;
+			int32_t rankX1 = blockNodeX1;
+			int32_t rankX2 = blockNodeX2;
+			int32_t rankX3 = blockNodeX3;
+			int32_t rankX4 = blockNodeX4;
 
-			if( blockNodeX1 == blockToNodeMap.end() ) {
+			if( blockNodeX1 < 0 ) {
 				if( isBlockLocal(x1) ) {
 					rankX1 = -1;
 				} else {
@@ -351,7 +355,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeX2 == blockToNodeMap.end() ) {
+			if( blockNodeX2 < 0 ) {
 				if( isBlockLocal(x2) ) {
 					rankX2 = -1;
 				} else {
@@ -359,7 +363,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeX3 == blockToNodeMap.end() ) {
+			if( blockNodeX3 < 0 ) {
 				if( isBlockLocal(x3) ) {
 					rankX3 = -1;
 				} else {
@@ -367,7 +371,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeX4 == blockToNodeMap.end() ) {
+			if( blockNodeX4 < 0 ) {
 				if( isBlockLocal(x4) ) {
 					rankX4 = -1;
 				} else {
@@ -386,14 +390,14 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t blockNextToMe = calcBlockID(blockXPos - 1,
 				blockYPos, blockZPos, blockXDown);
 
-			std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+			const int32_t blockNextToMeNode = meshIndex->getBlockNode(blockNextToMe);
 
-			if(blockNextToMeNode == blockToNodeMap.end()) {
+			if(blockNextToMeNode < 0) {
 				if( ! isBlockLocal(blockNextToMe) ) {
 					out->fatal(CALL_INFO, -1, "X- wireup for block failed to locate wire up block on same refinment level (block: %" PRIu32 ")\n", blockNextToMe);
 				}
 			} else {
-				currentBlock->setCommXDown(blockNextToMeNode->second, -1, -1, -1);
+				currentBlock->setCommXDown(blockNextToMeNode, -1, -1, -1);
 				maxRequests++;
 			}
 		}
@@ -410,16 +414,16 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2) + 1, blockZPos / 2, blockYUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            const int32_t blockNode = meshIndex->getBlockNode(commToBlock);
 
-            if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
+            if(blockNode < 0 && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
                     printf("Y+ Did not locate block: %" PRIu32 "\n", commToBlock);
                     exit(-1);
                 }
             } else {
                 // Projecting to coarse level
-                currentBlock->setCommYUp(blockNode->second, -1, -1, -1);
+                currentBlock->setCommYUp(blockNode, -1, -1, -1);
 		maxRequests++;
             }
         } else if(blockLevel < blockYUp) {
@@ -429,17 +433,17 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t y3 = calcBlockID(blockXPos * 2,     blockYPos * 2 + 2, blockZPos * 2 + 1, blockYUp);
             const uint32_t y4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 + 2, blockZPos * 2 + 1, blockYUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeY1 = blockToNodeMap.find(y1);
-            std::map<uint32_t, int32_t>::iterator blockNodeY2 = blockToNodeMap.find(y2);
-            std::map<uint32_t, int32_t>::iterator blockNodeY3 = blockToNodeMap.find(y3);
-            std::map<uint32_t, int32_t>::iterator blockNodeY4 = blockToNodeMap.find(y4);
+            const int32_t blockNodeY1 = meshIndex->getBlockNode(y1);
+            const int32_t blockNodeY2 = meshIndex->getBlockNode(y2);
+            const int32_t blockNodeY3 = meshIndex->getBlockNode(y3);
+            const int32_t blockNodeY4 = meshIndex->getBlockNode(y4);
 
-			int32_t rankY1 = blockNodeY1->second;
-			int32_t rankY2 = blockNodeY2->second;
-			int32_t rankY3 = blockNodeY3->second;
-			int32_t rankY4 = blockNodeY4->second;
+			int32_t rankY1 = blockNodeY1;
+			int32_t rankY2 = blockNodeY2;
+			int32_t rankY3 = blockNodeY3;
+			int32_t rankY4 = blockNodeY4;
 
-			if( blockNodeY1 == blockToNodeMap.end() ) {
+			if( blockNodeY1 < 0 ) {
 				if( isBlockLocal(y1) ) {
 					rankY1 = -1;
 				} else {
@@ -447,7 +451,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeY2 == blockToNodeMap.end() ) {
+			if( blockNodeY2 < 0 ) {
 				if( isBlockLocal(y2) ) {
 					rankY2 = -1;
 				} else {
@@ -455,7 +459,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeY3 == blockToNodeMap.end() ) {
+			if( blockNodeY3 < 0 ) {
 				if( isBlockLocal(y3) ) {
 					rankY3 = -1;
 				} else {
@@ -463,7 +467,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeY4 == blockToNodeMap.end() ) {
+			if( blockNodeY4 < 0 ) {
 				if( isBlockLocal(y4) ) {
 					rankY4 = -1;
 				} else {
@@ -481,15 +485,15 @@ void Ember3DAMRGenerator::loadBlocks() {
             // Same level
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos + 1, blockZPos, blockYUp);
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            const int32_t blockNextToMeNode = meshIndex->getBlockNode(blockNextToMe);
 
-            if(blockNextToMeNode == blockToNodeMap.end()) {
+            if(blockNextToMeNode < 0) {
                 if( ! isBlockLocal(blockNextToMe) ) {
 		    out->output("Dumping block map for rank: %" PRIu32 "\n", rank());
 		    out->fatal(CALL_INFO, -1, "Y+ wireup for block failed to locate wire up partner (block: %" PRIu32 ")\n", blockNextToMe);
                 }
             } else {
-                currentBlock->setCommYUp(blockNextToMeNode->second, -1, -1, -1);
+                currentBlock->setCommYUp(blockNextToMeNode, -1, -1, -1);
 		maxRequests++;
             }
         }
@@ -507,16 +511,16 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2) - 1, blockZPos / 2, blockYDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            const int32_t blockNode = meshIndex->getBlockNode(commToBlock);
 
-            if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
+            if(blockNode < 0 && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
                     printf("Y- Did not locate block: %" PRIu32 "\n", commToBlock);
                     exit(-1);
                 }
             } else {
                 // Projecting to coarse level
-                currentBlock->setCommYDown(blockNode->second, -1, -1, -1);
+                currentBlock->setCommYDown(blockNode, -1, -1, -1);
 		maxRequests++;
             }
         } else if(blockLevel < blockYDown) {
@@ -526,17 +530,17 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t y3 = calcBlockID(blockXPos * 2,     blockYPos * 2 - 1, blockZPos * 2 + 1, blockYDown);
             const uint32_t y4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 - 1, blockZPos * 2 + 1, blockYDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeY1 = blockToNodeMap.find(y1);
-            std::map<uint32_t, int32_t>::iterator blockNodeY2 = blockToNodeMap.find(y2);
-            std::map<uint32_t, int32_t>::iterator blockNodeY3 = blockToNodeMap.find(y3);
-            std::map<uint32_t, int32_t>::iterator blockNodeY4 = blockToNodeMap.find(y4);
+            const int32_t blockNodeY1 = meshIndex->getBlockNode(y1);
+            const int32_t blockNodeY2 = meshIndex->getBlockNode(y2);
+            const int32_t blockNodeY3 = meshIndex->getBlockNode(y3);
+            const int32_t blockNodeY4 = meshIndex->getBlockNode(y4);
 
-			int32_t rankY1 = blockNodeY1->second;
-			int32_t rankY2 = blockNodeY2->second;
-			int32_t rankY3 = blockNodeY3->second;
-			int32_t rankY4 = blockNodeY4->second;
+			int32_t rankY1 = blockNodeY1;
+			int32_t rankY2 = blockNodeY2;
+			int32_t rankY3 = blockNodeY3;
+			int32_t rankY4 = blockNodeY4;
 
-			if( blockNodeY1 == blockToNodeMap.end() ) {
+			if( blockNodeY1 < 0 ) {
 				if( isBlockLocal(y1) ) {
 					rankY1 = -1;
 				} else {
@@ -544,7 +548,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeY2 == blockToNodeMap.end() ) {
+			if( blockNodeY2 < 0 ) {
 				if( isBlockLocal(y2) ) {
 					rankY2 = -1;
 				} else {
@@ -552,7 +556,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeY3 == blockToNodeMap.end() ) {
+			if( blockNodeY3 < 0 ) {
 				if( isBlockLocal(y3) ) {
 					rankY3 = -1;
 				} else {
@@ -560,7 +564,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeY4 == blockToNodeMap.end() ) {
+			if( blockNodeY4 < 0 ) {
 				if( isBlockLocal(y4) ) {
 					rankY4 = -1;
 				} else {
@@ -578,14 +582,14 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos - 1, blockZPos, blockYDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            const int32_t blockNextToMeNode = meshIndex->getBlockNode(blockNextToMe);
 
-            if(blockNextToMeNode == blockToNodeMap.end()) {
+            if(blockNextToMeNode < 0) {
                 if( ! isBlockLocal(blockNextToMe) ) {
                 	out->fatal(CALL_INFO, -1, "Y- wireup for block failed to locate wire up partner (block: %" PRIu32 ")\n", blockNextToMe);
                 }
             } else {
-                currentBlock->setCommYDown(blockNextToMeNode->second, -1, -1, -1);
+                currentBlock->setCommYDown(blockNextToMeNode, -1, -1, -1);
 		maxRequests++;
             }
         }
@@ -603,16 +607,16 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2), (blockZPos / 2) + 1, blockZUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            const int32_t blockNode = meshIndex->getBlockNode(commToBlock);
 
-            if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
+            if(blockNode < 0 && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
                     printf("Y+ Did not locate block: %" PRIu32 "\n", commToBlock);
                     exit(-1);
                 }
             } else {
                 // Projecting to coarse level
-                currentBlock->setCommZUp(blockNode->second, -1, -1, -1);
+                currentBlock->setCommZUp(blockNode, -1, -1, -1);
 		maxRequests++;
             }
         } else if(blockLevel < blockZUp) {
@@ -622,17 +626,17 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t z3 = calcBlockID(blockXPos * 2,     blockYPos * 2 + 1, blockZPos * 2 + 2, blockZUp);
             const uint32_t z4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 + 1, blockZPos * 2 + 2, blockZUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeZ1 = blockToNodeMap.find(z1);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ2 = blockToNodeMap.find(z2);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ3 = blockToNodeMap.find(z3);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ4 = blockToNodeMap.find(z4);
+            const int32_t blockNodeZ1 = meshIndex->getBlockNode(z1);
+            const int32_t blockNodeZ2 = meshIndex->getBlockNode(z2);
+            const int32_t blockNodeZ3 = meshIndex->getBlockNode(z3);
+            const int32_t blockNodeZ4 = meshIndex->getBlockNode(z4);
 
-			int32_t rankZ1 = blockNodeZ1->second;
-			int32_t rankZ2 = blockNodeZ2->second;
-			int32_t rankZ3 = blockNodeZ3->second;
-			int32_t rankZ4 = blockNodeZ4->second;
+			int32_t rankZ1 = blockNodeZ1;
+			int32_t rankZ2 = blockNodeZ2;
+			int32_t rankZ3 = blockNodeZ3;
+			int32_t rankZ4 = blockNodeZ4;
 
-			if( blockNodeZ1 == blockToNodeMap.end() ) {
+			if( blockNodeZ1 < 0 ) {
 				if( isBlockLocal(z1) ) {
 					rankZ1 = -1;
 				} else {
@@ -640,7 +644,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeZ2 == blockToNodeMap.end() ) {
+			if( blockNodeZ2 < 0 ) {
 				if( isBlockLocal(z2) ) {
 					rankZ2 = -1;
 				} else {
@@ -648,7 +652,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeZ3 == blockToNodeMap.end() ) {
+			if( blockNodeZ3 < 0 ) {
 				if( isBlockLocal(z3) ) {
 					rankZ3 = -1;
 				} else {
@@ -656,7 +660,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeZ4 == blockToNodeMap.end() ) {
+			if( blockNodeZ4 < 0 ) {
 				if( isBlockLocal(z4) ) {
 					rankZ4 = -1;
 				} else {
@@ -673,14 +677,14 @@ void Ember3DAMRGenerator::loadBlocks() {
             // Same level
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos, blockZPos + 1, blockZUp);
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            const int32_t blockNextToMeNode = meshIndex->getBlockNode(blockNextToMe);
 
-            if(blockNextToMeNode == blockToNodeMap.end()) {
+            if(blockNextToMeNode < 0) {
                 if( ! isBlockLocal(blockNextToMe) ) {
                     out->fatal(CALL_INFO, -1, "Z+ wireup for block failed to locate wire up partner (block: %" PRIu32 ")\n", blockNextToMe);
                 }
             } else {
-                currentBlock->setCommZUp(blockNextToMeNode->second, -1, -1, -1);
+                currentBlock->setCommZUp(blockNextToMeNode, -1, -1, -1);
 		maxRequests++;
             }
         }
@@ -697,15 +701,15 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2), (blockZPos / 2) - 1, blockZDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            const int32_t blockNode = meshIndex->getBlockNode(commToBlock);
 
-            if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
+            if(blockNode < 0 && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
 	                out->fatal(CALL_INFO, -1, "Z- wireup for block failed to locate wire up partner (block: %" PRIu32 ")\n", commToBlock);
                 }
             } else {
                 // Projecting to coarse level
-                currentBlock->setCommZDown(blockNode->second, -1, -1, -1);
+                currentBlock->setCommZDown(blockNode, -1, -1, -1);
 		maxRequests++;
             }
         } else if(blockLevel < blockZDown) {
@@ -715,17 +719,17 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t z3 = calcBlockID(blockXPos * 2,     blockYPos * 2 + 1, blockZPos * 2 - 1, blockZDown);
             const uint32_t z4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 + 1, blockZPos * 2 - 1, blockZDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeZ1 = blockToNodeMap.find(z1);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ2 = blockToNodeMap.find(z2);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ3 = blockToNodeMap.find(z3);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ4 = blockToNodeMap.find(z4);
+            const int32_t blockNodeZ1 = meshIndex->getBlockNode(z1);
+            const int32_t blockNodeZ2 = meshIndex->getBlockNode(z2);
+            const int32_t blockNodeZ3 = meshIndex->getBlockNode(z3);
+            const int32_t blockNodeZ4 = meshIndex->getBlockNode(z4);
 
-			int32_t rankZ1 = blockNodeZ1->second;
-			int32_t rankZ2 = blockNodeZ2->second;
-			int32_t rankZ3 = blockNodeZ3->second;
-			int32_t rankZ4 = blockNodeZ4->second;
+			int32_t rankZ1 = blockNodeZ1;
+			int32_t rankZ2 = blockNodeZ2;
+			int32_t rankZ3 = blockNodeZ3;
+			int32_t rankZ4 = blockNodeZ4;
 
-			if( blockNodeZ1 == blockToNodeMap.end() ) {
+			if( blockNodeZ1 < 0 ) {
 				if( isBlockLocal(z1) ) {
 					rankZ1 = -1;
 				} else {
@@ -733,7 +737,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeZ2 == blockToNodeMap.end() ) {
+			if( blockNodeZ2 < 0 ) {
 				if( isBlockLocal(z2) ) {
 					rankZ2 = -1;
 				} else {
@@ -741,7 +745,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeZ3 == blockToNodeMap.end() ) {
+			if( blockNodeZ3 < 0 ) {
 				if( isBlockLocal(z3) ) {
 					rankZ3 = -1;
 				} else {
@@ -749,7 +753,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 				}
 			}
 
-			if( blockNodeZ4 == blockToNodeMap.end() ) {
+			if( blockNodeZ4 < 0 ) {
 				if( isBlockLocal(z4) ) {
 					rankZ4 = -1;
 				} else {
@@ -766,14 +770,14 @@ void Ember3DAMRGenerator::loadBlocks() {
             // Same level
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos, blockZPos - 1, blockZDown);
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            const int32_t blockNextToMeNode = meshIndex->getBlockNode(blockNextToMe);
 
-            if(blockNextToMeNode == blockToNodeMap.end()) {
+            if(blockNextToMeNode < 0) {
                 if( ! isBlockLocal(blockNextToMe) ) {
                     out->fatal(CALL_INFO, -1, "Z- wireup for block failed to locate wire up partner (block: %" PRIu32 ")\n", blockNextToMe);
                 }
             } else {
-                currentBlock->setCommZDown(blockNextToMeNode->second, -1, -1, -1);
+                currentBlock->setCommZDown(blockNextToMeNode, -1, -1, -1);
 		maxRequests++;
             }
         }
@@ -817,9 +821,6 @@ void Ember3DAMRGenerator::configure()
 	// Clear the path string
 	free(blockFilePath);
 
-	// Clear system wide block wire up map
-	//blockToNodeMap.clear();
-
 	out->verbose(CALL_INFO, 2, 0, "Motif configuration is complete.\n");
 }
 
@@ -1095,16 +1096,18 @@ bool Ember3DAMRGenerator::isBlockLocal(const uint32_t bID) const {
 }
 
 void Ember3DAMRGenerator::printBlockMap() {
-	std::map<uint32_t, int32_t>::iterator block_itr;
-
 	char* map_output = (char*) malloc(sizeof(char) * PATH_MAX);
 	snprintf(map_output, sizeof(char)*PATH_MAX, "blocks-%" PRIu32 ".map", rank());
 
 	FILE* map_output_file = fopen(map_output, "wt");
 
-	for(block_itr = blockToNodeMap.begin(); block_itr != blockToNodeMap.end(); block_itr++) {
-		fprintf(map_output_file, "Block %" PRIu32 " maps to node: %" PRId32 "\n",
-			block_itr->first, block_itr->second);
+	for(uint32_t blockID = 0; blockID < meshIndex->getBlockIDLimit(); blockID++) {
+		const int32_t blockNode = meshIndex->getBlockNode(blockID);
+
+		if(blockNode >= 0) {
+			fprintf(map_output_file, "Block %" PRIu32 " maps to node: %" PRId32 "\n",
+				blockID, blockNode);
+		}
 	}
 
 	fclose(map_output_file);
@@ -23,6 +23,7 @@
 
 #include "mpi/embermpigen.h"
 #include "ember3damrblock.h"
+#include "ember3damrmeshindex.h"
 
 using namespace SST;
 
@@ -48,7 +49,7 @@ public:
         {   "arg.nz",               "Sets the size of a block in Z", "8" },
         {   "arg.fieldspercell",    "Sets the number of fields per mesh cell", "8" },
         {   "arg.blockfile",        "File containing the 3D AMR blocks (from MiniAMR)",     "blocks.amr"},
-        {   "arg.filetype",         "Mesh file type, set to \'binary\' or \'text\'", "text" },
+        {   "arg.filetype",         "Mesh file type, set to \'binary\' (sst-meshconvert), \'indexed\' (sst-meshindex) or \'text\'", "text" },
         {   "arg.printmap",         "Prints a map of blocks to ranks (=\"no\" or \"yes\")", "no" },
         {   "arg.iterations",       "Sets the number of ping pong operations to perform",   "1"},
     )
@@ -105,7 +106,7 @@ private:
 
 	void* blockMessageBuffer;
 
-//        static std::map<uint32_t, int32_t>  blockToNodeMap;
+        std::shared_ptr<const Ember3DAMRMeshIndex> meshIndex;
         char* blockFilePath;
 
 	Output* out;
@@ -20,6 +20,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <vector>
 #include "ember3damrfile.h"
 #include "ember3damrblock.h"
 
@@ -85,7 +86,8 @@ namespace SST {
         	fclose(amrFile);
             }
 
-	    void populateGlobalBlocks(std::map<uint32_t, int32_t>* globalBlockMap) {
+	    // Fills a flat table indexed by block ID with the owning rank, -1 for IDs not in the mesh
+	    void populateGlobalBlocks(std::vector<int32_t>* globalBlockMap) {
 		fseek(amrFile, rankIndexOffset + (rankCount * sizeof(uint64_t)), SEEK_SET);
 
 		for(uint32_t i = 0; i < rankCount; ++i) {
@@ -105,13 +107,13 @@ namespace SST {
 				readNextMeshLine(&blockID, &refineLevel,
 					&xDown, &xUp, &yDown, &yUp, &zDown, &zUp);
 
-				auto block_present = globalBlockMap->find(blockID);
-
-				if(block_present != globalBlockMap->end()) {
+				if(blockID >= globalBlockMap->size()) {
+					globalBlockMap->resize((size_t) blockID + 1, -1);
+				} else if((*globalBlockMap)[blockID] >= 0) {
 					output->fatal(CALL_INFO, -1, "Block ID: %" PRIu32 " already in map.\n", blockID);
 				}
 
-				globalBlockMap->insert(std::pair<uint32_t, int32_t>(blockID, (int32_t) i));
+				(*globalBlockMap)[blockID] = (int32_t) i;
 			}
 		}
             }
@@ -206,6 +208,8 @@ namespace SST {
 		return true;
 	    }
 
+	    uint32_t getRankCount() const { return rankCount; }
+
         private:
             uint32_t rankCount;
 	    uint64_t rankIndexOffset;
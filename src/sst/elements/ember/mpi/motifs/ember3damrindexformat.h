@@ -0,0 +1,72 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_ELEMENTS_EMBER_AMR_INDEX_FORMAT
+#define _H_SST_ELEMENTS_EMBER_AMR_INDEX_FORMAT
+
+#include <stdint.h>
+
+/*
+ * On-disk layout of an indexed AMR mesh, as written by sst-meshindex.
+ *
+ * The file is memory-mapped read-only and shared by every 3DAMR motif in the
+ * process, so nothing in it needs parsing at startup:
+ *
+ *   EmberAMRIndexHeader
+ *   uint64_t            rankStart[rankCount + 1]   first block of each rank, in blocks
+ *   int32_t             blockToNode[blockIDLimit]  owning rank of each block ID, -1 if unused
+ *   EmberAMRIndexBlock  blocks[blockCount]         grouped by rank
+ *
+ * Each section starts on an 8-byte boundary.
+ */
+
+#define EMBER_AMR_INDEX_MAGIC   "SSTAMRIX"
+#define EMBER_AMR_INDEX_VERSION 1
+
+namespace SST {
+namespace Ember {
+
+struct EmberAMRIndexHeader {
+	char     magic[8];
+	uint32_t version;
+	uint32_t rankCount;
+	uint32_t blockCount;
+	uint32_t maxRefinement;
+	uint32_t blocksX;
+	uint32_t blocksY;
+	uint32_t blocksZ;
+	uint32_t blockIDLimit;
+	uint64_t rankStartOffset;
+	uint64_t blockToNodeOffset;
+	uint64_t blocksOffset;
+};
+
+struct EmberAMRIndexBlock {
+	uint32_t blockID;
+	int8_t   refineLevel;
+	int8_t   xDown;
+	int8_t   xUp;
+	int8_t   yDown;
+	int8_t   yUp;
+	int8_t   zDown;
+	int8_t   zUp;
+	int8_t   pad;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,167 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "ember3damrmeshindex.h"
+#include "ember3damrbinaryfile.h"
+
+using namespace SST::Ember;
+
+static std::mutex meshIndexLock;
+static std::map<std::string, std::shared_ptr<const Ember3DAMRMeshIndex> > meshIndexes;
+
+std::shared_ptr<const Ember3DAMRMeshIndex> Ember3DAMRMeshIndex::get(const char* path, bool isIndexed, Output* out) {
+	std::lock_guard<std::mutex> lock(meshIndexLock);
+
+	auto existing = meshIndexes.find(path);
+	if(existing != meshIndexes.end()) {
+		return existing->second;
+	}
+
+	Ember3DAMRMeshIndex* index = new Ember3DAMRMeshIndex();
+	if(isIndexed) {
+		index->mapIndexFile(path, out);
+	} else {
+		index->scanBinaryFile(path, out);
+	}
+
+	std::shared_ptr<const Ember3DAMRMeshIndex> shared(index);
+	meshIndexes.insert(std::make_pair(std::string(path), shared));
+	return shared;
+}
+
+Ember3DAMRMeshIndex::Ember3DAMRMeshIndex() :
+	blockToNode(nullptr), rankStart(nullptr), blocks(nullptr),
+	blockIDLimit(0), blockCount(0), maxRefinement(0),
+	blocksX(0), blocksY(0), blocksZ(0), rankCount(0),
+	mapping(nullptr), mappingSize(0) {
+}
+
+Ember3DAMRMeshIndex::~Ember3DAMRMeshIndex() {
+	if(nullptr != mapping) {
+		munmap(mapping, mappingSize);
+	}
+}
+
+void Ember3DAMRMeshIndex::mapIndexFile(const char* path, Output* out) {
+	int fd = open(path, O_RDONLY);
+	if(fd < 0) {
+		out->fatal(CALL_INFO, -1, "Unable to open AMR mesh index: %s\n", path);
+	}
+
+	struct stat fileInfo;
+	if(fstat(fd, &fileInfo) != 0 || (size_t) fileInfo.st_size < sizeof(EmberAMRIndexHeader)) {
+		out->fatal(CALL_INFO, -1, "AMR mesh index %s is too small to hold a header\n", path);
+	}
+
+	mappingSize = (size_t) fileInfo.st_size;
+	mapping = mmap(nullptr, mappingSize, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+
+	if(MAP_FAILED == mapping) {
+		mapping = nullptr;
+		out->fatal(CALL_INFO, -1, "Unable to map AMR mesh index: %s\n", path);
+	}
+
+	const char* base = (const char*) mapping;
+	const EmberAMRIndexHeader* header = (const EmberAMRIndexHeader*) base;
+
+	if(memcmp(header->magic, EMBER_AMR_INDEX_MAGIC, sizeof(header->magic)) != 0 ||
+		header->version != EMBER_AMR_INDEX_VERSION) {
+		out->fatal(CALL_INFO, -1, "%s is not a version %d AMR mesh index, regenerate it with sst-meshindex\n",
+			path, EMBER_AMR_INDEX_VERSION);
+	}
+
+	// Every section has to lie inside the mapping, on its 8-byte boundary
+	checkSection(path, "rank start", header->rankStartOffset, ((uint64_t) header->rankCount + 1) * sizeof(uint64_t), out);
+	checkSection(path, "block to rank", header->blockToNodeOffset, (uint64_t) header->blockIDLimit * sizeof(int32_t), out);
+	checkSection(path, "block", header->blocksOffset, (uint64_t) header->blockCount * sizeof(EmberAMRIndexBlock), out);
+
+	rankCount     = header->rankCount;
+	blockCount    = header->blockCount;
+	maxRefinement = header->maxRefinement;
+	blocksX       = header->blocksX;
+	blocksY       = header->blocksY;
+	blocksZ       = header->blocksZ;
+	blockIDLimit  = header->blockIDLimit;
+
+	rankStart   = (const uint64_t*) (base + header->rankStartOffset);
+	blockToNode = (const int32_t*) (base + header->blockToNodeOffset);
+	blocks      = (const EmberAMRIndexBlock*) (base + header->blocksOffset);
+
+	// populateLocalBlocks walks blocks[rankStart[rank], rankStart[rank + 1])
+	for(uint32_t rank = 0; rank < rankCount; ++rank) {
+		if(rankStart[rank] > rankStart[rank + 1] || rankStart[rank + 1] > blockCount) {
+			out->fatal(CALL_INFO, -1, "AMR mesh index %s has an invalid block range for rank %" PRIu32 "\n", path, rank);
+		}
+	}
+
+	out->verbose(CALL_INFO, 2, 0, "Mapped AMR mesh index %s: %" PRIu32 " ranks, %" PRIu32 " blocks, block ID limit %" PRIu32 "\n",
+		path, rankCount, blockCount, blockIDLimit);
+}
+
+void Ember3DAMRMeshIndex::checkSection(const char* path, const char* name, const uint64_t offset, const uint64_t bytes, Output* out) const {
+	if((offset % 8) != 0 || offset < sizeof(EmberAMRIndexHeader) || offset > mappingSize || bytes > mappingSize - offset) {
+		out->fatal(CALL_INFO, -1, "AMR mesh index %s is truncated or corrupt, the %s section at offset %" PRIu64 " (%" PRIu64 " bytes) is outside the %zu byte file\n",
+			path, name, offset, bytes, mappingSize);
+	}
+}
+
+void Ember3DAMRMeshIndex::scanBinaryFile(const char* path, Output* out) {
+	EmberAMRBinaryFile* amrFile = new EmberAMRBinaryFile(const_cast<char*>(path), out);
+
+	maxRefinement = amrFile->getMaxRefinement();
+	blockCount    = amrFile->getBlockCount();
+	blocksX       = amrFile->getBlocksX();
+	blocksY       = amrFile->getBlocksY();
+	blocksZ       = amrFile->getBlocksZ();
+	rankCount     = amrFile->getRankCount();
+
+	amrFile->populateGlobalBlocks(&ownedBlockToNode);
+
+	blockToNode  = ownedBlockToNode.data();
+	blockIDLimit = (uint32_t) ownedBlockToNode.size();
+
+	delete amrFile;
+}
+
+void Ember3DAMRMeshIndex::populateLocalBlocks(std::vector<Ember3DAMRBlock*>* localBlocks, uint32_t rank, Output* out) const {
+	if(rank >= rankCount) {
+		out->fatal(CALL_INFO, -1, "Rank %" PRIu32 " is outside the %" PRIu32 " ranks described by the AMR mesh index\n",
+			rank, rankCount);
+	}
+
+	for(uint64_t i = rankStart[rank]; i < rankStart[rank + 1]; ++i) {
+		const EmberAMRIndexBlock& block = blocks[i];
+
+		out->verbose(CALL_INFO, 32, 0, "Read Block: %" PRIu32 " X-:%" PRId32 ", X+:%" PRId32 ", Y-:%" PRId32 ", Y+:%" PRId32 " Z-:%" PRId32 " Z+:%" PRId32 "\n",
+			block.blockID, (int32_t) block.xDown, (int32_t) block.xUp, (int32_t) block.yDown,
+			(int32_t) block.yUp, (int32_t) block.zDown, (int32_t) block.zUp);
+
+		localBlocks->push_back(new Ember3DAMRBlock(block.blockID, (uint32_t) block.refineLevel,
+			block.xDown, block.xUp, block.yDown, block.yUp, block.zDown, block.zUp));
+	}
+}
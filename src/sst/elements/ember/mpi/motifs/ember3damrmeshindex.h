@@ -0,0 +1,93 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_ELEMENTS_EMBER_AMR_MESH_INDEX
+#define _H_SST_ELEMENTS_EMBER_AMR_MESH_INDEX
+
+#include <sst/core/output.h>
+
+#include <memory>
+#include <vector>
+
+#include "ember3damrblock.h"
+#include "ember3damrindexformat.h"
+
+namespace SST {
+namespace Ember {
+
+/*
+ * Read-only block-to-rank map of an AMR mesh, shared by every 3DAMR motif in
+ * the process that names the same mesh file. Index files from sst-meshindex
+ * are memory-mapped. Binary files from sst-meshconvert are scanned once into
+ * the same flat layout. An index is immutable once get() returns it, so
+ * lookups are safe from any thread.
+ */
+class Ember3DAMRMeshIndex {
+
+public:
+	// Returns the shared index for the file, loading it on first use. isIndexed selects an sst-meshindex file over a binary mesh.
+	static std::shared_ptr<const Ember3DAMRMeshIndex> get(const char* path, bool isIndexed, Output* out);
+
+	~Ember3DAMRMeshIndex();
+
+	// Rank owning the block, or -1 if the block is not in the mesh
+	int32_t getBlockNode(const uint32_t blockID) const {
+		return (blockID < blockIDLimit) ? blockToNode[blockID] : -1;
+	}
+
+	uint32_t getBlockIDLimit() const { return blockIDLimit; }
+	uint32_t getBlockCount() const { return blockCount; }
+	uint32_t getMaxRefinement() const { return maxRefinement; }
+	uint32_t getBlocksX() const { return blocksX; }
+	uint32_t getBlocksY() const { return blocksY; }
+	uint32_t getBlocksZ() const { return blocksZ; }
+	uint32_t getRankCount() const { return rankCount; }
+
+	bool hasRankBlocks() const { return nullptr != blocks; }
+
+	// Only for indexed files, binary meshes read local blocks through EmberAMRBinaryFile
+	void populateLocalBlocks(std::vector<Ember3DAMRBlock*>* localBlocks, uint32_t rank, Output* out) const;
+
+private:
+	Ember3DAMRMeshIndex();
+
+	void mapIndexFile(const char* path, Output* out);
+	void scanBinaryFile(const char* path, Output* out);
+
+	// Fatal unless bytes at offset fit in the mapping and offset is 8-byte aligned
+	void checkSection(const char* path, const char* name, const uint64_t offset, const uint64_t bytes, Output* out) const;
+
+	const int32_t*            blockToNode;
+	const uint64_t*           rankStart;
+	const EmberAMRIndexBlock* blocks;
+	uint32_t blockIDLimit;
+	uint32_t blockCount;
+	uint32_t maxRefinement;
+	uint32_t blocksX;
+	uint32_t blocksY;
+	uint32_t blocksZ;
+	uint32_t rankCount;
+
+	// Backing store: either a file mapping or an owned table
+	void*                mapping;
+	size_t               mappingSize;
+	std::vector<int32_t> ownedBlockToNode;
+};
+
+}
+}
+
+#endif
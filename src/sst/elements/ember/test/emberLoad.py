@@ -40,6 +40,7 @@ netShape = ''
 netHostsPerRtr = 1
 netInspect = ''
 rtrArb = ''
+netMode = 'packet'
 nicsPerNode=1
 
 rndmPlacement = False
@@ -77,7 +78,7 @@ try:
                  "simConfig=","platParams=","debug=","platform=","numNodes=",
                  "numCores=","loadFile=","loadFileVar=","cmdLine=","printStats=","randomPlacement=",
                  "emberVerbose=","netBW=","netPktSize=","netFlitSize=",
-                 "rtrArb=","embermotifLog=","rankmapper=", "motifAPI=",
+                 "rtrArb=","netMode=","embermotifLog=","rankmapper=", "motifAPI=",
                  "bgPercentage=","bgMean=","bgStddev=","bgMsgSize=","netInspect=",
                  "detailedModelName=","detailedModelParams=","detailedModelNodes=",
                  "useSimpleMemoryModel","param=","paramDir=","statsModule=","statsFile="])
@@ -130,6 +131,8 @@ for o, a in opts:
         netInspect = a
     elif o in ("--rtrArb"):
         rtrArb = a
+    elif o in ("--netMode"):
+        netMode = a
     elif o in ("--randomPlacement"):
         if a == "True":
             rndmPlacement = True
@@ -232,6 +235,15 @@ if netFlitSize:
 if netPktSize:
     networkParams['packetSize'] = netPktSize
 
+# flow mode replaces the routers and link controls with firefly.flowLinkControl,
+# every packet is a flow so by default make a packet as big as a message
+if "flow" == netMode:
+    nicParams['module'] = 'firefly.flowLinkControl'
+    if not netPktSize:
+        networkParams['packetSize'] = '1048576B'
+elif "packet" != netMode:
+    sys.exit("Error: unknown netMode " + netMode + " [packet|flow]")
+
 if "" == netTopo:
     if platNetConfig['topology']:
         netTopo = platNetConfig['topology']
@@ -505,10 +517,34 @@ else:
 if topo.getName() == "Fat Tree":
     topo.keepEndPointsWithRouter()
 
-topo.prepParams()
+if "flow" == netMode:
+
+    print ("EMBER: network: flow level model")
+    flowParams = {
+        "link_bw" : sst.merlin._params["link_bw"],
+        "link_lat" : sst.merlin._params["link_lat"],
+    }
+    if "torus" == netTopo:
+        flowParams["topology"] = "torus"
+        torusParams = topoInfo.getNetworkParams()
+        flowParams["shape"] = torusParams["torus.shape"]
+        flowParams["width"] = torusParams["torus.width"]
+        flowParams["local_ports"] = torusParams["torus.local_ports"]
+    else:
+        flowParams["topology"] = "crossbar"
+        flowParams["local_ports"] = int(topoInfo.getNumNodes())
+
+    for nid in range( int(topoInfo.getNumNodes()) ):
+        ep = loadInfo.setNode( nid ).build( nid, {} )
+        if ep:
+            ep[0].addParams( flowParams )
+            ep[0].addParam( "id", nid )
+
+else:
+    topo.prepParams()
 
-topo.setEndPointFunc( loadInfo.setNode )
-topo.build()
+    topo.setEndPointFunc( loadInfo.setNode )
+    topo.build()
 
 if statsModuleName:
 
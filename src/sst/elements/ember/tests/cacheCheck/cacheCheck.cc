@@ -0,0 +1,220 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <assert.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+/*
+ *  Test for the Firefly memory model tag arrays
+ *  Contains:
+ *      * Cache (fully associative LRU) against a list based reference LRU,
+ *        with evictions and inserts split apart the way cacheUnit does them
+ *      * NWayCache against a per set reference LRU
+ *      * a lookup heavy microbenchmark of Cache against the reference
+ *
+ *  Prints one line per check, returns non-zero on the first mismatch.
+ *  The "bench:" lines are host timings.
+ */
+
+// the memory model headers expect these from hermes.h and sst/core/output.h
+namespace Hermes { typedef uint64_t Vaddr; }
+class Output {
+  public:
+    void output( const char* fmt, ... ) {
+        va_list args;
+        va_start( args, fmt );
+        vprintf( fmt, args );
+        va_end( args );
+    }
+};
+
+#include "cache.h"
+#include "nWayCache.h"
+
+// The list and multimap LRU that Cache replaced
+class RefCache {
+  public:
+    RefCache( int cacheSize ) : m_cacheSize( cacheSize ) {
+        for ( int i = 0; i < cacheSize; i++ ){
+            insert( -1 );
+        }
+    }
+
+    bool isValid( Hermes::Vaddr addr ) {
+        return m_addrMap.find(addr) != m_addrMap.end();
+    }
+
+    void updateAge( Hermes::Vaddr addr ) {
+        auto it = m_addrMap.find( addr );
+        m_ageList.splice( m_ageList.end(), m_ageList, it->second );
+    }
+
+    Hermes::Vaddr evict() {
+        Hermes::Vaddr addr = m_ageList.front();
+        auto range = m_addrMap.equal_range( addr );
+        for ( auto it = range.first; it != range.second; ++it ) {
+            if ( it->second == m_ageList.begin() ) {
+                m_addrMap.erase( it );
+                break;
+            }
+        }
+        m_ageList.pop_front();
+        return addr;
+    }
+
+    void insert( Hermes::Vaddr addr ) {
+        assert( (int) m_ageList.size() < m_cacheSize );
+        m_ageList.push_back( addr );
+        m_addrMap.insert( std::make_pair( addr, std::prev( m_ageList.end() ) ) );
+    }
+
+  private:
+    int m_cacheSize;
+    std::list<Hermes::Vaddr> m_ageList;
+    std::unordered_multimap<Hermes::Vaddr, std::list<Hermes::Vaddr>::iterator> m_addrMap;
+};
+
+static uint64_t rngState = 0x9E3779B97F4A7C15ULL;
+static uint64_t nextRand() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return rngState;
+}
+
+#define CHECK(cond, ...) \
+    if (!(cond)) { printf("FAIL "); printf(__VA_ARGS__); printf("\n"); return false; }
+
+// Line addresses with some locality: a hot set that fits and a cold range that does not
+static Hermes::Vaddr nextAddr( int cacheSize, int lineSize ) {
+    uint64_t r = nextRand();
+    uint64_t line = ( r % 4 ) ? ( r >> 8 ) % ( cacheSize / 2 + 1 ) : ( r >> 8 ) % ( cacheSize * 4 );
+    return line * lineSize;
+}
+
+static bool testCache( int cacheSize, int ops ) {
+    Cache cache( cacheSize );
+    RefCache ref( cacheSize );
+    // misses whose fill has not arrived yet, as in cacheUnit
+    std::deque<Hermes::Vaddr> pending;
+    uint64_t hits = 0, evictions = 0;
+
+    for ( int op = 0; op < ops; op++ ) {
+        Hermes::Vaddr addr = nextAddr( cacheSize, 64 );
+        bool valid = cache.isValid( addr );
+        CHECK( valid == ref.isValid( addr ), "cache %d op %d: isValid(%#" PRIx64 ") is %d, reference %d", cacheSize, op, addr, valid, ! valid );
+        if ( valid ) {
+            cache.updateAge( addr );
+            ref.updateAge( addr );
+            ++hits;
+        } else if ( pending.end() == std::find( pending.begin(), pending.end(), addr ) ) {
+            pending.push_back( addr );
+        }
+        // fills come back a few accesses later, the victim is chosen at fill time
+        while ( ! pending.empty() && ( pending.size() > 4 || nextRand() % 2 ) ) {
+            Hermes::Vaddr evicted = cache.evict();
+            Hermes::Vaddr refEvicted = ref.evict();
+            CHECK( evicted == refEvicted, "cache %d op %d: evicted %#" PRIx64 ", reference %#" PRIx64, cacheSize, op, evicted, refEvicted );
+            cache.insert( pending.front() );
+            ref.insert( pending.front() );
+            pending.pop_front();
+            ++evictions;
+        }
+    }
+    printf("cache %d lines: %d accesses, %" PRIu64 " hits, %" PRIu64 " evictions match the reference\n", cacheSize, ops, hits, evictions );
+    return true;
+}
+
+static bool testNWayCache( int assoc, int nSets, int pageSize, int ops ) {
+    NWayCache cache( assoc, nSets, pageSize );
+    // built in place, a copied RefCache would hold iterators into the original's list
+    std::deque<RefCache> ref;
+    for ( int i = 0; i < nSets; i++ ) {
+        ref.emplace_back( assoc );
+    }
+    uint64_t hits = 0, evictions = 0;
+
+    for ( int op = 0; op < ops; op++ ) {
+        Hermes::Vaddr addr = nextAddr( assoc * nSets, pageSize );
+        int set = ( addr / pageSize ) % nSets;
+        bool valid = cache.isValid( addr );
+        CHECK( valid == ref[set].isValid( addr ), "nway %dx%d op %d: isValid(%#" PRIx64 ") is %d, reference %d", assoc, nSets, op, addr, valid, ! valid );
+        if ( valid ) {
+            cache.updateAge( addr );
+            ref[set].updateAge( addr );
+            ++hits;
+        } else {
+            Hermes::Vaddr evicted = cache.evict( addr );
+            Hermes::Vaddr refEvicted = ref[set].evict();
+            CHECK( evicted == refEvicted, "nway %dx%d op %d: evicted %#" PRIx64 ", reference %#" PRIx64, assoc, nSets, op, evicted, refEvicted );
+            cache.insert( addr );
+            ref[set].insert( addr );
+            ++evictions;
+        }
+    }
+    printf("nway %d ways x %d sets: %d accesses, %" PRIu64 " hits, %" PRIu64 " evictions match the reference\n", assoc, nSets, ops, hits, evictions );
+    return true;
+}
+
+template<class T>
+static double benchLookups( int cacheSize, int ops, uint64_t& hits ) {
+    T cache( cacheSize );
+    rngState = 0x2545F4914F6CDD1DULL;
+    auto start = std::chrono::steady_clock::now();
+    for ( int op = 0; op < ops; op++ ) {
+        Hermes::Vaddr addr = nextAddr( cacheSize, 64 );
+        if ( cache.isValid( addr ) ) {
+            cache.updateAge( addr );
+            ++hits;
+        } else {
+            cache.evict();
+            cache.insert( addr );
+        }
+    }
+    std::chrono::duration<double, std::nano> ns = std::chrono::steady_clock::now() - start;
+    return ns.count() / ops;
+}
+
+int main( int argc, char* argv[] ) {
+    int benchOps = argc > 1 ? atoi( argv[1] ) : 2000000;
+
+    if ( ! testCache( 1, 10000 ) ) return 1;
+    if ( ! testCache( 64, 200000 ) ) return 1;
+    if ( ! testCache( 4096, 500000 ) ) return 1;
+    if ( ! testNWayCache( 4, 16, 4096, 200000 ) ) return 1;
+    if ( ! testNWayCache( 8, 64, 64, 200000 ) ) return 1;
+
+    for ( int cacheSize : { 64, 4096 } ) {
+        uint64_t hits = 0, refHits = 0;
+        double ns = benchLookups<Cache>( cacheSize, benchOps, hits );
+        double refNs = benchLookups<RefCache>( cacheSize, benchOps, refHits );
+        if ( hits != refHits ) {
+            printf("FAIL bench cache %d: %" PRIu64 " hits, reference %" PRIu64 "\n", cacheSize, hits, refHits );
+            return 1;
+        }
+        printf("bench: cache %d lines: %.1f ns/access, reference %.1f ns/access, %.2fx\n", cacheSize, ns, refNs, refNs / ns );
+    }
+    return 0;
+}
@@ -0,0 +1,36 @@
+import sst
+
+# Two flows into node 2 over the firefly flow level network, the second starts 100us
+# after the first. With max-min fair sharing of the ejection link the second flow
+# (100KB at 1GB/s) gets half of the link as soon as it starts and finishes 300us in.
+
+link_bw = "1GB/s"
+link_lat = "20ns"
+
+streams = [ (0, 2, "1000000B", "0ns"), (1, 2, "100000B", "100us") ]
+
+for node in range(3):
+    nic = sst.Component("nic{0}".format(node), "merlin.pt2pt_test")
+
+    size = "1B"
+    for (src, dest, bytes, delay) in streams:
+        if src == node:
+            size = bytes
+
+    nic.addParams({
+        "packet_size" : size,
+        "buffer_size" : size,
+        "packets_to_send" : 1,
+        "src" : [ s[0] for s in streams ],
+        "dest" : [ s[1] for s in streams ],
+        "stream_delays" : [ s[3] for s in streams ],
+    })
+
+    net = nic.setSubComponent("networkIF", "firefly.flowLinkControl")
+    net.addParams({
+        "id" : node,
+        "link_bw" : link_bw,
+        "link_lat" : link_lat,
+        "topology" : "crossbar",
+        "local_ports" : 3,
+    })
@@ -3,7 +3,12 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import filecmp
 import os
+import re
+import shutil
+import struct
+import time
 
 
 class testcase_EmberNightly(SSTTestCase):
@@ -26,10 +31,228 @@ class testcase_EmberNightly(SSTTestCase):
         otherargs = '--verbose --model-options \"--topo=torus --shape=4x4x4 --cmdLine=\"Init\" --cmdLine=\"Allreduce\" --cmdLine=\"Fini\" \"'
         self.Ember_test_template("test_emberparams", otherargs = otherargs, testoutput = False)
 
+    def test_Ember_Multithread(self):
+        # Same job spread over several threads, with a motif log, to catch shared state between partitions
+        otherargs = '--model-options \"--topo=torus --shape=4x4x4 --embermotifLog=motif --cmdLine=\"Init\" --cmdLine=\"Allreduce\" --cmdLine=\"Fini\" \"'
+        self.Ember_test_template("test_embermultithread", otherargs = otherargs, testoutput = False, threads = 4)
+
+    def test_Ember_PayloadFree(self):
+        # 1024 node halo3d with and without packet payloads, the timing must not change
+        halo = 'Halo3D pex=8 pey=8 pez=16 nx=64 ny=64 nz=64 iterations=2'
+        results = {}
+        for payloadFree in [ "false", "true" ]:
+            results[payloadFree] = self._runTimed("test_emberpayloadfree_{0}".format(payloadFree), "8x8x16", halo,
+                "--param=nic:payloadFree={0} ".format(payloadFree))
+
+        self.assertEqual(results["false"][0], results["true"][0], "payloadFree changed the simulated time")
+
+        log_testing_note("Ember halo3d 1024 nodes: max RSS {0} -> {1}, run time {2:.2f}s -> {3:.2f}s ({4:.2f}x events/sec) with payloadFree".format(
+            results["false"][1], results["true"][1], results["false"][2], results["true"][2],
+            results["false"][2] / results["true"][2] if results["true"][2] > 0 else 0))
+
+    def test_Ember_FlowMode(self):
+        # the flow level network must track the packet level network for large messages
+        alltoall = 'Alltoall bytes=262144 iterations=2'
+        results = {}
+        for netMode in [ "packet", "flow" ]:
+            results[netMode] = self._runTimed("test_emberflowmode_{0}".format(netMode), "4x4x4", alltoall,
+                "--netMode={0} ".format(netMode))
+
+        packetTime = self._simTimeToSeconds(results["packet"][0])
+        flowTime = self._simTimeToSeconds(results["flow"][0])
+        error = abs(flowTime - packetTime) / packetTime
+
+        log_testing_note("Ember alltoall 64 nodes: simulated time {0} packet, {1} flow ({2:.1f}% error), run time {3:.2f}s -> {4:.2f}s".format(
+            results["packet"][0], results["flow"][0], error * 100, results["packet"][2], results["flow"][2]))
+
+        self.assertTrue(error < 0.25, "flow level simulated time {0} is not within 25% of packet level {1}".format(results["flow"][0], results["packet"][0]))
+
+    def test_Ember_FlowStaggered(self):
+        # a 100KB flow that starts 100us into a 1MB flow to the same node must get half of the
+        # 1GB/s ejection link straight away, so it arrives at 300us plus two 20ns link latencies
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/flow_staggered.py".format(test_path)
+        outfile = "{0}/test_emberflowstaggered.out".format(outdir)
+        errfile = "{0}/test_emberflowstaggered.err".format(outdir)
+
+        self.run_sst(sdlfile, outfile, errfile)
+
+        arrival = None
+        with open(outfile) as fp:
+            match = re.search(r"For src = 1 and dest = 2:\s*\n\s*First packet received at: (.*)", fp.read())
+            if match:
+                arrival = self._simTimeToSeconds(match.group(1).strip())
+        self.assertTrue(arrival is not None, "No arrival time for the second flow in {0}".format(outfile))
+
+        expected = 300.04e-6
+        self.assertTrue(abs(arrival - expected) / expected < 0.01,
+            "second flow arrived at {0:.2f}us, fair share is {1:.2f}us".format(arrival * 1e6, expected * 1e6))
+
+    def test_Ember_IncastScaling(self):
+        # host time per received message as the number of senders grows, with indexed posted
+        # receives it must stay roughly flat instead of growing with the fan-in. The messages are
+        # longer than shortMsgLength so they go through the rendezvous path and the posted queue
+        iterations = 20
+        perMsg = []
+        for shape in [ "4x4", "4x4x4", "8x8x4" ]:
+            numNodes = 1
+            for dim in shape.split('x'):
+                numNodes *= int(dim)
+            results = self._runTimed("test_emberincast_{0}".format(numNodes), shape,
+                "Incast messageSize=32768 iterations={0}".format(iterations))
+            perMsg.append( (numNodes - 1, results[2] * 1e6 / ((numNodes - 1) * iterations)) )
+
+        log_testing_note("Ember incast host time per message: {0}".format(
+            ", ".join([ "fan-in {0}: {1:.1f}us".format(fanIn, us) for (fanIn, us) in perMsg ])))
+
+        # fan-in grows 17x, a linear scan of the posted receives grows the per message cost with it
+        self.assertTrue(perMsg[-1][1] < 4 * perMsg[0][1],
+            "host time per message grew from {0:.1f}us at fan-in {1} to {2:.1f}us at fan-in {3}".format(
+                perMsg[0][1], perMsg[0][0], perMsg[-1][1], perMsg[-1][0]))
+
+    def test_Ember_MemoryModelCost(self):
+        # run time of the simple host memory model relative to the trivial one
+        halo = 'Halo3D pex=4 pey=4 pez=4 nx=64 ny=64 nz=64 iterations=4'
+        results = {}
+        for memModel in [ "trivial", "simple" ]:
+            results[memModel] = self._runTimed("test_embermemmodel_{0}".format(memModel), "4x4x4", halo,
+                "--useSimpleMemoryModel " if memModel == "simple" else "")
+
+        ratio = results["simple"][2] / results["trivial"][2] if results["trivial"][2] > 0 else 0
+
+        log_testing_note("Ember halo3d 64 nodes: run time {0:.2f}s trivial, {1:.2f}s simple memory model ({2:.2f}x)".format(
+            results["trivial"][2], results["simple"][2], ratio))
+
+        self.assertTrue(ratio < 2.0, "simple memory model run time is {0:.2f}x the trivial model, must be under 2x".format(ratio))
+
+    def test_Ember_MemoryModelCache(self):
+        # builds the standalone check of the Firefly memory model tag arrays against a
+        # reference LRU, the lookup benchmark lines are host timings and only logged
+        testcase = "test_embermemmodel_cache"
+        test_path = self.get_testsuite_dir()
+        toolDir = "{0}/cacheCheck".format(self.emberSweep_Folder)
+        outfile = "{0}/{1}.out".format(self.get_test_output_run_dir(), testcase)
+        reffile = "{0}/refFiles/{1}.out".format(test_path, testcase)
+
+        if os.path.isdir(toolDir):
+            shutil.rmtree(toolDir, True)
+        os.makedirs(toolDir)
+        shutil.copy("{0}/cacheCheck/Makefile".format(test_path), toolDir)
+        os_symlink_file("{0}/cacheCheck".format(test_path), toolDir, "cacheCheck.cc")
+
+        rtn = OSCommand("make FIREFLY_DIR={0}/../../firefly".format(test_path), set_cwd=toolDir).run()
+        log_debug("Make result = {0}; output =\n{1}".format(rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "cacheCheck.cc failed to compile")
+
+        rtn = OSCommand("./cacheCheck", output_file_path=outfile, set_cwd=toolDir).run(timeout_sec=240)
+        self.assertTrue(rtn.result() == 0, "cacheCheck failed, see {0}".format(outfile))
+
+        with open(outfile, 'r') as fp:
+            lines = fp.readlines()
+        for line in lines:
+            if line.startswith("bench:"):
+                log_testing_note("Firefly memory model {0}".format(line.strip()))
+        with open(outfile, 'w') as fp:
+            fp.writelines([ line for line in lines if not line.startswith("bench:") ])
+
+        cmp_result = testing_compare_diff(testcase, outfile, reffile)
+        if cmp_result == False:
+            diffdata = testing_get_diff_data(testcase)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def test_Ember_AMRIndexed(self):
+        # sst-meshindex must reproduce the reference index of a binary 3DAMR mesh, and the
+        # binary and indexed files must simulate the same
+        binaryFile = "{0}/amr_4x4x4.bin".format(self.emberSweep_Folder)
+        indexFile = "{0}/amr_4x4x4.idx".format(self.emberSweep_Folder)
+        self._writeAMRMesh(binaryFile)
+
+        testcase = "test_emberamr_meshindex"
+        outfile = "{0}/{1}.out".format(self.get_test_output_run_dir(), testcase)
+        reffile = "{0}/refFiles/{1}.out".format(self.get_testsuite_dir(), testcase)
+        elem_bin_dir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY", "SST_ELEMENT_LIBRARY_BINDIR", str, "BINDIR_UNDEFINED")
+        rtn = OSCommand("{0}/sst-meshindex {1} {2}".format(elem_bin_dir, binaryFile, indexFile), output_file_path=outfile).run()
+        self.assertTrue(rtn.result() == 0, "sst-meshindex failed, see {0}".format(outfile))
+
+        cmp_result = testing_compare_diff(testcase, outfile, reffile)
+        if cmp_result == False:
+            diffdata = testing_get_diff_data(testcase)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
+
+        refIndex = "{0}/refFiles/test_emberamr_4x4x4.idx".format(self.get_testsuite_dir())
+        self.assertTrue(filecmp.cmp(indexFile, refIndex, shallow=False), "Index file {0} does not match Reference File {1}".format(indexFile, refIndex))
+
+        results = {}
+        for fileType, ext in [ ("binary", "bin"), ("indexed", "idx") ]:
+            results[fileType] = self._runTimed("test_emberamr_{0}".format(fileType), "2x2x2",
+                "3DAMR blockfile=amr_4x4x4.{0} filetype={1} iterations=2".format(ext, fileType))
+
+        self.assertEqual(results["binary"][0], results["indexed"][0], "indexed mesh changed the simulated time")
+
+    # runs emberLoad.py on a torus with motif between Init and Fini, returns the simulated
+    # time, max RSS and run loop time
+    def _runTimed(self, testcase, shape, motif, modelOptions = ""):
+        otherargs = '--print-timing-info --model-options=\"--topo=torus --shape={0} {1}--cmdLine=\\\"Init\\\" --cmdLine=\\\"{2}\\\" --cmdLine=\\\"Fini\\\" \"'.format(shape, modelOptions, motif)
+        start = time.time()
+        self.Ember_test_template(testcase, otherargs = otherargs, testoutput = False)
+        wall = time.time() - start
+        return self._parseTimingInfo("{0}/{1}.out".format(self.get_test_output_run_dir(), testcase), wall)
+
+    # writes a 4x4x4 block mesh with no refinement, split into 2x2x2 block cubes over 8 ranks, in
+    # the sst-meshconvert binary format
+    def _writeAMRMesh(self, binaryFile):
+        dim = 4
+        ranks = 8
+        rankBlocks = [ [] for rank in range(ranks) ]
+        for blockID in range(dim * dim * dim):
+            x, y, z = blockID % dim, (blockID // dim) % dim, blockID // (dim * dim)
+            # -2 is a mesh boundary, 0 a neighbour on refinement level 0
+            faces = [ -2 if pos == 0 else 0 for pos in (x, y, z) ]
+            faces = [ faces[0], -2 if x == dim - 1 else 0, faces[1], -2 if y == dim - 1 else 0, faces[2], -2 if z == dim - 1 else 0 ]
+            rankBlocks[(x // 2) + 2 * (y // 2) + 4 * (z // 2)].append( (blockID, faces) )
+
+        with open(binaryFile, "wb") as fp:
+            fp.write(struct.pack("<IIBIII", ranks, dim ** 3, 0, dim, dim, dim))
+            offset = fp.tell() + 8 * ranks
+            for blocks in rankBlocks:
+                fp.write(struct.pack("<Q", offset))
+                offset += 4 + 11 * len(blocks)
+            for blocks in rankBlocks:
+                fp.write(struct.pack("<I", len(blocks)))
+                for blockID, faces in blocks:
+                    fp.write(struct.pack("<Ib6b", blockID, 0, *faces))
+
+    def _simTimeToSeconds(self, simTime):
+        scale = { "s" : 1.0, "ms" : 1e-3, "us" : 1e-6, "ns" : 1e-9, "ps" : 1e-12, "fs" : 1e-15 }
+        match = re.match(r"([\d.eE+-]+)\s*(\w+)", simTime)
+        self.assertTrue(match is not None and match.group(2) in scale, "Can't parse simulated time {0}".format(simTime))
+        return float(match.group(1)) * scale[match.group(2)]
+
+    def _parseTimingInfo(self, outfile, wall):
+        simTime = None
+        rss = "unknown"
+        runTime = wall
+        with open(outfile) as fp:
+            for line in fp:
+                match = re.search(r"Simulation is complete, simulated time: (.*)", line)
+                if match:
+                    simTime = match.group(1).strip()
+                match = re.search(r"Max Resident Set Size:\s+(.*)", line)
+                if match:
+                    rss = match.group(1).strip()
+                match = re.search(r"Run loop time:\s+([\d.]+)", line)
+                if match:
+                    runTime = float(match.group(1))
+        self.assertTrue(simTime is not None, "No end of simulation detected in output file {0}".format(outfile))
+        return (simTime, rss, runTime)
+
 
 #####
 
-    def Ember_test_template(self, testcase, otherargs, testoutput):
+    def Ember_test_template(self, testcase, otherargs, testoutput, threads = None):
 
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
@@ -49,7 +272,7 @@ class testcase_EmberNightly(SSTTestCase):
         sdlfile = "{0}/../test/emberLoad.py".format(test_path)
 
         # Run SST
-        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, set_cwd=self.emberSweep_Folder, mpi_out_files=mpioutfiles)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, set_cwd=self.emberSweep_Folder, mpi_out_files=mpioutfiles, num_threads=threads)
 
 #        testing_remove_component_warning_from_file(outfile)
 
@@ -65,6 +288,10 @@ class testcase_EmberNightly(SSTTestCase):
                 log_failure(diffdata)
             self.assertTrue(cmp_result, "Diffed compared Output file {0} does not match Reference File {1}".format(outfile, reffile))
 
+        if threads is not None:
+            with open(outfile) as fn:
+                self.assertIn("Simulation is complete", fn.read(), "No end of simulation detected in output file {0}".format(outfile))
+
         if os_test_file(errfile, "-s"):
             log_testing_note("Ember Nightly test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
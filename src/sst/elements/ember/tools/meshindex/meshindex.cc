@@ -0,0 +1,155 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <vector>
+
+#include "sst/elements/ember/mpi/motifs/ember3damrindexformat.h"
+
+using namespace SST::Ember;
+
+void usage() {
+	printf("Usage: meshindex <file in> <file out>\n");
+	printf("<file in>        Is the binary mesh written by sst-meshconvert\n");
+	printf("<file out>       Is the indexed mesh to be written, load it with arg.filetype=indexed\n");
+	exit(-1);
+}
+
+template<typename T>
+void readValue(FILE* in, T* value, const char* what) {
+	if(fread(value, sizeof(T), 1, in) != 1) {
+		fprintf(stderr, "Unexpected end of mesh while reading %s\n", what);
+		exit(-1);
+	}
+}
+
+uint64_t alignOffset(uint64_t offset) {
+	return (offset + 7) & ~((uint64_t) 7);
+}
+
+void writeAt(FILE* out, uint64_t offset, const void* data, size_t bytes) {
+	if(fseek(out, (long) offset, SEEK_SET) != 0 || (bytes > 0 && fwrite(data, bytes, 1, out) != 1)) {
+		fprintf(stderr, "Error writing indexed mesh\n");
+		exit(-1);
+	}
+}
+
+int main(int argc, char* argv[]) {
+	printf("SST MiniAMR Mesh Indexer\n");
+
+	if(argc < 3) {
+		usage();
+	}
+
+	FILE* inMesh = fopen(argv[1], "rb");
+	if(NULL == inMesh) {
+		fprintf(stderr, "Unable to open input mesh: %s\n", argv[1]);
+		exit(-1);
+	}
+
+	EmberAMRIndexHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, EMBER_AMR_INDEX_MAGIC, sizeof(header.magic));
+	header.version = EMBER_AMR_INDEX_VERSION;
+
+	uint8_t maxRefinementLevel = 0;
+	readValue(inMesh, &header.rankCount, "rank count");
+	readValue(inMesh, &header.blockCount, "block count");
+	readValue(inMesh, &maxRefinementLevel, "refinement level");
+	readValue(inMesh, &header.blocksX, "blocks in X");
+	readValue(inMesh, &header.blocksY, "blocks in Y");
+	readValue(inMesh, &header.blocksZ, "blocks in Z");
+	header.maxRefinement = maxRefinementLevel;
+
+	const long rankIndexOffset = ftell(inMesh);
+
+	std::vector<uint64_t> rankStart(header.rankCount + 1, 0);
+	std::vector<int32_t> blockToNode;
+	std::vector<EmberAMRIndexBlock> blocks;
+	blocks.reserve(header.blockCount);
+
+	for(uint32_t i = 0; i < header.rankCount; i++) {
+		uint64_t rankFileIndex = 0;
+		fseek(inMesh, rankIndexOffset + (long) (i * sizeof(uint64_t)), SEEK_SET);
+		readValue(inMesh, &rankFileIndex, "rank index");
+		fseek(inMesh, (long) rankFileIndex, SEEK_SET);
+
+		uint32_t blocksOnNode = 0;
+		readValue(inMesh, &blocksOnNode, "rank block count");
+
+		rankStart[i] = blocks.size();
+
+		for(uint32_t j = 0; j < blocksOnNode; j++) {
+			EmberAMRIndexBlock block;
+			memset(&block, 0, sizeof(block));
+
+			readValue(inMesh, &block.blockID, "block ID");
+			readValue(inMesh, &block.refineLevel, "block refinement level");
+			readValue(inMesh, &block.xDown, "block X-");
+			readValue(inMesh, &block.xUp, "block X+");
+			readValue(inMesh, &block.yDown, "block Y-");
+			readValue(inMesh, &block.yUp, "block Y+");
+			readValue(inMesh, &block.zDown, "block Z-");
+			readValue(inMesh, &block.zUp, "block Z+");
+
+			if(block.blockID >= blockToNode.size()) {
+				blockToNode.resize((size_t) block.blockID + 1, -1);
+			} else if(blockToNode[block.blockID] >= 0) {
+				fprintf(stderr, "Block %" PRIu32 " appears on rank %" PRId32 " and rank %" PRIu32 "\n",
+					block.blockID, blockToNode[block.blockID], i);
+				exit(-1);
+			}
+
+			blockToNode[block.blockID] = (int32_t) i;
+			blocks.push_back(block);
+		}
+	}
+
+	rankStart[header.rankCount] = blocks.size();
+	fclose(inMesh);
+
+	if(blocks.size() != header.blockCount) {
+		printf("Warning: mesh header says %" PRIu32 " blocks, ranks hold %" PRIu64 "\n",
+			header.blockCount, (uint64_t) blocks.size());
+		header.blockCount = (uint32_t) blocks.size();
+	}
+
+	header.blockIDLimit      = (uint32_t) blockToNode.size();
+	header.rankStartOffset   = alignOffset(sizeof(header));
+	header.blockToNodeOffset = alignOffset(header.rankStartOffset + rankStart.size() * sizeof(uint64_t));
+	header.blocksOffset      = alignOffset(header.blockToNodeOffset + blockToNode.size() * sizeof(int32_t));
+
+	FILE* outMesh = fopen(argv[2], "wb");
+	if(NULL == outMesh) {
+		fprintf(stderr, "Unable to open output mesh: %s\n", argv[2]);
+		exit(-1);
+	}
+
+	writeAt(outMesh, 0, &header, sizeof(header));
+	writeAt(outMesh, header.rankStartOffset, rankStart.data(), rankStart.size() * sizeof(uint64_t));
+	writeAt(outMesh, header.blockToNodeOffset, blockToNode.data(), blockToNode.size() * sizeof(int32_t));
+	writeAt(outMesh, header.blocksOffset, blocks.data(), blocks.size() * sizeof(EmberAMRIndexBlock));
+
+	fclose(outMesh);
+
+	printf("Indexed %" PRIu32 " ranks, %" PRIu32 " blocks, block IDs below %" PRIu32 "\n",
+		header.rankCount, header.blockCount, header.blockIDLimit);
+
+	return 0;
+}
@@ -0,0 +1,407 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include <cmath>
+#include <sstream>
+
+#include "flowNetwork.h"
+
+using namespace SST;
+using namespace SST::Firefly;
+using namespace SST::Interfaces;
+
+FlowModel* FlowLinkControl::s_model = nullptr;
+
+static void parseDims( const std::string& str, std::vector<int>& dims )
+{
+    std::stringstream ss( str );
+    std::string tok;
+    while ( std::getline( ss, tok, 'x' ) ) {
+        dims.push_back( std::stoi( tok ) );
+    }
+}
+
+FlowModel::FlowModel( Params& params, double bitsPerCycle, SimTime_t hopLatency ) :
+    m_timerOwner( nullptr ), m_numNodes(0), m_hopLatency( hopLatency ),
+    m_lastTime(0), m_generation(0), m_updatePending(false), m_updateTime(0), m_numFlows(0)
+{
+    m_out.init( "@t:FlowModel::@p():@l ", params.find<uint32_t>( "verbose", 0 ), 0, Output::STDOUT );
+
+    std::string topo = params.find<std::string>( "topology", "crossbar" );
+    m_localPorts = params.find<int>( "local_ports", 1 );
+
+    if ( 0 == topo.compare( "torus" ) ) {
+        parseDims( params.find<std::string>( "shape", "" ), m_dims );
+        if ( m_dims.empty() ) {
+            m_out.fatal( CALL_INFO, -1, "Error: flowLinkControl torus needs a shape\n" );
+        }
+        std::string width = params.find<std::string>( "width", "" );
+        if ( width.empty() ) {
+            m_widths.assign( m_dims.size(), 1 );
+        } else {
+            parseDims( width, m_widths );
+        }
+        if ( m_widths.size() != m_dims.size() ) {
+            m_out.fatal( CALL_INFO, -1, "Error: flowLinkControl torus width %s does not match the shape\n", width.c_str() );
+        }
+        m_numRouters = 1;
+        for ( auto dim : m_dims ) {
+            m_numRouters *= dim;
+        }
+    } else if ( 0 == topo.compare( "crossbar" ) ) {
+        m_numRouters = 1;
+    } else {
+        m_out.fatal( CALL_INFO, -1, "Error: flowLinkControl unknown topology %s\n", topo.c_str() );
+    }
+
+    m_numNodes = m_numRouters * m_localPorts;
+
+    size_t numLinks = ejectLink( m_numNodes );
+    m_linkCap.resize( numLinks, bitsPerCycle );
+    for ( int rtr = 0; rtr < m_numRouters; rtr++ ) {
+        for ( unsigned dim = 0; dim < m_dims.size(); dim++ ) {
+            m_linkCap[ rtrLink( rtr, dim, 0 ) ] = bitsPerCycle * m_widths[dim];
+            m_linkCap[ rtrLink( rtr, dim, 1 ) ] = bitsPerCycle * m_widths[dim];
+        }
+    }
+    m_linkFree.resize( numLinks );
+    m_linkCount.resize( numLinks, 0 );
+    m_linkVersion.resize( numLinks, 0 );
+    m_linkFlows.resize( numLinks );
+}
+
+void FlowModel::addEndpoint( int id, FlowLinkControl* ep )
+{
+    if ( id < 0 || id >= m_numNodes ) {
+        m_out.fatal( CALL_INFO, -1, "Error: flowLinkControl id %d is not in the network, %d nodes\n", id, m_numNodes );
+    }
+    if ( id >= (int) m_endpoints.size() ) {
+        m_endpoints.resize( id + 1, nullptr );
+    }
+    if ( m_endpoints[id] ) {
+        m_out.fatal( CALL_INFO, -1, "Error: flowLinkControl id %d is used twice\n", id );
+    }
+    m_endpoints[id] = ep;
+
+    // any endpoint can own the rate update timer, all see the same time
+    if ( nullptr == m_timerOwner ) {
+        m_timerOwner = ep;
+    }
+}
+
+bool FlowModel::removeEndpoint( int id )
+{
+    m_endpoints[id] = nullptr;
+    for ( auto ep : m_endpoints ) {
+        if ( ep ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// dimension order, shortest direction first, the same path the merlin torus takes
+void FlowModel::calcRoute( int src, int dest, std::vector<uint32_t>& route )
+{
+    route.push_back( injectLink( src ) );
+
+    int rtr = src / m_localPorts;
+    int destRtr = dest / m_localPorts;
+    int stride = 1;
+    for ( unsigned dim = 0; dim < m_dims.size(); dim++ ) {
+        int size = m_dims[dim];
+        int loc = ( rtr / stride ) % size;
+        int destLoc = ( destRtr / stride ) % size;
+
+        int distPos = destLoc - loc;
+        if ( distPos < 0 ) distPos += size;
+        int distNeg = loc - destLoc;
+        if ( distNeg < 0 ) distNeg += size;
+
+        int dir = distPos <= distNeg ? 0 : 1;
+        int hops = dir ? distNeg : distPos;
+        for ( int i = 0; i < hops; i++ ) {
+            route.push_back( rtrLink( rtr, dim, dir ) );
+            int next = dir ? ( loc + size - 1 ) % size : ( loc + 1 ) % size;
+            rtr += ( next - loc ) * stride;
+            loc = next;
+        }
+        stride *= size;
+    }
+
+    route.push_back( ejectLink( dest ) );
+}
+
+void FlowModel::startFlow( SimTime_t now, SimpleNetwork::Request* req )
+{
+    if ( req->dest >= (SimpleNetwork::nid_t) m_numNodes ) {
+        m_out.fatal( CALL_INFO, -1, "Error: flowLinkControl destination %" PRIu64 " is not in the network\n", (uint64_t) req->dest );
+    }
+
+    advance( now );
+
+    m_flows.push_back( Flow() );
+    Flow& flow = m_flows.back();
+    flow.req = req;
+    flow.remaining = req->size_in_bits;
+    flow.rate = 0;
+    calcRoute( req->src, req->dest, flow.route );
+    ++m_numFlows;
+
+    // flows that start in the same cycle share one rate update, an update pending for a
+    // later cycle is replaced so the new flow gets its share now
+    if ( ! m_updatePending || m_updateTime != now ) {
+        schedule( now, 0 );
+    }
+}
+
+void FlowModel::update( SimTime_t now, uint64_t generation )
+{
+    if ( generation != m_generation ) {
+        return;
+    }
+    m_updatePending = false;
+
+    advance( now );
+
+    for ( size_t i = 0; i < m_flows.size(); ) {
+        Flow& flow = m_flows[i];
+        // done if it would finish within the next half cycle
+        if ( flow.rate > 0 && flow.remaining <= flow.rate / 2 ) {
+            SimTime_t latency = m_hopLatency * flow.route.size();
+            m_out.debug( CALL_INFO, 1, 0, "flow %" PRIu64 " -> %" PRIu64 " done, %zu bits, latency %" PRIu64 "\n",
+                    (uint64_t) flow.req->src, (uint64_t) flow.req->dest, (size_t) flow.req->size_in_bits, latency );
+            m_endpoints[ flow.req->dest ]->deliver( latency, flow.req );
+            if ( i + 1 < m_flows.size() ) {
+                flow = std::move( m_flows.back() );
+            }
+            m_flows.pop_back();
+        } else {
+            ++i;
+        }
+    }
+
+    if ( m_flows.empty() ) {
+        return;
+    }
+
+    assignRates();
+
+    double next = -1;
+    for ( auto& flow : m_flows ) {
+        double t = flow.remaining / flow.rate;
+        if ( next < 0 || t < next ) {
+            next = t;
+        }
+    }
+    schedule( now, next < 1 ? 1 : (SimTime_t) std::ceil( next ) );
+}
+
+void FlowModel::advance( SimTime_t now )
+{
+    SimTime_t delta = now - m_lastTime;
+    if ( delta ) {
+        for ( auto& flow : m_flows ) {
+            flow.remaining -= flow.rate * delta;
+            if ( flow.remaining < 0 ) {
+                flow.remaining = 0;
+            }
+        }
+    }
+    m_lastTime = now;
+}
+
+// bumping the generation discards any update that is already scheduled
+void FlowModel::schedule( SimTime_t now, SimTime_t delay )
+{
+    m_updatePending = true;
+    m_updateTime = now + delay;
+    m_timerOwner->scheduleUpdate( delay, ++m_generation );
+}
+
+// progressive filling, the link that gives its flows the smallest fair share is the
+// bottleneck for all of its unassigned flows, assign them and remove their share from
+// the rest of their route
+void FlowModel::assignRates()
+{
+    for ( auto link : m_touched ) {
+        m_linkCount[link] = 0;
+        m_linkFlows[link].clear();
+    }
+    m_touched.clear();
+
+    for ( size_t i = 0; i < m_flows.size(); i++ ) {
+        m_flows[i].rate = -1;
+        for ( auto link : m_flows[i].route ) {
+            if ( 0 == m_linkCount[link] ) {
+                m_touched.push_back( link );
+                m_linkFree[link] = m_linkCap[link];
+            }
+            ++m_linkCount[link];
+            m_linkFlows[link].push_back( i );
+        }
+    }
+
+    typedef std::pair< double, std::pair<uint32_t,uint32_t> > Share;
+    std::priority_queue< Share, std::vector<Share>, std::greater<Share> > heap;
+
+    for ( auto link : m_touched ) {
+        heap.push( Share( m_linkFree[link] / m_linkCount[link], std::make_pair( link, ++m_linkVersion[link] ) ) );
+    }
+
+    while ( ! heap.empty() ) {
+        double share = heap.top().first;
+        uint32_t link = heap.top().second.first;
+        uint32_t version = heap.top().second.second;
+        heap.pop();
+
+        if ( version != m_linkVersion[link] || 0 == m_linkCount[link] ) {
+            continue;
+        }
+
+        for ( auto i : m_linkFlows[link] ) {
+            Flow& flow = m_flows[i];
+            if ( flow.rate >= 0 ) {
+                continue;
+            }
+            flow.rate = share;
+            for ( auto other : flow.route ) {
+                m_linkFree[other] -= share;
+                if ( m_linkFree[other] < 0 ) {
+                    m_linkFree[other] = 0;
+                }
+                if ( --m_linkCount[other] && other != link ) {
+                    heap.push( Share( m_linkFree[other] / m_linkCount[other], std::make_pair( other, ++m_linkVersion[other] ) ) );
+                }
+            }
+        }
+    }
+}
+
+FlowLinkControl::FlowLinkControl( ComponentId_t id, Params& params, int vns ) :
+    SimpleNetwork( id ),
+    m_inputQ( vns ),
+    m_receiveFunctor( nullptr ),
+    m_sendFunctor( nullptr )
+{
+    m_dbg.init( "@t:FlowLinkControl::@p():@l ", params.find<uint32_t>( "verbose", 0 ), 0, Output::STDOUT );
+
+    // the model is shared by the endpoints without locking
+    if ( getNumRanks().rank > 1 || getNumRanks().thread > 1 ) {
+        m_dbg.fatal( CALL_INFO, -1, "Error: flowLinkControl only supports serial simulations\n" );
+    }
+
+    m_id = params.find<int>( "id", -1 );
+
+    m_linkBW = params.find<UnitAlgebra>( "link_bw" );
+    if ( ! m_linkBW.hasUnits( "B/s" ) && ! m_linkBW.hasUnits( "b/s" ) ) {
+        m_dbg.fatal( CALL_INFO, -1, "Error: link_bw must be specified in either B/s or b/s (SI prefix also allowed)\n" );
+    }
+    if ( m_linkBW.hasUnits( "B/s" ) ) {
+        m_linkBW *= UnitAlgebra( "8b/B" );
+    }
+
+    m_selfLink = configureSelfLink( "FlowLinkControl", getCoreTimeBase().toString(),
+            new Event::Handler2<FlowLinkControl,&FlowLinkControl::handleSelfEvent>( this ) );
+
+    if ( nullptr == s_model ) {
+        UnitAlgebra linkLat = params.find<UnitAlgebra>( "link_lat", "20ns" );
+        double bitsPerCycle = ( m_linkBW * getCoreTimeBase() ).getDoubleValue();
+        SimTime_t hopLatency = ( linkLat / getCoreTimeBase() ).getRoundedValue();
+        s_model = new FlowModel( params, bitsPerCycle, hopLatency );
+    }
+    s_model->addEndpoint( m_id, this );
+}
+
+FlowLinkControl::~FlowLinkControl()
+{
+    if ( s_model && s_model->removeEndpoint( m_id ) ) {
+        delete s_model;
+        s_model = nullptr;
+    }
+}
+
+void FlowLinkControl::finish()
+{
+    if ( s_model && s_model->getEndpoint( 0 ) == this ) {
+        m_dbg.verbose( CALL_INFO, 1, 0, "%" PRIu64 " flows\n", s_model->numFlows() );
+    }
+}
+
+bool FlowLinkControl::send( Request* req, int vn )
+{
+    req->vn = vn;
+    s_model->startFlow( getCurrentSimCycle(), req );
+    return true;
+}
+
+SimpleNetwork::Request* FlowLinkControl::recv( int vn )
+{
+    if ( m_inputQ[vn].empty() ) {
+        return nullptr;
+    }
+    Request* req = m_inputQ[vn].front();
+    m_inputQ[vn].pop();
+    return req;
+}
+
+void FlowLinkControl::sendUntimedData( Request* req )
+{
+    if ( req->dest == UNTIMED_BROADCAST_ADDR ) {
+        for ( int i = 0; i < s_model->numEndpoints(); i++ ) {
+            FlowLinkControl* ep = s_model->getEndpoint( i );
+            if ( ep && ep != this ) {
+                ep->pushUntimed( req->clone() );
+            }
+        }
+        delete req;
+    } else {
+        FlowLinkControl* ep = s_model->getEndpoint( req->dest );
+        if ( nullptr == ep ) {
+            m_dbg.fatal( CALL_INFO, -1, "Error: untimed data for unknown endpoint %" PRIu64 "\n", (uint64_t) req->dest );
+        }
+        ep->pushUntimed( req );
+    }
+}
+
+SimpleNetwork::Request* FlowLinkControl::recvUntimedData()
+{
+    if ( m_untimedQ.empty() ) {
+        return nullptr;
+    }
+    Request* req = m_untimedQ.front();
+    m_untimedQ.pop();
+    return req;
+}
+
+void FlowLinkControl::handleSelfEvent( Event* ev )
+{
+    FlowEvent* event = static_cast<FlowEvent*>( ev );
+
+    if ( event->req ) {
+        int vn = event->req->vn;
+        m_inputQ[vn].push( event->req );
+        if ( m_receiveFunctor ) {
+            if ( ! (*m_receiveFunctor)( vn ) ) {
+                m_receiveFunctor = nullptr;
+            }
+        }
+    } else {
+        s_model->update( getCurrentSimCycle(), event->generation );
+    }
+    delete ev;
+}
@@ -0,0 +1,178 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_FLOWNETWORK_H
+#define COMPONENTS_FIREFLY_FLOWNETWORK_H
+
+#include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/core/output.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <queue>
+#include <vector>
+
+namespace SST {
+namespace Firefly {
+
+class FlowLinkControl;
+
+class FlowEvent : public Event {
+  public:
+    // a request arriving at its destination
+    FlowEvent( Interfaces::SimpleNetwork::Request* req ) : Event(), req(req), generation(0) {}
+    // time to update the flow rates
+    FlowEvent( uint64_t generation ) : Event(), req(nullptr), generation(generation) {}
+
+    Interfaces::SimpleNetwork::Request* req;
+    uint64_t generation;
+
+    NotSerializable(FlowEvent)
+};
+
+// Every packet handed to a FlowLinkControl becomes a flow along the route the packet
+// would take through the routers. Link bandwidth is shared max-min fairly between the
+// flows crossing it and the rates are only recomputed when flows start or finish.
+// One instance is shared by all of the FlowLinkControls in the simulation, it is
+// configured from the parameters of the first one.
+class FlowModel {
+  public:
+    // bitsPerCycle is the link bandwidth and hopLatency the per link latency, both in core time base cycles
+    FlowModel( Params& params, double bitsPerCycle, SimTime_t hopLatency );
+
+    void addEndpoint( int id, FlowLinkControl* );
+    // returns true once the last endpoint is gone
+    bool removeEndpoint( int id );
+    FlowLinkControl* getEndpoint( int id ) { return id < (int) m_endpoints.size() ? m_endpoints[id] : nullptr; }
+    int numEndpoints() { return m_endpoints.size(); }
+
+    void startFlow( SimTime_t now, Interfaces::SimpleNetwork::Request* req );
+    void update( SimTime_t now, uint64_t generation );
+
+    uint64_t numFlows() { return m_numFlows; }
+
+  private:
+    struct Flow {
+        Interfaces::SimpleNetwork::Request* req;
+        std::vector<uint32_t> route;
+        double remaining;   // bits
+        double rate;        // bits per cycle, negative while being assigned
+    };
+
+    void advance( SimTime_t now );
+    void assignRates();
+    void schedule( SimTime_t now, SimTime_t delay );
+    void calcRoute( int src, int dest, std::vector<uint32_t>& route );
+    uint32_t rtrLink( int rtr, int dim, int dir ) { return ( rtr * m_dims.size() + dim ) * 2 + dir; }
+    uint32_t injectLink( int node ) { return m_numRouters * m_dims.size() * 2 + node; }
+    uint32_t ejectLink( int node ) { return injectLink( m_numNodes ) + node; }
+
+    Output m_out;
+
+    std::vector<FlowLinkControl*> m_endpoints;
+    FlowLinkControl* m_timerOwner;
+
+    std::vector<int> m_dims;     // empty for a crossbar
+    std::vector<int> m_widths;
+    int m_localPorts;
+    int m_numRouters;
+    int m_numNodes;
+    SimTime_t m_hopLatency;
+
+    std::vector<Flow> m_flows;
+    SimTime_t m_lastTime;
+    uint64_t m_generation;
+    bool m_updatePending;
+    SimTime_t m_updateTime;     // cycle of the pending update
+    uint64_t m_numFlows;
+
+    // per link state, indexed by link number, only valid for m_touched links
+    std::vector<double>   m_linkCap;
+    std::vector<double>   m_linkFree;
+    std::vector<int>      m_linkCount;
+    std::vector<uint32_t> m_linkVersion;
+    std::vector< std::vector<int> > m_linkFlows;
+    std::vector<uint32_t> m_touched;
+};
+
+class FlowLinkControl : public Interfaces::SimpleNetwork {
+  public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        FlowLinkControl,
+        "firefly",
+        "flowLinkControl",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Flow level network, replaces merlin.linkcontrol and the routers for fast large message studies",
+        SST::Interfaces::SimpleNetwork
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",          "Endpoint id, the same as the merlin nid", "-1"},
+        {"link_bw",     "Bandwidth of every link specified in either b/s or B/s (can include SI prefix)", "" },
+        {"link_lat",    "Latency of every link a flow crosses, including injection and ejection", "20ns"},
+        {"topology",    "torus or crossbar, a crossbar only models the injection and ejection links", "crossbar"},
+        {"shape",       "Torus shape, e.g. 4x4x4", ""},
+        {"width",       "Number of links between neighboring routers in each dimension, e.g. 1x1x1", ""},
+        {"local_ports", "Number of endpoints per router, for a crossbar the total number of endpoints", "1"},
+        {"verbose",     "Output verbosity, 1 prints the number of flows at the end", "0"},
+    )
+
+    FlowLinkControl( ComponentId_t id, Params& params, int vns );
+    ~FlowLinkControl();
+
+    void init( unsigned int phase ) {}
+    void setup() {}
+    void finish();
+
+    bool send( Request* req, int vn );
+    bool spaceToSend( int vn, int num_bits ) { return true; }
+    Request* recv( int vn );
+    bool requestToReceive( int vn ) { return ! m_inputQ[vn].empty(); }
+
+    void sendUntimedData( Request* req );
+    Request* recvUntimedData();
+
+    void setNotifyOnReceive( HandlerBase* functor ) { m_receiveFunctor = functor; }
+    void setNotifyOnSend( HandlerBase* functor ) { m_sendFunctor = functor; }
+
+    bool isNetworkInitialized() const { return true; }
+    nid_t getEndpointID() const { return m_id; }
+    const UnitAlgebra& getLinkBW() const { return m_linkBW; }
+
+    // called by the FlowModel
+    void deliver( SimTime_t delay, Request* req ) { m_selfLink->send( delay, new FlowEvent( req ) ); }
+    void scheduleUpdate( SimTime_t delay, uint64_t generation ) { m_selfLink->send( delay, new FlowEvent( generation ) ); }
+    void pushUntimed( Request* req ) { m_untimedQ.push( req ); }
+
+  private:
+    void handleSelfEvent( Event* );
+
+    static FlowModel* s_model;
+
+    Output m_dbg;
+    nid_t m_id;
+    UnitAlgebra m_linkBW;
+    Link* m_selfLink;
+
+    std::vector< std::queue<Request*> > m_inputQ;
+    std::queue<Request*> m_untimedQ;
+
+    HandlerBase* m_receiveFunctor;
+    HandlerBase* m_sendFunctor;
+};
+
+}
+}
+
+#endif
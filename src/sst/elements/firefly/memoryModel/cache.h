@@ -13,52 +13,188 @@
 // information, see the LICENSE file in the top level directory of the
 // distribution.
 
-#include "cacheList.h"
-
+// Fully associative LRU tag array. The tags live in one flat array of slots linked
+// in age order by index, with an open addressing index from address to slot, so a
+// lookup is a couple of probes and nothing is allocated after construction.
 class Cache {
+    enum { Null = -1 };
   public:
-    Cache( int cacheSize ) : m_cacheSize( cacheSize ) {
+    Cache( int cacheSize ) : m_cacheSize( cacheSize ), m_size(0), m_numDups(0),
+        m_addr( cacheSize ), m_prev( cacheSize ), m_next( cacheSize )
+    {
+        size_t indexSize = 2;
+        while ( indexSize < (size_t) cacheSize * 2 ) {
+            indexSize *= 2;
+        }
+        m_index.resize( indexSize );
+        m_indexShift = 64;
+        for ( size_t i = indexSize; i > 1; i /= 2 ) {
+            --m_indexShift;
+        }
+        flush();
         for ( int i = 0; i < cacheSize; i++ ){
             insert( -1 );
         }
     }
 
     void flush() {
-        m_addrMap.clear();
-        m_ageList.clear();
+        m_index.assign( m_index.size(), (int) Null );
+        m_head = m_tail = Null;
+        m_free = Null;
+        for ( int i = m_cacheSize - 1; i >= 0; i-- ) {
+            m_next[i] = m_free;
+            m_free = i;
+        }
+        m_size = 0;
+        m_numDups = 0;
     }
 
     bool isValid( Hermes::Vaddr addr ) {
-        return m_addrMap.find(addr) != m_addrMap.end();
+        return Null != findSlot( addr );
     }
 
     void updateAge( Hermes::Vaddr addr ) {
-        m_ageList.move_to_back( m_addrMap.find(addr)->second );
-        m_addrMap.find( addr )->second = m_ageList.end();
+        int slot = findSlot( addr );
+        unlink( slot );
+        pushBack( slot );
     }
 
     Hermes::Vaddr evict() {
-        Hermes::Vaddr addr = m_ageList.get_front_value();
-        //printf("%s(%p) return %lx %lu\n", __func__, this, addr, m_addrMap.size());
-
-        m_addrMap.erase( m_addrMap.find(addr) );
+        int slot = m_head;
+        Hermes::Vaddr addr = m_addr[slot];
 
-        m_ageList.pop_front();
-        //printf("%s(%p) return %lx %lu\n", __func__, this, addr, m_addrMap.size());
+        unlink( slot );
+        if ( addr != - 1 ) {
+            removeIndex( slot );
+        }
+        m_next[slot] = m_free;
+        m_free = slot;
+        --m_size;
         return addr;
     }
 
     void insert( Hermes::Vaddr addr ) {
-        //printf("%s(%p) %lx %lu\n", __func__, this, addr, m_addrMap.size());
         if ( addr != - 1 ) {
-            assert( m_addrMap.find(addr) == m_addrMap.end() );
+            assert( Null == findSlot( addr ) );
+        }
+        assert( m_size < m_cacheSize );
+
+        int slot = m_free;
+        m_free = m_next[slot];
+        m_addr[slot] = addr;
+        pushBack( slot );
+        ++m_size;
+
+        if ( addr != - 1 ) {
+            addIndex( slot );
         }
-        assert( m_addrMap.size() < m_cacheSize );
-        m_ageList.push_back( addr );
-        m_addrMap.insert( std::make_pair(addr, m_ageList.end() ) );
     }
+
   private:
+
+    size_t hash( Hermes::Vaddr addr ) {
+        return ( addr * 0x9E3779B97F4A7C15ULL ) >> m_indexShift;
+    }
+
+    int findSlot( Hermes::Vaddr addr ) {
+        size_t mask = m_index.size() - 1;
+        for ( size_t pos = hash( addr ); ; pos = ( pos + 1 ) & mask ) {
+            int slot = m_index[pos];
+            if ( Null == slot || m_addr[slot] == addr ) {
+                return slot;
+            }
+        }
+    }
+
+    void addIndex( int slot ) {
+        size_t mask = m_index.size() - 1;
+        size_t pos = hash( m_addr[slot] );
+        while ( Null != m_index[pos] ) {
+            if ( m_addr[ m_index[pos] ] == m_addr[slot] ) {
+                // only possible if asserts are off, the newest copy is the one found
+                ++m_numDups;
+                m_index[pos] = slot;
+                return;
+            }
+            pos = ( pos + 1 ) & mask;
+        }
+        m_index[pos] = slot;
+    }
+
+    // linear probing delete, shift later entries of the cluster back into the hole
+    void removeIndex( int slot ) {
+        size_t mask = m_index.size() - 1;
+        size_t pos = hash( m_addr[slot] );
+        while ( m_index[pos] != slot ) {
+            if ( m_addr[ m_index[pos] ] == m_addr[slot] ) {
+                // an older duplicate, the index points at a newer copy
+                --m_numDups;
+                return;
+            }
+            pos = ( pos + 1 ) & mask;
+        }
+
+        if ( m_numDups && replaceDup( slot, pos ) ) {
+            return;
+        }
+
+        size_t hole = pos;
+        for ( pos = ( pos + 1 ) & mask; Null != m_index[pos]; pos = ( pos + 1 ) & mask ) {
+            size_t home = hash( m_addr[ m_index[pos] ] );
+            if ( ( ( pos - home ) & mask ) >= ( ( pos - hole ) & mask ) ) {
+                m_index[hole] = m_index[pos];
+                hole = pos;
+            }
+        }
+        m_index[hole] = Null;
+    }
+
+    // point the index at another copy of the address if there is one
+    bool replaceDup( int slot, size_t pos ) {
+        for ( int i = m_head; Null != i; i = m_next[i] ) {
+            if ( i != slot && m_addr[i] == m_addr[slot] ) {
+                m_index[pos] = i;
+                --m_numDups;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void unlink( int slot ) {
+        if ( Null != m_prev[slot] ) {
+            m_next[ m_prev[slot] ] = m_next[slot];
+        } else {
+            m_head = m_next[slot];
+        }
+        if ( Null != m_next[slot] ) {
+            m_prev[ m_next[slot] ] = m_prev[slot];
+        } else {
+            m_tail = m_prev[slot];
+        }
+    }
+
+    void pushBack( int slot ) {
+        m_prev[slot] = m_tail;
+        m_next[slot] = Null;
+        if ( Null != m_tail ) {
+            m_next[m_tail] = slot;
+        } else {
+            m_head = slot;
+        }
+        m_tail = slot;
+    }
+
     int m_cacheSize;
-    List<Hermes::Vaddr> m_ageList;
-    std::unordered_multimap<Hermes::Vaddr, List<Hermes::Vaddr>::Entry > m_addrMap;
+    int m_size;
+    int m_numDups;
+    int m_head;
+    int m_tail;
+    int m_free;
+    int m_indexShift;
+
+    std::vector<Hermes::Vaddr> m_addr;
+    std::vector<int> m_prev;
+    std::vector<int> m_next;
+    std::vector<int> m_index;
 };
@@ -17,13 +17,44 @@
 #ifndef COMPONENTS_FIREFLY_SIMPLE_MEMORY_MODEL_MEM_REQ_H
 #define COMPONENTS_FIREFLY_SIMPLE_MEMORY_MODEL_MEM_REQ_H
 
+#include <new>
+#include <vector>
+
 struct MemReq {
     MemReq( Hermes::Vaddr addr, size_t length, int pid = -1) :
         addr(addr), length(length), pid(pid) {}
 
+    // every cache line and bus transfer allocates one, recycle them
+    static void* operator new( size_t size ) {
+        auto& pool = freeList();
+        if ( size != sizeof(MemReq) || pool.empty() ) {
+            return ::operator new( size );
+        }
+        void* ptr = pool.back();
+        pool.pop_back();
+        return ptr;
+    }
+
+    static void operator delete( void* ptr, size_t size ) {
+        auto& pool = freeList();
+        if ( size != sizeof(MemReq) || pool.size() >= maxFree ) {
+            ::operator delete( ptr );
+        } else {
+            pool.push_back( ptr );
+        }
+    }
+
 	Hermes::Vaddr addr;
 	size_t length;
     int     pid;
+
+  private:
+    static const size_t maxFree = 4096;
+
+    static std::vector<void*>& freeList() {
+        static thread_local std::vector<void*> pool;
+        return pool;
+    }
 };
 
 #endif
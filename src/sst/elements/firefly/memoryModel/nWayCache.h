@@ -13,15 +13,17 @@
 // information, see the LICENSE file in the top level directory of the
 // distribution.
 
+// Set associative LRU tag array, the ways of all of the sets are in one flat array
+// and each way keeps the time it was last touched instead of a per set list.
 class NWayCache {
 public:
-    NWayCache( int assoc, uint32_t nSets, int pageSize ) : m_pageShift(0), m_setShift(0), m_setMask( nSets-1 ) {
-        //printf("%s():%d assoc=%d nSets=%d pageSize=%d setMask=%#lx\n",__func__,__LINE__,assoc, nSets, pageSize,m_setMask);
-        for ( unsigned i = 0; i < nSets; i++ ) {
-            m_sets.push_back( new Cache( assoc ) );
-            m_stats.push_back( std::make_pair(0,0) );
+    NWayCache( int assoc, uint32_t nSets, int pageSize ) : m_assoc(assoc), m_pageShift(0), m_setShift(0), m_setMask( nSets-1 ),
+        m_tags( assoc * nSets, -1 ), m_ages( assoc * nSets ), m_stats( nSets, std::make_pair(0,0) ), m_clock(0)
+    {
+        // the ways start out invalid, oldest first
+        for ( size_t i = 0; i < m_ages.size(); i++ ) {
+            m_ages[i] = ++m_clock;
         }
-        //printf("%s():%d %#x\n",__func__,__LINE__,pageSize);
 
         m_pageShift = calcPow( pageSize );
         m_setShift = calcPow( nSets );
@@ -31,10 +33,8 @@ public:
 
     bool isValid( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        printf("%s():%d %#" PRIx64 " set=%#x tag=%#" PRIx64 "  \n",__func__,__LINE__,addr, set, tag );
         ++m_stats[set].first;
-        bool rc = m_sets[set]->isValid( addr );
+        bool rc = findWay( set, addr ) >= 0;
         if ( rc ) {
             ++m_stats[set].second;
         }
@@ -43,20 +43,34 @@ public:
 
     void updateAge( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        m_sets[set]->updateAge( addr );
+        m_ages[ findWay( set, addr ) ] = ++m_clock;
     }
 
     Hermes::Vaddr evict( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        return m_sets[set]->evict( );
+        size_t way = set * m_assoc;
+        for ( size_t i = way + 1; i < (size_t) ( set + 1 ) * m_assoc; i++ ) {
+            if ( m_ages[i] < m_ages[way] ) {
+                way = i;
+            }
+        }
+        Hermes::Vaddr evicted = m_tags[way];
+        m_tags[way] = -1;
+        m_ages[way] = 0;
+        return evicted;
     }
 
     void insert( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        m_sets[set]->insert( addr );
+        assert( findWay( set, addr ) < 0 );
+        for ( size_t i = set * m_assoc; i < (size_t) ( set + 1 ) * m_assoc; i++ ) {
+            if ( 0 == m_ages[i] ) {
+                m_tags[i] = addr;
+                m_ages[i] = ++m_clock;
+                return;
+            }
+        }
+        assert(0);
     }
 
     void printStats( Output& output ) {
@@ -68,11 +82,23 @@ public:
     }
 
 private:
-    uint64_t m_setMask;
+    int m_assoc;
     int m_pageShift;
     int m_setShift;
-    std::vector<Cache*> m_sets;
+    uint64_t m_setMask;
+    std::vector<Hermes::Vaddr> m_tags;
+    std::vector<uint64_t> m_ages;   // 0 is an empty way
     std::vector<std::pair<uint64_t,uint64_t> > m_stats;
+    uint64_t m_clock;
+
+    int findWay( int set, Hermes::Vaddr addr ) {
+        for ( size_t i = set * m_assoc; i < (size_t) ( set + 1 ) * m_assoc; i++ ) {
+            if ( m_ages[i] && m_tags[i] == addr ) {
+                return i;
+            }
+        }
+        return -1;
+    }
 
     int calcPow( double val ) {
         int x = 0;
@@ -89,10 +115,4 @@ private:
         //printf("%s():%d %#lx set=%#lx\n",__func__,__LINE__,addr,set);
         return set;
     }
-
-    uint64_t addrToTag( Hermes::Vaddr addr ) {
-        int tag = (addr >> (m_pageShift + m_setShift));
-        //printf("%s():%d %#lx tag=%#lx\n",__func__,__LINE__,addr,tag);
-        return tag;
-    }
 };
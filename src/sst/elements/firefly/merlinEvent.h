@@ -19,6 +19,9 @@
 
 #include <sst/core/interfaces/simpleNetwork.h>
 
+#include <utility>
+#include <vector>
+
 #define NUM_NODE_BITS     20
 #define NUM_PID_BITS      12
 #define NUM_STREAM_ID_BITS 20
@@ -26,19 +29,53 @@
 namespace SST {
 namespace Firefly {
 
+// Per thread free list of packet payload buffers. Buffers keep their capacity
+// so a steady stream of packets stops hitting the allocator.
+class PktBufPool {
+  public:
+    static void get( std::vector<unsigned char>& buf, size_t reserve ) {
+        auto& pool = freeList();
+        if ( ! pool.empty() ) {
+            buf.swap( pool.back() );
+            pool.pop_back();
+        }
+        // large flow level packets grow on demand rather than up front
+        buf.reserve( reserve < maxReserve ? reserve : maxReserve );
+    }
+
+    static void put( std::vector<unsigned char>& buf ) {
+        auto& pool = freeList();
+        if ( buf.capacity() && pool.size() < maxFree ) {
+            buf.clear();
+            pool.push_back( std::move(buf) );
+        }
+    }
+
+  private:
+    static const size_t maxFree = 4096;
+    static const size_t maxReserve = 64 * 1024;
+
+    static std::vector< std::vector<unsigned char> >& freeList() {
+        static thread_local std::vector< std::vector<unsigned char> > pool;
+        return pool;
+    }
+};
+
 class FireflyNetworkEvent : public Event {
 
   public:
 
-    FireflyNetworkEvent( ) : offset(0), bufLen(0), m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(0) {
-        buf.reserve( 1000 );
-        assert( 0 == buf.size() );
+    FireflyNetworkEvent( ) : offset(0), bufLen(0), m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(0), bufReserve(1000) {
     }
 
+    // reserve is the buffer size taken from the pool when data is first appended,
+    // a packet that only carries lengths never gets a buffer
     FireflyNetworkEvent( int pktOverhead, size_t reserve = 1000 ) : offset(0), bufLen(0),
-            m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(pktOverhead) {
-        buf.reserve( reserve );
-        assert( 0 == buf.size() );
+            m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(pktOverhead), bufReserve(reserve) {
+    }
+
+    ~FireflyNetworkEvent() {
+        PktBufPool::put( buf );
     }
 
     void setCtrl() { m_isCtrl = true; }
@@ -96,6 +133,9 @@ class FireflyNetworkEvent : public Event {
 
     void bufAppend( const void* ptr , size_t len ) {
         if ( ptr ) {
+            if ( 0 == buf.capacity() ) {
+                PktBufPool::get( buf, bufReserve > bufLen + len ? bufReserve : bufLen + len );
+            }
             buf.resize( bufLen + len);
             memcpy( &buf[bufLen], (const char*) ptr, len );
         }
@@ -115,7 +155,9 @@ class FireflyNetworkEvent : public Event {
         m_isTail = me->m_isTail;
         m_isCtrl = me->m_isCtrl;
         offset = me->offset;
+        bufLen = me->bufLen;
         pktOverhead = me->pktOverhead;
+        bufReserve = me->bufReserve;
     }
 
     FireflyNetworkEvent(const FireflyNetworkEvent &me) :
@@ -131,7 +173,9 @@ class FireflyNetworkEvent : public Event {
         m_isTail = me.m_isTail;
         m_isCtrl = me.m_isCtrl;
         offset = me.offset;
+        bufLen = me.bufLen;
         pktOverhead = me.pktOverhead;
+        bufReserve = me.bufReserve;
     }
 
     virtual Event* clone(void) override
@@ -161,6 +205,7 @@ class FireflyNetworkEvent : public Event {
     bool            m_isTail;
     bool            m_isCtrl;
     int             pktOverhead;
+    size_t          bufReserve;
 
     size_t          offset;
     size_t          bufLen;
@@ -178,6 +223,7 @@ class FireflyNetworkEvent : public Event {
         SST_SER(srcStream);
         SST_SER(destPid);
         SST_SER(pktOverhead);
+        SST_SER(bufReserve);
         SST_SER(m_isHdr);
         SST_SER(m_isTail);
         SST_SER(m_isCtrl);
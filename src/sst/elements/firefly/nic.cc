@@ -32,6 +32,7 @@ int Nic::MaxPayload = (int)((1L<<32) - 1);
 int Nic::m_packetId = 0;
 int Nic::ShmemSendMove::m_alignment = 64;
 int Nic::EntryBase::m_alignment = 1;
+bool Nic::EntryBase::m_payloadFree = false;
 
 // added by ziyue.zhang@ugent.be: trying to measure inter-NIC traffic pattern
 std::string Nic::m_interNIC_traffic_tracefile_path = "";
@@ -116,6 +117,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
     if ( Nic::EntryBase::m_alignment == 0 ) {
         m_dbg.fatal(CALL_INFO,-1,"Error:  messageSendAlignment must be greater than 0 \n");
     }
+    Nic::EntryBase::m_payloadFree = params.find<bool>("payloadFree",false);
     int numSendMachines = params.find<int>( "numSendMachines",1);
     if ( numSendMachines < 1 ) {
         m_dbg.fatal(CALL_INFO,-1,"Error: numSendMachines must be greater than 1, requested %d\n",numSendMachines);
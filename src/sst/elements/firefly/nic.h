@@ -103,6 +103,7 @@ public:
         { "maxRecvMachineQsize", "Sets the number of pending memory operations", "1"},
         { "shmemSendAlignment", "Sets the send stream transfer alignment", "64"},
         { "messageSendAlignment", "Sets the message alignment","1"},
+        { "payloadFree", "Message packets carry only their length, not the data. For timing only runs","false"},
         { "numSendMachines", "Sets the number of send machines", "1"},
         { "numRecvNicUnits", "Sets the number of receive units", "1"},
         { "nicAllocationPolicy", "Allocation policy for Nic", "RoundRobin"},
@@ -333,6 +334,7 @@ private:
     #include "nicSendEntry.h"
     #include "nicShmemSendEntry.h"
     #include "nicRecvEntry.h"
+    #include "nicPostedRecvQ.h"
     #include "nicSendMachine.h"
     #include "nicRecvMachine.h"
     #include "nicArbitrateDMA.h"
@@ -341,7 +343,7 @@ private:
     struct  RecvCtxData {
         std::unordered_map< int, DmaRecvEntry* >   m_getOrgnM;
         std::unordered_map< int, MemRgnEntry* >    m_memRgnM;
-        std::deque<DmaRecvEntry*>        m_postedRecvs;
+        PostedRecvQ                      m_postedRecvs;
     };
 
 public:
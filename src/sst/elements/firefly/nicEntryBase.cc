@@ -115,7 +115,7 @@ void Nic::EntryBase::copyOut( Output& dbg, int numBytes,
 
             vec.push_back( MemOp( ioVec()[currentVec()].addr.getSimVAddr() + currentPos(), len, MemOp::Op::BusDmaFromHost ) );
 
-            if ( ioVec()[currentVec()].addr.getBacking()) {
+            if ( ioVec()[currentVec()].addr.getBacking() && ! m_payloadFree ) {
                 print( dbg, from, len );
                 event.bufAppend( from, len );
             } else {
@@ -37,6 +37,8 @@ class EntryBase {
 
     virtual size_t& currentLen() { return m_currentLen; }
     static  int m_alignment;
+    // only lengths travel in message packets, the data is never copied
+    static  bool m_payloadFree;
   private:
     virtual std::vector<IoVec>& ioVec() = 0;
     virtual size_t& currentVec() { return m_currentVec; }
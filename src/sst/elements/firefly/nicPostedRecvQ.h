@@ -0,0 +1,64 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Posted receives indexed by tag and source node. A message matches the oldest
+// posted receive with its tag whose node is either its source or -1, which is
+// the head of one of two queues, so matching does not depend on how many
+// receives are posted.
+class PostedRecvQ {
+    typedef std::pair< uint64_t, DmaRecvEntry* > Posted;
+    typedef std::deque< Posted > Queue;
+    typedef uint64_t Key;
+
+    static Key getKey( int tag, int node ) { return (Key) (uint32_t) tag << 32 | (uint32_t) node; }
+
+  public:
+    PostedRecvQ() : m_seq(0), m_size(0) {}
+
+    void push_back( DmaRecvEntry* entry ) {
+        m_queues[ getKey( entry->tag(), entry->node() ) ].push_back( Posted( m_seq++, entry ) );
+        ++m_size;
+    }
+
+    // removes and returns the oldest receive that matches, NULL if there is none
+    DmaRecvEntry* match( int tag, int srcNode ) {
+        auto specific = m_queues.find( getKey( tag, srcNode ) );
+        auto any = m_queues.find( getKey( tag, -1 ) );
+
+        auto iter = specific;
+        if ( iter == m_queues.end() || ( any != m_queues.end() && any->second.front().first < iter->second.front().first ) ) {
+            iter = any;
+        }
+        if ( iter == m_queues.end() ) {
+            return NULL;
+        }
+
+        DmaRecvEntry* entry = iter->second.front().second;
+        iter->second.pop_front();
+        if ( iter->second.empty() ) {
+            m_queues.erase( iter );
+        }
+        --m_size;
+        return entry;
+    }
+
+    size_t size() { return m_size; }
+    bool empty() { return 0 == m_size; }
+
+  private:
+    uint64_t m_seq;
+    size_t   m_size;
+    std::unordered_map< Key, Queue > m_queues;
+};
@@ -47,33 +47,20 @@ Nic::EntryBase* Nic::RecvMachine::Ctx::findRecv( int srcNode, int srcPid, MsgHdr
     m_dbg.verbosePrefix(prefix(),CALL_INFO,2,NIC_DBG_RECV_CTX,"need a recv entry, srcNic=%d srcPid=%d "
                 "tag=%#x len=%lu\n", srcNode, srcPid, matchHdr.tag, matchHdr.len);
 
-    DmaRecvEntry* entry = NULL;
-
-    auto& q = m_rm.m_nic.m_recvCtxData[m_pid].m_postedRecvs;
-    auto iter = q.begin();
-
-    for ( ; iter != q.end(); ++iter ) {
-        entry = (*iter);
-        m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_CTX,"check Posted Recv with tag=%#x node=%d\n",entry->tag(),entry->node());
-
-        if ( matchHdr.tag != entry->tag() ) {
-            continue;
-        }
-        if ( -1 != entry->node() && srcNode != entry->node() ) {
-            continue;
-        }
-        if ( entry->totalBytes() < matchHdr.len ) {
-            assert(0);
-        }
+    DmaRecvEntry* entry = m_rm.m_nic.m_recvCtxData[m_pid].m_postedRecvs.match( matchHdr.tag, srcNode );
 
-        m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_CTX,"found recv entry, size %lu\n",entry->totalBytes());
+    if ( NULL == entry ) {
+        m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_CTX,"no match\n");
+        return NULL;
+    }
 
-        q.erase(iter);
-        return entry;
+    if ( entry->totalBytes() < matchHdr.len ) {
+        assert(0);
     }
-    m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_CTX,"no match\n");
 
-    return NULL;
+    m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_CTX,"found recv entry, size %lu\n",entry->totalBytes());
+
+    return entry;
 }
 
 Nic::SendEntryBase* Nic::RecvMachine::Ctx::findGet( int srcNode, int srcPid, RdmaMsgHdr& rdmaHdr  )
@@ -20,7 +20,7 @@
 using namespace SST;
 using namespace SST::Firefly;
 
-void Nic::RecvMachine::processPkt( FireflyNetworkEvent* ev ) {
+void Nic::RecvMachine::processPkt( FireflyNetworkEvent* ev, PktBufSlot& slot ) {
 
 	m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE," got a network pkt from node=%d pid=%d for pid=%d stream=%d size=%zu\n",
                         ev->getSrcNode(),ev->getSrcPid(), ev->getDestPid(), ev->getSrcStream(), ev->bufSize() );
@@ -29,11 +29,11 @@ void Nic::RecvMachine::processPkt( FireflyNetworkEvent* ev ) {
 		m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE,"got a control message\n");
 		m_ctxMap[ ev->getDestPid() ]->newStream( ev );
     } else {
-        processStdPkt( ev );
+        processStdPkt( ev, slot );
     }
 }
 
-void Nic::RecvMachine::processStdPkt( FireflyNetworkEvent* ev ) {
+void Nic::RecvMachine::processStdPkt( FireflyNetworkEvent* ev, PktBufSlot& slot ) {
     bool blocked = false;
     StreamKey id = getStreamKey( ev );
 
@@ -52,16 +52,20 @@ void Nic::RecvMachine::processStdPkt( FireflyNetworkEvent* ev ) {
         if ( ! ev->isTail() ) {
             m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE,"multi packet stream, set streamMap PPI=0x%" PRIx64 "\n",id );
             m_streamMap[id] = stream;
+            slot.stream = stream;
+            slot.key = id;
         }
 
     } else {
-        assert ( m_streamMap.find( id ) != m_streamMap.end() );
+        // the clock handler found the stream before handing us the packet
+        assert ( slot.stream && slot.key == id );
 
-        stream = m_streamMap[id];
+        stream = slot.stream;
 
         if ( ev->isTail() ) {
             m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE,"tail pkt, clear streamMap PPI=0x%" PRIx64 "\n",id );
             m_streamMap.erase(id);
+            slot.stream = NULL;
         } else {
             m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE,"body packet stream=%p\n",stream );
         }
@@ -45,6 +45,15 @@ class RecvMachine {
     #include "nicRdmaStream.h"
     #include "nicShmemStream.h"
 
+    // packets from one process pair waiting their turn, plus the stream the pair is
+    // currently reassembling so its body packets don't need a m_streamMap lookup
+    struct PktBufSlot {
+        PktBufSlot() : stream(NULL), key(0) {}
+        std::queue<FireflyNetworkEvent*> pkts;
+        StreamBase* stream;
+        StreamKey   key;
+    };
+
       public:
 
 
@@ -102,8 +111,22 @@ class RecvMachine {
         std::vector< Ctx* >   m_ctxMap;
 
 	private:
-        void processPkt( FireflyNetworkEvent* ev );
-        void processStdPkt( FireflyNetworkEvent* ev );
+        void processPkt( FireflyNetworkEvent* ev, PktBufSlot& slot );
+        void processStdPkt( FireflyNetworkEvent* ev, PktBufSlot& slot );
+
+        StreamBase* findStream( PktBufSlot& slot, FireflyNetworkEvent* ev ) {
+            StreamKey key = getStreamKey( ev );
+            if ( slot.stream && slot.key == key ) {
+                return slot.stream;
+            }
+            auto iter = m_streamMap.find( key );
+            if ( iter == m_streamMap.end() ) {
+                return NULL;
+            }
+            slot.stream = iter->second;
+            slot.key = key;
+            return slot.stream;
+        }
 
         void setNotify( ) {
             m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "\n");
@@ -127,7 +150,7 @@ class RecvMachine {
                 if ( ev ) {
                     ++m_numPendingPkts;
                     m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "got packet numPendingPkts=%d\n", m_numPendingPkts );
-                    m_pktBuf[ getPPI(ev) ].push( ev );
+                    m_pktBuf[ getPPI(ev) ].pkts.push( ev );
                 }
             } else {
                 m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "reached max buffered packets, numPendingPkts=%d\n", m_numPendingPkts );
@@ -135,7 +158,8 @@ class RecvMachine {
 
 			auto iter = m_pktBuf.begin();
 			while ( iter != m_pktBuf.end() ) {
-				FireflyNetworkEvent* ev = iter->second.front();
+				PktBufSlot& slot = iter->second;
+				FireflyNetworkEvent* ev = slot.pkts.front();
 
 				m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "packet from node=%d pid=%d for pid=%d %s %s PPI=0x%" PRIx64 " stream=%d\n",
 						ev->getSrcNode(),ev->getSrcPid(),ev->getDestPid(),ev->isHdr() ? "hdr":"",ev->isTail() ? "tail":"",getPPI(ev),ev->getSrcStream());
@@ -143,30 +167,30 @@ class RecvMachine {
 				if ( ev->isCtrl() ) {
 					++m_numActiveStreams;
 					m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "ctrl packet numActiveStreams=%d m_numPendingPkts=%d\n",m_numActiveStreams,m_numPendingPkts-1);
-					processPkt( ev );
+					processPkt( ev, slot );
 					--m_numPendingPkts;
-					iter->second.pop();
-				} else if ( m_streamMap.find( getStreamKey( ev ) ) == m_streamMap.end() ) {
+					slot.pkts.pop();
+				} else if ( NULL == findStream( slot, ev ) ) {
 					if ( m_numActiveStreams < m_maxActiveStreams ) {
 						++m_numActiveStreams;
 						m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "new stream numActiveStreams=%d m_numPendingPkts=%d\n",m_numActiveStreams,m_numPendingPkts-1);
-						processPkt( ev );
+						processPkt( ev, slot );
 						--m_numPendingPkts;
-						iter->second.pop();
+						slot.pkts.pop();
 					} else {
 						m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "can't start new stream numActiveStreams=%d\n",m_numActiveStreams);
 					}
 				} else {
-                    if ( ! m_streamMap[getStreamKey(ev)]->isBlocked( ) ) {
-						processPkt( ev );
+                    if ( ! slot.stream->isBlocked( ) ) {
+						processPkt( ev, slot );
 						--m_numPendingPkts;
 						m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "stream consumed packet, m_numPendingPkts=%d\n",m_numPendingPkts);
-						iter->second.pop();
+						slot.pkts.pop();
 					} else {
 						m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "stream blocked\n");
 					}
 				}
-				if ( iter->second.empty() ) {
+				if ( slot.pkts.empty() ) {
 					m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "queue is empty clear pktBuf slot\n");
 					iter = m_pktBuf.erase( iter );
 				} else {
@@ -233,6 +257,6 @@ class RecvMachine {
         SimTime_t   m_clockLat;
         bool        m_clocking;
 
-        std::unordered_map<ProcessPairId, std::queue<FireflyNetworkEvent*> > m_pktBuf;
+        std::unordered_map<ProcessPairId, PktBufSlot > m_pktBuf;
         std::unordered_map<StreamKey, StreamBase* >  m_streamMap;
 };
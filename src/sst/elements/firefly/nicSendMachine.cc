@@ -34,7 +34,7 @@ void Nic::SendMachine::streamInit( SendEntryBase* entry )
         "%p setup hdr, srcPid=%d, srcSteam=%d destNode=%d dstPid=%d bytes=%lu\n", entry,
         entry->local_vNic(), entry->streamNum(), entry->dest(), entry->dst_vNic(), entry->totalBytes() ) ;
 
-    FireflyNetworkEvent* ev = new FireflyNetworkEvent(m_pktOverhead );
+    FireflyNetworkEvent* ev = new FireflyNetworkEvent(m_pktOverhead, m_packetSizeInBytes );
     ev->setDestPid( entry->dst_vNic() );
     ev->setSrcPid( entry->local_vNic() );
     ev->setSrcStream( entry->streamNum() );
@@ -66,7 +66,7 @@ void Nic::SendMachine::getPayload( SendEntryBase* entry, FireflyNetworkEvent* ev
             m_inQ->enque( m_unit, pid, vec, ev, entry->vn(), entry->dest(), std::bind( &Nic::SendMachine::streamFini, this, entry ) );
         } else {
             m_inQ->enque( m_unit, pid, vec, ev, entry->vn(), entry->dest() );
-            m_nic.schedCallback( std::bind( &Nic::SendMachine::getPayload, this, entry, new FireflyNetworkEvent(m_pktOverhead) ), 0);
+            m_nic.schedCallback( std::bind( &Nic::SendMachine::getPayload, this, entry, new FireflyNetworkEvent(m_pktOverhead, m_packetSizeInBytes) ), 0);
         }
 
     } else {
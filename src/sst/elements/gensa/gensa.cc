@@ -17,6 +17,7 @@
 #include "gensa.h"
 
 #include <fstream>
+#include <mutex>
 
 #include <sst/core/params.h>
 #include <sst/core/rng/marsaglia.h>
@@ -28,6 +29,10 @@ using namespace SST;
 using namespace SST::gensaComponent;
 using namespace std;
 
+// Trace files are claimed process-wide, since cores on different threads must not share an OutputHolder.
+static mutex       outputFilesLock;
+static set<string> outputFiles;
+
 
 gensa::gensa (ComponentId_t id, Params & params)
 :   Component (id)
@@ -45,7 +50,8 @@ gensa::gensa (ComponentId_t id, Params & params)
     // get parameters
     modelPath       = params.find<string>("modelPath",       "model");
     steps           = params.find<int>   ("steps",           1000);
-    Neuron::dt      = params.find<float> ("dt",              1);  // In seconds. Don't bother with UnitAlgebra because this is usually specified by wrapper script.
+    dt              = params.find<float> ("dt",              1);  // In seconds. Don't bother with UnitAlgebra because this is usually specified by wrapper script.
+    outputPrefix    = params.find<string>("outputPrefix",    "");
     maxRequestDepth = params.find<int>   ("maxRequestDepth", 2);
 
     //set our clock
@@ -138,7 +144,8 @@ gensa::init (unsigned int phase)
             float leak = 1 - atof(piece);  // The parameter in the file is the portion of voltage to get rid of each cycle. It's simpler for us to compute with (1-decay).
             piece = strtok(0, ",");  // Actually, there should only be one piece left, with no more commas.
             float p = atof(piece);
-            n = neurons[id] = new NeuronLIF(Vinit, Vthreshold, Vreset, leak, p);
+            lif.set(id, Vinit, Vthreshold, Vreset, leak, p);
+            n = neurons[id] = new NeuronLIF(&lif, id);
         } else {
             n = neurons[id] = new NeuronInput();
         }
@@ -195,10 +202,12 @@ gensa::init (unsigned int phase)
                     col = buffer;
                 }
 
-                map<string,OutputHolder *>::iterator it = Neuron::outputs.find(f);
-                if (it == Neuron::outputs.end()) {
+                if (! f.empty()) f = outputPrefix + f;
+                map<string,OutputHolder *>::iterator it = outputs.find(f);
+                if (it == outputs.end()) {
+                    claimOutput (f);
                     OutputHolder * h = new OutputHolder(f);
-                    it = Neuron::outputs.insert(make_pair(f, h)).first;
+                    it = outputs.insert(make_pair(f, h)).first;
                 }
                 OutputHolder * h = it->second;
 
@@ -224,6 +233,7 @@ gensa::init (unsigned int phase)
     ifs.open (modelPath.c_str());
     assert(sizeof(Synapse) == 8);
     uint64_t startAddr = 0x10000;
+    int maxDelay = 0;
     while (ifs.good()) {
         getline(ifs, line);
         if (line.empty()) break;
@@ -250,6 +260,7 @@ gensa::init (unsigned int phase)
             float weight = atof(piece);
             piece = strtok(0, ",");
             int delay = atoi(piece);
+            if (delay > maxDelay) maxDelay = delay;
 
             if (n->synapseBase == 0)
             {
@@ -270,6 +281,8 @@ gensa::init (unsigned int phase)
     }
 
     int numNeurons = neurons.size ();
+    lif.resize (numNeurons);
+    lif.setMaxDelay (maxDelay);
     printf("Constructed %d neurons with %d links\n", numNeurons, countLinks);
 }
 
@@ -287,12 +300,33 @@ gensa::complete (unsigned int phase)
 	link->complete (phase);
 }
 
+void
+gensa::claimOutput (const string & fileName)
+{
+    lock_guard<mutex> lock (outputFilesLock);
+    if (! outputFiles.insert (fileName).second) {
+        out.fatal (CALL_INFO, -1, "Trace file \"%s\" is already written by another gensa core; give each core its own outputPrefix\n",
+            fileName.empty () ? "<stdout>" : fileName.c_str ());
+    }
+}
+
+void
+gensa::releaseOutput (const string & fileName)
+{
+    lock_guard<mutex> lock (outputFilesLock);
+    outputFiles.erase (fileName);
+}
+
 void
 gensa::finish ()
 {
 	memory->finish ();
 	link  ->finish ();
-    for (auto i : Neuron::outputs) delete i.second;  // flushes last row
+    for (auto i : outputs) {
+        delete i.second;  // flushes last row
+        releaseOutput (i.first);
+    }
+    outputs.clear ();
 
 	printf ("Completed %d neuron firings\n", numFirings);
     printf ("Completed %d spike deliveries\n", numDeliveries);
@@ -301,6 +335,8 @@ gensa::finish ()
 // We simulate a von Nuemann style neuromorphic processor, working through our list of nuerons serially.
 // We should execute one FLOP and one tightly-coupled-memory access per CPU cycle.
 // Currently, for simplicity, we assume the full LIF model can execute in one cycle.
+// The host integrates input for every neuron at the start of a step (LIFStore::integrate),
+// but the threshold decision and its cost are still taken one neuron per cycle.
 // Also, neuron load/save is not charged memory access time.
 // Retrieving synapse records and transmitting spike packets can run in parallel with executing the LIF model,
 // but the LIF model needs to stall until all spikes are sent.
@@ -336,10 +372,21 @@ gensa::clockTic (Cycle_t t)
         syncSent = false;  // Although this is a wasted operation most of the time, it's the simplest way to reset sync state.
 
         neuronIndex++;
+        if (neuronIndex == 0) lif.integrate (now);
         if (neuronIndex < count)
         {
             Neuron * n = neurons[neuronIndex];
-            if (n->update (now))
+            bool spiked;
+            if (lif.isLIF[neuronIndex])
+            {
+                spiked = lif.fire (neuronIndex);
+                if (n->traces) n->trace (now * dt, spiked, lif.V[neuronIndex]);
+            }
+            else
+            {
+                spiked = n->update (now, now * dt);
+            }
+            if (spiked)
             {
                 numFirings++;
                 if (n->synapseCount) synapseIndex = 0;  // Start iterating through synapses.
@@ -397,7 +444,8 @@ gensa::handleNetwork (int vn)
         if (SpikeEvent * spike = dynamic_cast<SpikeEvent *> (event))
         {
             if (spike->neuron >= neurons.size ()) out.fatal (CALL_INFO, -1, "Invalid Neuron Address\n");
-            neurons[spike->neuron]->deliverSpike (spike->weight, spike->delay+now);
+            if (spike->delay >= lif.slots) out.fatal (CALL_INFO, -1, "Spike delay %u is longer than any synapse in the model\n", spike->delay);
+            if (lif.isLIF[spike->neuron]) lif.deliverSpike (spike->neuron, spike->weight, spike->delay+now, now, neuronIndex);
             numDeliveries++;
         }
         else if (SyncEvent * sync = dynamic_cast<SyncEvent *> (event))
@@ -51,7 +51,8 @@ public:
         {"clock",          "(string) Clock frequency",                                           "1GHz"},
         {"modelPath",      "(string) Path to neuron file",                                       "model"},
         {"steps",          "(uint) how many ticks the simulation should last",                   "1000"},
-        {"dt",             "(float) duration of one tick in sim time; used for output",          "1"}
+        {"dt",             "(float) duration of one tick in sim time; used for output",          "1"},
+        {"outputPrefix",   "(string) prepended to every trace file name in the model; each file may only be written by one core", ""}
     )
 
     SST_ELI_DOCUMENT_PORTS( {"mem_link", "Connection to memory", { "memHierarchy.MemEventBase" } } )
@@ -73,8 +74,13 @@ public:
     int         synapseIndex;    ///< Current downstream synapse (associated with current neuron) being sent a spike
     bool        syncSent;
     uint32_t    maxRequestDepth; ///< Shared by memory and network. Should be a pretty small number like 2 or 3.
+    float       dt;              ///< Output time of one step
+    std::string outputPrefix;    ///< Prepended to trace file names
+
+    std::map<std::string,OutputHolder *> outputs;  ///< Trace files written by this core, by name
 
     std::vector<Neuron*> neurons;
+    LIFStore             lif;     ///< Hot state of the LIF neurons in "neurons"
 
     TimeConverter *             clockTC;
     Interfaces::StandardMem *   memory;
@@ -96,6 +102,8 @@ public:
 
     virtual bool clockTic (SST::Cycle_t);
     void send ();  ///< Try to send next network request in queue.
+    void claimOutput   (const std::string & fileName);  ///< Fatal if another core already writes this trace file.
+    void releaseOutput (const std::string & fileName);
     void handleMemory (SST::Interfaces::StandardMem::Request * req);
     bool handleNetwork (int vn);
 };
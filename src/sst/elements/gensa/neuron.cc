@@ -17,6 +17,8 @@
 #include <sst_config.h>
 #include "neuron.h"
 
+#include <cmath>
+
 using namespace SST::gensaComponent;
 using namespace std;
 
@@ -36,9 +38,6 @@ Trace::~Trace()
 
 // class Neuron --------------------------------------------------------------
 
-std::map<std::string,OutputHolder *> Neuron::outputs;
-float                                Neuron::dt;
-
 Neuron::Neuron()
 {
     synapseBase  = 0;
@@ -61,56 +60,138 @@ void Neuron::deliverSpike(float str, uint when)
     // Do nothing
 }
 
+void Neuron::trace(const float time, bool spiked, float V)
+{
+    Trace * t = traces;
+    while (t) {
+        if (t->probe == 0) {
+            if (spiked) t->holder->trace (time, t->column, 1, t->mode);
+        } else if (t->probe == 1) {
+            t->holder->trace(time, t->column, V, t->mode);
+        }
+        t = t->next;
+    }
+}
+
 
-// NeuronLIF -----------------------------------------------------------------
+// class LIFStore ------------------------------------------------------------
 
-SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+LIFStore::LIFStore()
+:   rng(1,13)
+{
+    slots = 0;
+    mask  = 0;
+    count = 0;
+}
 
-NeuronLIF::NeuronLIF(float Vinit, float Vthreshold, float Vreset, float leak, float p)
-:   V          (Vinit),
-    Vthreshold (Vthreshold),
-    Vreset     (Vreset),
-    leak       (leak),
-    p          (p)
+void LIFStore::resize(size_t n)
 {
+    // Unused entries never cross threshold and never leak
+    count = n;
+    V         .resize(n, 0);
+    Vthreshold.resize(n, INFINITY);
+    Vreset    .resize(n, 0);
+    leak      .resize(n, 1);
+    p         .resize(n, 0);
+    isLIF     .resize(n, 0);
+    Vold      .resize(n, 0);
+    input     .resize(n, 0);
+    over      .resize(n, 0);
+    late      .resize(n, 0);
 }
 
-void NeuronLIF::deliverSpike(float str, uint when)
+void LIFStore::set(uint32_t index, float Vinit, float Vthreshold, float Vreset, float leak, float p)
 {
-    temporalBuffer[when] += str;
+    if (index >= count) resize(index + 1);
+    this->V         [index] = Vinit;
+    this->Vthreshold[index] = Vthreshold;
+    this->Vreset    [index] = Vreset;
+    this->leak      [index] = leak;
+    this->p         [index] = p;
+    this->isLIF     [index] = 1;
 }
 
-bool NeuronLIF::update(const uint now)
+void LIFStore::setMaxDelay(uint32_t maxDelay)
 {
-    // Add inputs
-    temporalBuffer_t::iterator i = temporalBuffer.find(now);
-    if (i != temporalBuffer.end()) {
-        V += i->second;
-        temporalBuffer.erase(i);
+    slots = 1;
+    while (slots <= maxDelay) slots <<= 1;
+    mask = slots - 1;
+    delayLine.assign((size_t) slots * count, 0);
+}
+
+void LIFStore::integrate(const uint now)
+{
+    float *         in  = &delayLine[(size_t) (now & mask) * count];
+    float *         v   = V.data ();
+    const float *   th  = Vthreshold.data ();
+    const float *   lk  = leak.data ();
+    float *         vo  = Vold.data ();
+    float *         inp = input.data ();
+    uint8_t *       ov  = over.data ();
+    for (size_t i = 0; i < count; i++) {
+        float x = in[i];
+        in[i]   = 0;
+        vo[i]   = v[i];
+        inp[i]  = x;
+        float y = x != 0 ? v[i] + x : v[i];  // Keep -0 when there is no input, like the old per-neuron buffer
+        bool  o = y > th[i];
+        ov[i]   = o;
+        v[i]    = o ? y : y * lk[i];
     }
+}
 
-    // Check for spike
-    bool spiked = false;
-    if (V > Vthreshold) {
-        if (p >= 1  ||  p > 0  &&  rng.nextUniform() <= p) {
-            V = Vreset;
-            spiked = true;
-        }
-    } else {
-        V *= leak;
+bool LIFStore::fire(uint32_t index)
+{
+    if (late[index]) {  // Redo this neuron's integrate() with the extra input
+        late[index] = 0;
+        float y = input[index] != 0 ? Vold[index] + input[index] : Vold[index];
+        over[index] = y > Vthreshold[index];
+        V[index] = over[index] ? y : y * leak[index];
     }
 
-    // Outputs
-    Trace * t = traces;
-    while (t) {
-        if (t->probe == 0) {
-            if (spiked) t->holder->trace (now*dt, t->column, 1, t->mode);
-        } else if (t->probe == 1) {
-            t->holder->trace(now*dt, t->column, V, t->mode);
+    if (! over[index]) return false;
+    float pi = p[index];
+    if (pi >= 1  ||  pi > 0  &&  rng.nextUniform() <= pi) {
+        V[index] = Vreset[index];
+        return true;
+    }
+    return false;
+}
+
+void LIFStore::deliverSpike(uint32_t index, float str, uint when, uint now, int current)
+{
+    // Caller guarantees when - now < slots
+    if (when > now) {
+        delayLine[(size_t) (when & mask) * count + index] += str;
+    } else if (when == now) {
+        if (current < 0) {
+            delayLine[(size_t) (now & mask) * count + index] += str;
+        } else if ((int) index > current) {
+            input[index] += str;
+            late[index] = 1;
         }
-        t = t->next;
+        // Otherwise the neuron has already been updated this step, and the input is lost.
     }
+}
 
+
+// NeuronLIF -----------------------------------------------------------------
+
+NeuronLIF::NeuronLIF(LIFStore * store, uint32_t index)
+:   store (store),
+    index (index)
+{
+}
+
+void NeuronLIF::deliverSpike(float str, uint when)
+{
+    store->deliverSpike(index, str, when, when, -1);
+}
+
+bool NeuronLIF::update(const uint now, const float t)
+{
+    bool spiked = store->fire(index);
+    trace(t, spiked, store->V[index]);
     return spiked;
 }
 
@@ -122,7 +203,7 @@ NeuronInput::NeuronInput()
     nextSpike = 0;
 }
 
-bool NeuronInput::update(const uint now)
+bool NeuronInput::update(const uint now, const float time)
 {
     if (nextSpike >= spikes.size()) return false;
     if (spikes[nextSpike] > now)    return false;
@@ -131,7 +212,7 @@ bool NeuronInput::update(const uint now)
     // Outputs
     Trace * t = traces;
     while (t) {
-        if (t->probe == 0) t->holder->trace(now*dt, t->column, 1, t->mode);
+        if (t->probe == 0) t->holder->trace(time, t->column, 1, t->mode);
         t = t->next;
     }
 
@@ -17,6 +17,7 @@
 #define _NEURON_H
 
 #include <map>
+#include <vector>
 #include <cstdint>
 
 #include <sst/core/interfaces/stdMem.h>  // supplies type uint
@@ -50,35 +51,66 @@ public:
     uint64_t synapseBase;  // address in memory of synapse list
     uint32_t synapseCount; // number of entries in synapse list
 
-    static float dt;
-    static std::map<std::string,OutputHolder *> outputs;
     Trace * traces;
 
     Neuron();
     virtual ~Neuron();
 
     virtual void deliverSpike(float str, uint32_t when);
-    virtual bool update      (const uint32_t now) = 0;  ///< performs Leaky Integrate and Fire. Returns true if fired.
+    virtual bool update      (const uint32_t now, const float t) = 0;  ///< performs Leaky Integrate and Fire. Returns true if fired. t is the output time of step now.
+
+    void trace(const float t, bool spiked, float V);  ///< Write this cycle's probes
 };
 
-class NeuronLIF : public Neuron {
+/**
+    State of all LIF neurons, stored as one array per field and indexed by neuron id.
+    Pending input lives in a ring of delay lines, one slot per step, each slot holding
+    one float per neuron. A step begins with integrate(), which folds the current slot
+    into V for every neuron in a single vectorizable pass. fire() then makes the
+    threshold decision for one neuron on the cycle the processor visits it. The RNG is
+    drawn in the same order as when each neuron did its whole update in its own cycle.
+**/
+class LIFStore {
 public:
-    float V;          // "voltage"; generally in the normal range [0,1]
-    float Vthreshold; // value of V which triggers a spike
-    float Vreset;     // value of V immediately after a spike
-    float leak;       // fraction of V to retain after present cycle, in [0,1]
-    float p;          // probability of firing when over threshold, in [0,1]
-
-    static SST::RNG::MarsagliaRNG rng;
+    std::vector<float>   V;          // "voltage"; generally in the normal range [0,1]
+    std::vector<float>   Vthreshold; // value of V which triggers a spike
+    std::vector<float>   Vreset;     // value of V immediately after a spike
+    std::vector<float>   leak;       // fraction of V to retain after present cycle, in [0,1]
+    std::vector<float>   p;          // probability of firing when over threshold, in [0,1]
+    std::vector<uint8_t> isLIF;      // 0 for input neurons and unused ids
+
+    std::vector<float>   Vold;       // V before integrate() for the current step
+    std::vector<float>   input;      // total input folded in for the current step
+    std::vector<uint8_t> over;       // V exceeded threshold after integrate()
+    std::vector<uint8_t> late;       // input arrived for the current step after integrate()
+
+    std::vector<float>   delayLine;  // slots x count; input for step t is in slot t & mask
+    uint32_t             slots;
+    uint32_t             mask;
+    size_t               count;
+
+    SST::RNG::MarsagliaRNG rng;  // per component, so each core draws the same sequence whatever thread it runs on
+
+    LIFStore();
+
+    void     resize    (size_t count);
+    void     set       (uint32_t index, float Vinit, float Vthreshold, float Vreset, float leak, float p);
+    void     setMaxDelay (uint32_t maxDelay);  ///< Allocates the delay lines. Call once all neurons are added.
+    void     integrate (const uint32_t now);
+    bool     fire      (uint32_t index);
+    /// current is the neuron being processed in step now (-1 before the step begins).
+    void     deliverSpike (uint32_t index, float str, uint32_t when, uint32_t now, int current);
+};
 
-    // temporal buffer
-    typedef std::map<const uint, float> temporalBuffer_t;
-    temporalBuffer_t temporalBuffer;
+class NeuronLIF : public Neuron {
+public:
+    LIFStore * store;
+    uint32_t   index;
 
-    NeuronLIF (float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
+    NeuronLIF (LIFStore * store, uint32_t index);
 
     virtual void deliverSpike(float str, uint32_t when);
-    virtual bool update      (const uint32_t now);
+    virtual bool update      (const uint32_t now, const float t);  ///< Assumes store->integrate(now) was already called.
 };
 
 class NeuronInput : public Neuron {
@@ -88,7 +120,7 @@ public:
 
     NeuronInput();
 
-    virtual bool update(const uint32_t now);
+    virtual bool update(const uint32_t now, const float t);
 };
 
 class SpikeEvent : public SST::Event
@@ -19,9 +19,13 @@ class testcase_gensa_Component(SSTTestCase):
     def test_gensa_1(self):
         self.gensa_test_template("1")
 
+    def test_gensa_1_multithread(self):
+        # Independent cores spread over threads; each must match the single-core spike pattern
+        self.gensa_test_template("1", cores=4, threads=2)
+
 #####
 
-    def gensa_test_template(self, testcase):
+    def gensa_test_template(self, testcase, cores=1, threads=None):
         # Note: testcase param is ignored for now
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
@@ -33,11 +37,16 @@ class testcase_gensa_Component(SSTTestCase):
 
         sdlfile = "{0}/{1}.py".format(test_path, testDataFileName)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        if cores > 1:
+            testDataFileName += "_mt"
         outfile = "{0}/{1}.out".format(outdir, testDataFileName)
         errfile = "{0}/{1}.err".format(outdir, testDataFileName)
         mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        otherargs = ""
+        if cores > 1:
+            otherargs = '--model-options="--cores={0}"'.format(cores)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, num_threads=threads)
 
         testing_remove_component_warning_from_file(outfile)
 
@@ -48,11 +57,17 @@ class testcase_gensa_Component(SSTTestCase):
             log_testing_note("gensa test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
         #   Check if spiking pattern exactly matches expected values
+        #   Core 0 writes "out", core N writes "coreN_out"
+        for core in range(cores):
+            prefix = "" if core == 0 else "core{0}_".format(core)
+            self.checkSpikes("{0}/{1}out".format(outdir, prefix))
+
+    def checkSpikes(self, outpath):
         cmp_result = True
         import OutputParser
         from OutputParser import OutputParser
         o = OutputParser()
-        o.parse(outdir + "/out")
+        o.parse(outpath)
         if not self.checkColumn(o,  "0", [1,1,0,0]): cmp_result = False
         if not self.checkColumn(o,  "1", [1,1,1,0]): cmp_result = False
         if not self.checkColumn(o,  "2", [0,1,0,0]): cmp_result = False
@@ -68,7 +83,7 @@ class testcase_gensa_Component(SSTTestCase):
         if not self.checkColumn(o, "12", [0,1,0,0]): cmp_result = False
         if not self.checkColumn(o, "13", [1,1,1,0]): cmp_result = False
         if not self.checkColumn(o, "14", [1,1,0,0]): cmp_result = False
-        self.assertTrue(cmp_result, "Output file {0}/out does not contain expected spike pattern".format(outdir))
+        self.assertTrue(cmp_result, "Output file {0} does not contain expected spike pattern".format(outpath))
         o.close()
 
     def checkColumn(self, o, index, pattern):
@@ -17,6 +17,8 @@
 #define _MVMCOMPUTEARRAY_H
 
 #include <sst/elements/golem/array/computeArray.h>
+#include <sst/elements/golem/array/mvmKernel.h>
+#include <memory>
 #include <type_traits>
 
 namespace SST {
@@ -49,6 +51,12 @@ public:
             outputVectors[i].resize(outputArraySize, T());
             matrixData[i].resize(inputArraySize * outputArraySize, T());
         }
+
+        // Large arrays can split their rows across host threads
+        computeThreads = params.find<uint32_t>("computeThreads", 1);
+        parallelMinSize = params.find<uint64_t>("parallelMinSize", 65536);
+        if (computeThreads > 1 && inputArraySize * outputArraySize >= parallelMinSize)
+            workerPool.reset(new MVMWorkerPool(computeThreads));
     }
 
     virtual void beginComputation(uint32_t arrayID) override {
@@ -66,8 +74,11 @@ public:
         (*tileHandler)(ev);
     }
 
+    // index is row-major (row * inputArraySize + col), storage is column-major for mvmColumnMajor
     virtual void setMatrixItem(int32_t arrayID, int32_t index, double value) override {
-        matrixData[arrayID][index] = static_cast<T>(value);
+        uint64_t row = index / inputArraySize;
+        uint64_t col = index % inputArraySize;
+        matrixData[arrayID][col * outputArraySize + row] = static_cast<T>(value);
     }
 
     virtual void setVectorItem(int32_t arrayID, int32_t index, double value) override {
@@ -82,27 +93,22 @@ public:
         // Ensure output vector is correctly sized
         outputVector.resize(outputArraySize);
 
-        // Initialize output vector to zero
-        std::fill(outputVector.begin(), outputVector.end(), T());
-
-        // Print input vector
-        out.verbose(CALL_INFO, 2, 0, "MVM for array %u:\n\n", arrayID);
-        for (uint32_t col = 0; col < inputArraySize; col++) {
-            printValue(inputVector[col]);
-        }
-        out.verbose(CALL_INFO, 2, 0, "\n\n");
-
         // Perform matrix-vector multiplication
-        for (uint32_t row = 0; row < outputArraySize; row++) {
-            for (uint32_t col = 0; col < inputArraySize; col++) {
-                outputVector[row] += matrix[row * inputArraySize + col] * inputVector[col];
-                printValue(matrix[row * inputArraySize + col]);
-            }
-            out.verbose(CALL_INFO, 2, 0, "  ");
-            printValue(outputVector[row]);
-            out.verbose(CALL_INFO, 2, 0, "\n");
+        const T* m = matrix.data();
+        const T* in = inputVector.data();
+        T* result = outputVector.data();
+        const uint64_t rows = outputArraySize;
+        const uint64_t cols = inputArraySize;
+        if (workerPool) {
+            workerPool->parallelFor(rows, [m, in, result, rows, cols](uint64_t begin, uint64_t end) {
+                mvmColumnMajor(m, in, result, rows, cols, begin, end);
+            });
+        } else {
+            mvmColumnMajor(m, in, result, rows, cols, 0, rows);
         }
-        out.verbose(CALL_INFO, 2, 0, "\n\n");
+
+        if (out.getVerboseLevel() >= 2)
+            printComputation(arrayID);
     }
 
     virtual SimTime_t getArrayLatency(uint32_t arrayID) override {
@@ -124,7 +130,34 @@ public:
 protected:
     std::vector<std::vector<T>> inputVectors;
     std::vector<std::vector<T>> outputVectors;
-    std::vector<std::vector<T>> matrixData;
+    std::vector<std::vector<T>> matrixData;   // column-major
+
+    uint32_t computeThreads;
+    uint64_t parallelMinSize;
+    std::unique_ptr<MVMWorkerPool> workerPool;
+
+    // Input vector, then each matrix row followed by its output value
+    void printComputation(uint32_t arrayID) {
+        auto& inputVector = inputVectors[arrayID];
+        auto& outputVector = outputVectors[arrayID];
+        auto& matrix = matrixData[arrayID];
+
+        out.verbose(CALL_INFO, 2, 0, "MVM for array %u:\n\n", arrayID);
+        for (uint32_t col = 0; col < inputArraySize; col++) {
+            printValue(inputVector[col]);
+        }
+        out.verbose(CALL_INFO, 2, 0, "\n\n");
+
+        for (uint32_t row = 0; row < outputArraySize; row++) {
+            for (uint32_t col = 0; col < inputArraySize; col++) {
+                printValue(matrix[col * outputArraySize + row]);
+            }
+            out.verbose(CALL_INFO, 2, 0, "  ");
+            printValue(outputVector[row]);
+            out.verbose(CALL_INFO, 2, 0, "\n");
+        }
+        out.verbose(CALL_INFO, 2, 0, "\n\n");
+    }
 
     void printValue(const T& value) {
         if constexpr (std::is_same<T, int64_t>::value) {
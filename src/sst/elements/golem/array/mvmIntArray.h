@@ -44,6 +44,8 @@ public:
         {"arrayOutputSize",    "Length of output vector (implies array columns)"},
         {"inputOperandSize",   "Number of bytes in a single input value"},
         {"outputOperandSize",  "Number of bytes in a single output value"},
+        {"computeThreads",     "Number of host threads used to compute large arrays", "1"},
+        {"parallelMinSize",    "Minimum number of matrix elements for an array to use computeThreads", "65536"},
     )
 
     MVMIntArray(ComponentId_t id, Params& params,
@@ -0,0 +1,157 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MVMKERNEL_H
+#define _MVMKERNEL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SST {
+namespace Golem {
+
+// Rows of the output vector accumulated together; sized so the output block stays in L1
+static const uint64_t MVM_ROW_BLOCK = 256;
+
+/*
+ * Matrix-vector multiply for output rows [rowBegin, rowEnd).
+ *
+ * The matrix is stored column-major (element (row, col) at col * rows + row) so
+ * the inner loop is a unit-stride axpy over a block of rows and vectorizes for
+ * both integer and floating-point types. Each output row still sums its terms
+ * in column order, so the result is bit-identical to the row-by-row dot product.
+ */
+template<typename T>
+inline void mvmColumnMajor(const T* matrix, const T* input, T* output,
+                           uint64_t rows, uint64_t cols,
+                           uint64_t rowBegin, uint64_t rowEnd) {
+    for (uint64_t r0 = rowBegin; r0 < rowEnd; r0 += MVM_ROW_BLOCK) {
+        const uint64_t r1 = std::min(r0 + MVM_ROW_BLOCK, rowEnd);
+        T* __restrict__ out = output;
+        for (uint64_t r = r0; r < r1; r++)
+            out[r] = T();
+
+        uint64_t c = 0;
+        for (; c + 4 <= cols; c += 4) {
+            const T x0 = input[c], x1 = input[c + 1], x2 = input[c + 2], x3 = input[c + 3];
+            const T* __restrict__ m0 = matrix + c * rows;
+            const T* __restrict__ m1 = m0 + rows;
+            const T* __restrict__ m2 = m1 + rows;
+            const T* __restrict__ m3 = m2 + rows;
+            for (uint64_t r = r0; r < r1; r++)
+                out[r] = (((out[r] + m0[r] * x0) + m1[r] * x1) + m2[r] * x2) + m3[r] * x3;
+        }
+        for (; c < cols; c++) {
+            const T x = input[c];
+            const T* __restrict__ m = matrix + c * rows;
+            for (uint64_t r = r0; r < r1; r++)
+                out[r] += m[r] * x;
+        }
+    }
+}
+
+/*
+ * Fixed set of worker threads that split a range of output rows.
+ * The calling thread takes the first chunk, so a pool of N threads
+ * starts N-1 workers. Workers sleep between calls.
+ */
+class MVMWorkerPool {
+public:
+    MVMWorkerPool(uint32_t threads) : generation(0), pending(0), shutdown(false) {
+        for (uint32_t i = 1; i < threads; i++)
+            workers.emplace_back(&MVMWorkerPool::workerLoop, this, i);
+    }
+
+    ~MVMWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            shutdown = true;
+        }
+        wake.notify_all();
+        for (auto& t : workers)
+            t.join();
+    }
+
+    uint32_t numThreads() const { return workers.size() + 1; }
+
+    // Calls fn(begin, end) on disjoint chunks covering [0, n) and returns once all chunks are done
+    void parallelFor(uint64_t n, const std::function<void(uint64_t, uint64_t)>& fn) {
+        const uint64_t threads = numThreads();
+        // Keep chunk boundaries on row-block boundaries
+        chunk = ((n + threads - 1) / threads + MVM_ROW_BLOCK - 1) / MVM_ROW_BLOCK * MVM_ROW_BLOCK;
+        total = n;
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            task = &fn;
+            pending = workers.size();
+            generation++;
+        }
+        wake.notify_all();
+
+        fn(0, std::min(chunk, n));
+
+        std::unique_lock<std::mutex> lock(mtx);
+        done.wait(lock, [this] { return pending == 0; });
+        task = nullptr;
+    }
+
+private:
+    void workerLoop(uint32_t id) {
+        uint64_t seen = 0;
+        while (true) {
+            const std::function<void(uint64_t, uint64_t)>* fn;
+            {
+                std::unique_lock<std::mutex> lock(mtx);
+                wake.wait(lock, [this, seen] { return shutdown || generation != seen; });
+                if (shutdown)
+                    return;
+                seen = generation;
+                fn = task;
+            }
+
+            const uint64_t begin = std::min(id * chunk, total);
+            const uint64_t end = std::min(begin + chunk, total);
+            if (begin < end)
+                (*fn)(begin, end);
+
+            {
+                std::lock_guard<std::mutex> lock(mtx);
+                pending--;
+            }
+            done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex mtx;
+    std::condition_variable wake;
+    std::condition_variable done;
+    const std::function<void(uint64_t, uint64_t)>* task = nullptr;
+    uint64_t generation;
+    uint64_t pending;
+    uint64_t chunk = 0;
+    uint64_t total = 0;
+    bool shutdown;
+};
+
+} // namespace Golem
+} // namespace SST
+
+#endif /* _MVMKERNEL_H */
@@ -0,0 +1,90 @@
+// Microbenchmark for the golem MVM kernel.
+//
+// Times the original row-major double loop against mvmColumnMajor, single
+// threaded and split over an MVMWorkerPool, for int64_t and float, and checks
+// that all three produce identical outputs.
+//
+// usage: mvm_kernel_bench [rows] [cols] [iterations] [threads]
+
+#include <sst/elements/golem/array/mvmKernel.h>
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace SST::Golem;
+
+template<typename T>
+static void mvmNaive(const T* matrix, const T* input, T* output, uint64_t rows, uint64_t cols) {
+    for (uint64_t row = 0; row < rows; row++) {
+        output[row] = T();
+        for (uint64_t col = 0; col < cols; col++)
+            output[row] += matrix[row * cols + col] * input[col];
+    }
+}
+
+static double timeIt(uint64_t iterations, const std::function<void()>& fn) {
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++)
+        fn();
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return elapsed.count();
+}
+
+template<typename T>
+static bool run(const char* name, uint64_t rows, uint64_t cols, uint64_t iterations, uint32_t threads) {
+    std::mt19937 rng(1);
+    std::vector<T> rowMajor(rows * cols), colMajor(rows * cols), input(cols);
+    for (uint64_t r = 0; r < rows; r++) {
+        for (uint64_t c = 0; c < cols; c++) {
+            T value = static_cast<T>(static_cast<int>(rng() % 17) - 8);
+            if (std::is_floating_point<T>::value)
+                value /= 3;
+            rowMajor[r * cols + c] = value;
+            colMajor[c * rows + r] = value;
+        }
+    }
+    for (uint64_t c = 0; c < cols; c++)
+        input[c] = static_cast<T>(static_cast<int>(rng() % 9) - 4);
+
+    std::vector<T> naiveOut(rows), blockedOut(rows), threadedOut(rows);
+    MVMWorkerPool pool(threads);
+
+    double naive = timeIt(iterations, [&] {
+        mvmNaive(rowMajor.data(), input.data(), naiveOut.data(), rows, cols);
+    });
+    double blocked = timeIt(iterations, [&] {
+        mvmColumnMajor(colMajor.data(), input.data(), blockedOut.data(), rows, cols, 0, rows);
+    });
+    std::function<void(uint64_t, uint64_t)> chunk = [&](uint64_t begin, uint64_t end) {
+        mvmColumnMajor(colMajor.data(), input.data(), threadedOut.data(), rows, cols, begin, end);
+    };
+    double threaded = timeIt(iterations, [&] { pool.parallelFor(rows, chunk); });
+
+    bool match = !memcmp(naiveOut.data(), blockedOut.data(), rows * sizeof(T)) &&
+                 !memcmp(naiveOut.data(), threadedOut.data(), rows * sizeof(T));
+
+    double ops = 2.0 * rows * cols * iterations;
+    printf("%-8s %6" PRIu64 "x%-6" PRIu64 " naive %8.3fs (%6.2f GOP/s)  blocked %8.3fs (%6.2f GOP/s)  %u threads %8.3fs (%6.2f GOP/s)  %s\n",
+           name, rows, cols,
+           naive, ops / naive / 1e9, blocked, ops / blocked / 1e9,
+           threads, threaded, ops / threaded / 1e9,
+           match ? "match" : "MISMATCH");
+    return match;
+}
+
+int main(int argc, char** argv) {
+    uint64_t rows = argc > 1 ? strtoull(argv[1], nullptr, 0) : 512;
+    uint64_t cols = argc > 2 ? strtoull(argv[2], nullptr, 0) : 512;
+    uint64_t iterations = argc > 3 ? strtoull(argv[3], nullptr, 0) : 1000;
+    uint32_t threads = argc > 4 ? strtoul(argv[4], nullptr, 0) : 1;
+
+    bool ok = run<int64_t>("int64", rows, cols, iterations, threads);
+    ok = run<float>("float", rows, cols, iterations, threads) && ok;
+    return ok ? 0 : 1;
+}
@@ -66,23 +66,26 @@ RankMapping::globalMapping(const std::string& name)
   return ret;
 }
 
-const RankMapping::ptr&
+RankMapping::ptr
 RankMapping::globalMapping(AppId aid)
 {
   std::lock_guard<std::mutex> lk(mutex);
-  auto& mapping = app_ids_launched_[aid];
-  if (!mapping){
+  if (aid < 0 || aid >= int(app_ids_launched_.size()) || !app_ids_launched_[aid]){
     std::string err_msg = "No task mapping exists for app ";
-    err_msg += aid;
+    err_msg += std::to_string(aid);
     Hg::abort(err_msg);
   }
-  return mapping;
+  return app_ids_launched_[aid];
 }
 
 void
 RankMapping::addGlobalMapping(AppId aid, const std::string &unique_name, const RankMapping::ptr &mapping)
 {
   std::lock_guard<std::mutex> lk(mutex);
+  if (aid >= int(app_ids_launched_.size())){
+    app_ids_launched_.resize(aid + 1);
+    local_refcounts_.resize(aid + 1);
+  }
   app_ids_launched_[aid] = mapping;
   app_names_launched_[unique_name] = mapping;
   local_refcounts_[aid]++;
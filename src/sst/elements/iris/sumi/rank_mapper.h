@@ -90,7 +90,9 @@ public:
 
   std::vector<std::list<int>> &nodeToRank() { return node_to_rank_indexing_; }
 
-  static const RankMapping::ptr &globalMapping(AppId aid);
+  // Returned by value: the registry is shared by all threads and an
+  // entry may be removed while the caller still holds the mapping
+  static RankMapping::ptr globalMapping(AppId aid);
 
   static RankMapping::ptr globalMapping(const std::string &unique_name);
 
@@ -92,11 +92,17 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
 
     route_y_first = params.find<bool>("route_y_first",false);
 
+    bypass_enabled = params.find<bool>("bypass",false);
+
     // Register the clock
     my_clock_handler = new Clock::Handler2<noc_mesh,&noc_mesh::clock_handler>(this);
     clock_tc = registerClock( clock_freq, my_clock_handler);
     clock_is_off = false;
 
+    // Bypassed packets are sent with sub-cycle delays to land on the
+    // next clock edge
+    core_tc = getTimeConverter(getCoreTimeBase());
+
     // Configure the ports
     ports = new Link*[local_port_start + local_ports];
 
@@ -110,6 +116,8 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     output_port_stalls = new Statistic<uint64_t>*[local_ports + 4];
     xbar_stalls = new Statistic<uint64_t>*[local_ports + 4];
 
+    bypassed_hops = registerStatistic<uint64_t>("bypassed_hops");
+    buffered_hops = registerStatistic<uint64_t>("buffered_hops");
 
     // North port
     ports[north_port] = configureLink("north", dummy_handler);
@@ -236,6 +244,8 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
 
         route(event);
 
+        if ( bypass_enabled && try_bypass(event, port) ) break;
+
         // Put the event into the proper queue
         port_queues[port].push(event);
         if (clock_is_off)
@@ -329,6 +339,8 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
         noc_mesh_event* event = wrap_incoming_packet(packet);
         route(event);
 
+        if ( bypass_enabled && try_bypass(event, port) ) break;
+
         // Need to put the event into the proper queue
         port_queues[port].push(event);
         if (clock_is_off)
@@ -351,9 +363,83 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
 //     out.output("End Router: id = %d\n", id);
 // }
 
+bool
+noc_mesh::try_bypass(noc_mesh_event* event, int in_port)
+{
+    // Only bypass when the router is idle.  The clock is only off
+    // when all the input queues are empty, so there is nothing to
+    // arbitrate against.
+    if ( !clock_is_off ) return false;
+
+    // Traced packets go through the clocked path so the trace output
+    // is printed at the right time
+    if ( event->encap_ev->request->getTraceType() != SimpleNetwork::Request::NONE ) return false;
+
+    int port = event->next_port;
+    int flits = event->encap_ev->getSizeInFlits();
+
+    // The clocked path would handle the packet on the next clock
+    // edge.  If that edge was already used by an earlier bypass, let
+    // the clock handle this one.
+    SimTime_t period = clock_tc.getFactor();
+    SimTime_t now = getCurrentSimCycle();
+    Cycle_t next = now / period + 1;
+    if ( next <= last_time ) return false;
+    Cycle_t elapsed = next - last_time;
+
+    // Output port will still be busy or there aren't enough credits
+    if ( port_busy[port] > 0 && (Cycle_t)port_busy[port] > elapsed ) return false;
+    if ( port_credits[port] < flits ) return false;
+
+    // Bring the router state up to what it would be after the clock
+    // handler ran on the next edge and sent this packet
+    for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+        port_busy[i] = ((Cycle_t)port_busy[i] <= elapsed) ? 0 : port_busy[i] - (int)elapsed;
+    }
+    // The arbitration pass for the next edge accounts for this send in
+    // the LRU units.  An earlier bypass whose edge the clock never ran
+    // on is accounted for now.
+    if ( bypass_port >= 0 ) advance_lru(bypass_port);
+    bypass_port = in_port;
+    port_credits[port] -= flits;
+    port_busy[port] = flits;
+    last_time = next;
+    bypass_cycle = next;
+
+    SimTime_t delay = next * period - now;
+    send_bit_count[port]->addData(event->encap_ev->request->size_in_bits);
+    if ( edge_status & ( 1 << port) ) {
+        ports[port]->send(delay, core_tc, event->encap_ev);
+        event->encap_ev = NULL;
+        delete event;
+    }
+    else {
+        ports[port]->send(delay, core_tc, event);
+    }
+
+    // Return the credits to the previous hop at the same time
+    ports[in_port]->send(delay, core_tc, new credit_event(0, flits));
+    bypassed_hops->addData(1);
+    return true;
+}
+
+// Moves the LRU units along as an arbitration pass in which only
+// sent_port sent would
+void
+noc_mesh::advance_lru(int sent_port)
+{
+    for ( auto& lru : lru_units ) {
+        for ( unsigned int i = 0; i < lru.size(); i++ ) {
+            lru.satisfied(lru.top() == sent_port);
+        }
+    }
+}
+
 void noc_mesh::clock_wakeup() {
     Cycle_t time = reregisterClock(clock_tc, my_clock_handler);
-    Cycle_t cyclesOff = time - last_time - 1;
+    // A bypass may have already accounted for the cycle the clock
+    // will fire on
+    Cycle_t cyclesOff = (time > last_time) ? time - last_time - 1 : 0;
     // Update busy values
     for ( int i = 0; i < local_port_start + local_ports; ++i) {
         port_busy[i] = (port_busy[i] < cyclesOff) ? 0 : port_busy[i] - cyclesOff;
@@ -373,12 +459,25 @@ void noc_mesh::clock_wakeup() {
 bool
 noc_mesh::clock_handler(Cycle_t cycle)
 {
-    last_time = cycle;
     // TraceFunction trace(CALL_INFO);
-    // Decrement all the busy values
-    for ( int i = 0; i < local_port_start + local_ports; ++i ) {
-        port_busy[i]--;
-        if (port_busy[i] < 0) port_busy[i] = 0;
+    // Decrement all the busy values, unless a bypass already did the
+    // accounting for this cycle
+    if ( !bypass_enabled || cycle != bypass_cycle ) {
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            port_busy[i]--;
+            if (port_busy[i] < 0) port_busy[i] = 0;
+        }
+    }
+    last_time = cycle;
+
+    // A bypass sent from its input port on this edge, so that port
+    // takes its turn in this pass instead of moving the LRU units
+    // along a second time
+    int bypassed_port = -1;
+    if ( bypass_port >= 0 ) {
+        if ( cycle == bypass_cycle ) bypassed_port = bypass_port;
+        else advance_lru(bypass_port);
+        bypass_port = -1;
     }
 
     bool keepClockOn = false;
@@ -390,7 +489,12 @@ noc_mesh::clock_handler(Cycle_t cycle)
     for ( auto& lru : lru_units ) {
         for ( unsigned int i = 0; i < lru.size(); i++ ) {
             int lru_port = lru.top();
-            if ( !port_queues[lru_port].empty() ) {
+            if ( lru_port == bypassed_port ) {
+                lru.satisfied(true);
+                if (!port_queues[lru_port].empty())
+                    keepClockOn = true;
+            }
+            else if ( !port_queues[lru_port].empty() ) {
                 // noc_mesh_event* event = port_queues[local_port_start + i].front();
                 noc_mesh_event* event = port_queues[lru_port].front();
 
@@ -444,6 +548,7 @@ noc_mesh::clock_handler(Cycle_t cycle)
                     credit_event* cr_ev = new credit_event(0, flits);
                     // ports[local_port_start + i]->send(cr_ev);
                     ports[lru_port]->send(cr_ev);
+                    buffered_hops->addData(1);
                     lru.satisfied(true);
                 }
                 else {
@@ -60,6 +60,7 @@ public:
         {"port_priority_equal","Set to true to have all port have equal priority (usually endpoint ports have higher priority).","false"},
         {"route_y_first",      "Set to true to rout Y-dimension first.","false"},
         {"use_dense_map",      "Set to true to have a dense network id map instead of the sparse map normally used.","false"},
+        {"bypass",             "Set to true to forward packets through idle routers directly from the input handler, without waking the router clock. Timing matches the clocked path when there is no contention.","false"},
         // {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
     )
 
@@ -76,6 +77,8 @@ public:
         // { "send_packet_count",  "Count number of packets sent on link", "packets", 1},
         { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
         { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
+        { "bypassed_hops",      "Count number of packets forwarded through the router without buffering (bypass mode)", "packets", 1},
+        { "buffered_hops",      "Count number of packets forwarded through the router input buffers", "packets", 1},
         // { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
     )
 
@@ -128,6 +131,13 @@ private:
     bool port_priority_equal;
     Shared::SharedArray<int> dense_map;
 
+    bool bypass_enabled;
+    TimeConverter core_tc;
+    Cycle_t bypass_cycle = 0;
+    // Input port of the last bypass, until the arbitration pass for
+    // bypass_cycle has accounted for it.  -1 if there is none.
+    int bypass_port = -1;
+
     std::vector< lru_unit<int> > lru_units;
     // lru_unit<int> local_lru;
     // lru_unit<int> mesh_lru;
@@ -142,11 +152,15 @@ private:
     void handle_input_ep2r(Event* ev, int port);
 
     void route(noc_mesh_event* event);
+    bool try_bypass(noc_mesh_event* event, int in_port);
+    void advance_lru(int sent_port);
 
 
     Statistic<uint64_t>** send_bit_count;
     Statistic<uint64_t>** output_port_stalls;
     Statistic<uint64_t>** xbar_stalls;
+    Statistic<uint64_t>* bypassed_hops;
+    Statistic<uint64_t>* buffered_hops;
     // Statistic<uint64_t>** xbar_stalls_prioirty;
     // Statistic<uint64_t>** xbar_stalls_normal;
     // Statistic<uint64_t>** output_idle;
@@ -1,5 +1,6 @@
 # Automatically generated SST Python input
 import sst
+import sys
 
 sst.setProgramOption("timebase", "1ps")
 #sst.setProgramOption("stop-at", "1000ns")
@@ -27,6 +28,22 @@ flit_size = "32B"
 input_buf_size = "64B"
 #input_buf_size = "256B"
 
+ep_link_bw = "1GB/s"
+
+# Model options: --bypass forwards packets through idle routers without
+# waking their clocks, --stats=<file> changes the statistics output file,
+# --contended sends more and larger messages from faster endpoints so the
+# routers arbitrate between input ports
+bypass = "--bypass" in sys.argv[1:]
+stats_file = "stats.csv"
+for arg in sys.argv[1:]:
+    if arg.startswith("--stats="):
+        stats_file = arg[len("--stats="):]
+if "--contended" in sys.argv[1:]:
+    num_messages = 40
+    msg_size = "256B"
+    ep_link_bw = "16GB/s"
+
 # Setting this to True will cause no-cut links on the north and south
 # ports, as well as on all endpoints
 add_no_cut = False
@@ -39,7 +56,8 @@ for y in range(y_size):
             "link_bw" : link_bw,
             "input_buf_size" : input_buf_size,
             "flit_size" : flit_size,
-            "use_dense_map" : "true"
+            "use_dense_map" : "true",
+            "bypass" : "true" if bypass else "false"
             #"port_priority_equal" : "true"
         })
         # wire up mesh connections.  Any index that would be -1 will
@@ -55,13 +73,13 @@ for y in range(y_size):
             ep = sst.Component("ep0_%d_%d"%(x,y+1), "merlin.test_nic")
             ep.addParams({
                 "num_peers" : "%d"%(num_peers),
-                "link_bw" : "1GB/s",
+                "link_bw" : ep_link_bw,
                 "linkcontrol_type" : "kingsley.linkcontrol",
                 "message_size" : msg_size,
                 "num_messages" : "%d"%(num_messages)
             })
             sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
-            sub.addParam("link_bw","1GB/s")
+            sub.addParam("link_bw",ep_link_bw)
             sub.addLink(getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x,y+1)), "rtr_port", "800ps")
 
 
@@ -75,13 +93,13 @@ for y in range(y_size):
             ep = sst.Component("ep0_%d_X"%(x), "merlin.test_nic")
             ep.addParams({
                 "num_peers" : "%d"%(num_peers),
-                "link_bw" : "1GB/s",
+                "link_bw" : ep_link_bw,
                 "linkcontrol_type" : "kingsley.linkcontrol",
                 "message_size" : msg_size,
                 "num_messages" : "%d"%(num_messages)
             })
             sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
-            sub.addParam("link_bw","1GB/s")
+            sub.addParam("link_bw",ep_link_bw)
             sub.addLink(getLink("rtr_%d_X"%(x), "ep0_%d_%d"%(x,y)), "rtr_port", "800ps")
 
         if x != x_size - 1:
@@ -93,13 +111,13 @@ for y in range(y_size):
             ep = sst.Component("ep0_%d_%d"%(x+1,y), "merlin.test_nic")
             ep.addParams({
                 "num_peers" : "%d"%(num_peers),
-                "link_bw" : "1GB/s",
+                "link_bw" : ep_link_bw,
                 "linkcontrol_type" : "kingsley.linkcontrol",
                 "message_size" : msg_size,
                 "num_messages" : "%d"%(num_messages)
             })
             sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
-            sub.addParam("link_bw","1GB/s")
+            sub.addParam("link_bw",ep_link_bw)
             sub.addLink(getLink("rtr_%d_%d"%(x,y), "ep0_%d_%d"%(x+1,y)), "rtr_port", "800ps")
 
         if x != 0:
@@ -112,13 +130,13 @@ for y in range(y_size):
             ep = sst.Component("ep0_X_%d"%(y), "merlin.test_nic")
             ep.addParams({
                 "num_peers" : "%d"%(num_peers),
-                "link_bw" : "1GB/s",
+                "link_bw" : ep_link_bw,
                 "linkcontrol_type" : "kingsley.linkcontrol",
                 "message_size" : msg_size,
                 "num_messages" : "%d"%(num_messages)
             })
             sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
-            sub.addParam("link_bw","1GB/s")
+            sub.addParam("link_bw",ep_link_bw)
             sub.addLink(getLink("rtr_X_%d"%(y), "ep0_%d_%d"%(x,y)), "rtr_port", "800ps")
 
 
@@ -130,14 +148,14 @@ for y in range(y_size):
             ep = sst.Component("ep%d_%d_%d"%(z,x,y), "merlin.test_nic")
             ep.addParams({
                 "num_peers" : num_peers,
-                "link_bw" : "1GB/s",
+                "link_bw" : ep_link_bw,
                 "linkcontrol_type" : "kingsley.linkcontrol",
                 "message_size" : msg_size,
                 "num_messages" : "%d"%(num_messages)
 
             })
             sub = ep.setSubComponent("networkIF","kingsley.linkcontrol")
-            sub.addParam("link_bw","1GB/s")
+            sub.addParam("link_bw",ep_link_bw)
             sub.addLink(getLink("rtr_%d_%d"%(x,y), "ep%d_%d_%d"%(z,x,y)), "rtr_port", "800ps")
 
 
@@ -145,7 +163,7 @@ sst.setStatisticLoadLevel(9)
 
 sst.setStatisticOutput("sst.statOutputCSV");
 sst.setStatisticOutputOptions({
-    "filepath" : "stats.csv",
+    "filepath" : stats_file,
     "separator" : ", "
 })
 
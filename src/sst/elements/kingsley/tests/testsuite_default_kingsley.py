@@ -3,6 +3,8 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import glob
+
 
 class testcase_kingsley_Component(SSTTestCase):
 
@@ -19,9 +21,72 @@ class testcase_kingsley_Component(SSTTestCase):
     def test_kingsly_noc_mesh_32(self):
         self.kingsley_test_template("noc_mesh_32_test")
 
+    def test_kingsly_noc_mesh_32_bypass(self):
+        # Bypass must not change the timing of the uncontended traffic, so the
+        # output still matches the reference, and it must actually bypass routers
+        outdir = self.get_test_output_run_dir()
+        statfile = "{0}/test_kingsley_noc_mesh_32_bypass.csv".format(outdir)
+        otherargs = '--model-options=\"--bypass --stats={0}\"'.format(statfile)
+
+        self.kingsley_test_template("noc_mesh_32_test", "noc_mesh_32_bypass", otherargs)
+
+        bypassed = self._sumStatistics(statfile, ["bypassed_hops"])
+        self.assertTrue(bypassed > 0, "No hops were bypassed with bypass=true, statistics in {0}".format(statfile))
+
+    def test_kingsly_noc_mesh_32_contended_bypass(self):
+        # With contention the routers pick input ports in LRU order.  A
+        # bypassed hop must leave that order as the clocked router would,
+        # so every endpoint sees the same timing with bypass on and off
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        sdlfile = "{0}/noc_mesh_32_test.py".format(test_path)
+
+        outfiles = dict()
+        statfiles = dict()
+        for mode in ["clocked", "bypass"]:
+            runFileName = "test_kingsley_noc_mesh_32_contended_{0}".format(mode)
+            statfiles[mode] = "{0}/{1}.csv".format(outdir, runFileName)
+            outfiles[mode] = "{0}/{1}.out".format(outdir, runFileName)
+            errfile = "{0}/{1}.err".format(outdir, runFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
+
+            options = "--contended --stats={0}".format(statfiles[mode])
+            if mode == "bypass":
+                options += " --bypass"
+            otherargs = '--model-options=\"{0}\"'.format(options)
+
+            self.run_sst(sdlfile, outfiles[mode], errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+        stalls = self._sumStatistics(statfiles["clocked"], ["xbar_stalls", "output_port_stalls"])
+        self.assertTrue(stalls > 0, "The contended run never arbitrated between ports, statistics in {0}".format(statfiles["clocked"]))
+
+        bypassed = self._sumStatistics(statfiles["bypass"], ["bypassed_hops"])
+        self.assertTrue(bypassed > 0, "No hops were bypassed with bypass=true, statistics in {0}".format(statfiles["bypass"]))
+
+        testname = "noc_mesh_32_contended_bypass"
+        cmp_result = testing_compare_sorted_diff(testname, outfiles["bypass"], outfiles["clocked"])
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data(testname)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Sorted output with bypass {0} does not match sorted output without bypass {1}".format(outfiles["bypass"], outfiles["clocked"]))
+
+    def _sumStatistics(self, statfile, names):
+        # statistics from every rank are written to their own file
+        total = 0
+        for csvfile in glob.glob("{0}*.csv".format(statfile[:-len(".csv")])):
+            with open(csvfile) as fp:
+                header = [field.strip() for field in fp.readline().split(",")]
+                name_col = header.index("StatisticName")
+                sum_col = header.index("Sum.u64")
+                for line in fp:
+                    fields = [field.strip() for field in line.split(",")]
+                    if fields[name_col] in names:
+                        total += int(fields[sum_col])
+        return total
+
 #####
 
-    def kingsley_test_template(self, testcase):
+    def kingsley_test_template(self, testcase, testname=None, otherargs=""):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -29,14 +94,17 @@ class testcase_kingsley_Component(SSTTestCase):
 
         # Set the various file paths
         testDataFileName="test_kingsley_{0}".format(testcase)
+        if testname is None:
+            testname = testcase
+        runFileName="test_kingsley_{0}".format(testname)
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
-        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
-        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
-        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, runFileName)
+        errfile = "{0}/{1}.err".format(outdir, runFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
 
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
         #       BASED testSuite_XXX.sh THESE SHOULD BE RE-EVALUATED BY THE
@@ -47,8 +115,8 @@ class testcase_kingsley_Component(SSTTestCase):
         if os_test_file(errfile, "-s"):
             log_testing_note("kingsley test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
-        cmp_result = testing_compare_sorted_diff(testcase, outfile, reffile)
+        cmp_result = testing_compare_sorted_diff(testname, outfile, reffile)
         if (cmp_result == False):
-            diffdata = testing_get_diff_data(testcase)
+            diffdata = testing_get_diff_data(testname)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
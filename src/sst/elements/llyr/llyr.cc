@@ -113,7 +113,7 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     constructSoftwareGraph(swFileName);
 
     //do the mapping
-    Params mapperParams;    //empty but needed for loadModule API
+    Params mapperParams = params.get_scoped_params("mapper_params");
     std::string mapperName = params.find<std::string>("mapper", "llyr.mapper.simple");
     llyr_mapper_ = loadModule<LlyrMapper>(mapperName, mapperParams);
     output_->verbose(CALL_INFO, 1, 0, "Mapping application to hardware with %s\n", mapperName.c_str());
@@ -58,6 +58,8 @@ public:
         { "clockcount",     "Number of clock ticks to execute", "100000" },
         { "application",    "Application in affine IR", "app.in" },
         { "hardware_graph", "Hardware connectivity graph", "grid.cfg" },
+        { "mapper",         "Module used to map the application onto the hardware graph", "llyr.mapper.simple" },
+        { "mapper_params",  "Parameters passed to the mapper module (scoped, e.g. mapper_params.threads)", "" },
         { "mapping_tool",   "External mapping tool", "" },
         { "mem_init",       "Memory initialization file", "" },
         { "ls_entries",     "Number of L/S entries to process each tick", "1" },
@@ -0,0 +1,658 @@
+// Copyright 2013-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _ANNEAL_MAPPER_H
+#define _ANNEAL_MAPPER_H
+
+#include <map>
+#include <cmath>
+#include <queue>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+#include <string>
+#include <limits>
+#include <sstream>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <unistd.h>
+
+#include "mappers/llyrMapper.h"
+
+namespace SST {
+namespace Llyr {
+
+/*
+ * Native placement engine: app nodes are bound to op-compatible hardware
+ * vertices by simulated annealing, minimizing the total hop distance of the
+ * application edges on the (undirected) hardware graph. Each move only
+ * re-costs the edges incident to the moved nodes. Independent annealing
+ * chains can run on multiple host threads and the best result is kept.
+ * Results may be cached on disk, keyed on a hash of both graphs and the
+ * annealing parameters, so repeated simulations skip the search entirely.
+ */
+class AnnealMapper : public LlyrMapper
+{
+
+public:
+    explicit AnnealMapper(Params& params) :
+        LlyrMapper()
+    {
+        num_threads_ = params.find< uint32_t >("threads", 1);
+        iterations_ = params.find< uint64_t >("iterations", 200000);
+        start_temp_ = params.find< double >("start_temp", 8.0);
+        end_temp_ = params.find< double >("end_temp", 0.01);
+        seed_ = params.find< uint64_t >("seed", 1);
+        cache_dir_ = params.find< std::string >("cache_dir", "");
+        verbosity_ = params.find< uint32_t >("verbose", 0);
+
+        if( num_threads_ == 0 ) {
+            num_threads_ = std::max( 1u, std::thread::hardware_concurrency() );
+        }
+    }
+    ~AnnealMapper() { }
+
+    SST_ELI_REGISTER_MODULE(
+        AnnealMapper,
+        "llyr",
+        "mapper.anneal",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "App to HW using multi-threaded simulated annealing",
+        SST::Llyr::LlyrMapper
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "threads",      "Number of independent annealing chains (host threads), 0 uses all cores", "1" },
+        { "iterations",   "Number of annealing moves per chain", "200000" },
+        { "start_temp",   "Initial annealing temperature (in hops)", "8.0" },
+        { "end_temp",     "Final annealing temperature (in hops)", "0.01" },
+        { "seed",         "Base seed for the annealing chains", "1" },
+        { "cache_dir",    "Directory used to cache mapping results, empty disables caching", "" },
+        { "verbose",      "Verbosity of the mapper output, the component verbosity is used if it is higher", "0" }
+    )
+
+    void mapGraph(LlyrGraph< opType > hardwareGraph, LlyrGraph< AppNode > appGraph,
+                  LlyrGraph< ProcessingElement* > &graphOut,
+                  LlyrConfig* llyr_config);
+
+private:
+    typedef std::vector< uint32_t > Placement;      // app index -> hardware index
+
+    // flattened view of both graphs shared (read-only) by all chains
+    struct Problem {
+        std::vector< uint32_t > hw_ids_;
+        std::vector< uint32_t > app_ids_;
+        std::vector< opType >   hw_ops_;
+        std::vector< opType >   app_ops_;
+        std::vector< uint16_t > dist_;                           // hw x hw hop distance
+        std::vector< std::vector< uint32_t > > app_nbrs_;        // undirected, with multiplicity
+        std::vector< std::pair< uint32_t, uint32_t > > app_edges_;
+        std::vector< std::vector< uint32_t > > candidates_;      // app index -> compatible hw indices
+
+        uint16_t dist( uint32_t a, uint32_t b ) const { return dist_[ (uint64_t)a * hw_ids_.size() + b ]; }
+        bool fits( uint32_t app, uint32_t hw ) const { return isCompatible( hw_ops_[hw], app_ops_[app] ); }
+    };
+
+    uint32_t    num_threads_;
+    uint64_t    iterations_;
+    double      start_temp_;
+    double      end_temp_;
+    uint64_t    seed_;
+    std::string cache_dir_;
+    uint32_t    verbosity_;
+
+    static bool isCompatible( opType hwOp, opType appOp );
+
+    void buildProblem( LlyrGraph< opType > &hardwareGraph, LlyrGraph< AppNode > &appGraph, Problem &problem,
+                       SST::Output* output ) const;
+    bool initialPlacement( const Problem &problem, Placement &placement ) const;
+    uint64_t totalCost( const Problem &problem, const Placement &placement ) const;
+    uint64_t anneal( const Problem &problem, Placement &placement, uint64_t seed ) const;
+
+    uint64_t hashGraphs( LlyrGraph< opType > &hardwareGraph, LlyrGraph< AppNode > &appGraph ) const;
+    std::string cacheFile( uint64_t key ) const;
+    bool readCache( const std::string &fileName, const Problem &problem, Placement &placement ) const;
+    void writeCache( const std::string &fileName, const Problem &problem, const Placement &placement ) const;
+};
+
+bool AnnealMapper::isCompatible( opType hwOp, opType appOp )
+{
+    if( hwOp == ANY || hwOp == appOp ) {
+        return 1;
+    }
+
+    // ANY_* hardware vertices accept every operation within their op class
+    switch( hwOp ) {
+        case ANY_MEM:
+            return appOp > ANY_MEM && appOp < ANY_LOGIC;
+        case ANY_LOGIC:
+            return appOp > ANY_LOGIC && appOp < ANY_TEST;
+        case ANY_TEST:
+            return appOp > ANY_TEST && appOp < ANY_INT;
+        case ANY_INT:
+            return appOp > ANY_INT && appOp < ANY_FP;
+        case ANY_FP:
+            return appOp > ANY_FP && appOp < ANY_CP;
+        case ANY_CP:
+            return appOp > ANY_CP && appOp < DUMMY;
+        default:
+            return 0;
+    }
+}
+
+void AnnealMapper::buildProblem( LlyrGraph< opType > &hardwareGraph, LlyrGraph< AppNode > &appGraph, Problem &problem,
+                                 SST::Output* output ) const
+{
+    std::map< uint32_t, Vertex< opType > >* hw_vertex_map = hardwareGraph.getVertexMap();
+    std::map< uint32_t, Vertex< AppNode > >* app_vertex_map = appGraph.getVertexMap();
+
+    std::map< uint32_t, uint32_t > hw_index;
+    for( auto it = hw_vertex_map->begin(); it != hw_vertex_map->end(); ++it ) {
+        hw_index.emplace( it->first, problem.hw_ids_.size() );
+        problem.hw_ids_.push_back( it->first );
+        problem.hw_ops_.push_back( it->second.getValue() );
+    }
+
+    std::map< uint32_t, uint32_t > app_index;
+    for( auto it = app_vertex_map->begin(); it != app_vertex_map->end(); ++it ) {
+        app_index.emplace( it->first, problem.app_ids_.size() );
+        problem.app_ids_.push_back( it->first );
+        problem.app_ops_.push_back( it->second.getValue().optype_ );
+    }
+
+    // hardware links are treated as bidirectional for routing purposes
+    const uint32_t num_hw = problem.hw_ids_.size();
+    std::vector< std::vector< uint32_t > > hw_nbrs( num_hw );
+    for( auto it = hw_vertex_map->begin(); it != hw_vertex_map->end(); ++it ) {
+        uint32_t src = hw_index.at( it->first );
+        std::vector< Edge* >* adjacencyList = it->second.getAdjacencyList();
+        for( auto edge_it = adjacencyList->begin(); edge_it != adjacencyList->end(); ++edge_it ) {
+            uint32_t dst = hw_index.at( (*edge_it)->getDestination() );
+            hw_nbrs[src].push_back( dst );
+            hw_nbrs[dst].push_back( src );
+        }
+    }
+
+    // all-pairs hop distance, one BFS per source spread across the worker threads
+    const uint16_t unreachable = std::numeric_limits< uint16_t >::max();
+    problem.dist_.assign( (uint64_t)num_hw * num_hw, unreachable );
+    auto bfs_worker = [&problem, &hw_nbrs, num_hw, unreachable]( uint32_t first, uint32_t stride ) {
+        std::queue< uint32_t > frontier;
+        for( uint32_t src = first; src < num_hw; src += stride ) {
+            uint16_t* row = &problem.dist_[ (uint64_t)src * num_hw ];
+            row[src] = 0;
+            frontier.push( src );
+            while( frontier.empty() == 0 ) {
+                uint32_t current = frontier.front();
+                frontier.pop();
+                for( uint32_t next : hw_nbrs[current] ) {
+                    if( row[next] == unreachable ) {
+                        row[next] = row[current] + 1;
+                        frontier.push( next );
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector< std::thread > workers;
+    for( uint32_t i = 1; i < num_threads_; ++i ) {
+        workers.emplace_back( bfs_worker, i, num_threads_ );
+    }
+    bfs_worker( 0, num_threads_ );
+    for( auto &worker : workers ) {
+        worker.join();
+    }
+
+    // application edges
+    problem.app_nbrs_.resize( problem.app_ids_.size() );
+    for( auto it = app_vertex_map->begin(); it != app_vertex_map->end(); ++it ) {
+        uint32_t src = app_index.at( it->first );
+        std::vector< Edge* >* adjacencyList = it->second.getAdjacencyList();
+        for( auto edge_it = adjacencyList->begin(); edge_it != adjacencyList->end(); ++edge_it ) {
+            uint32_t dst = app_index.at( (*edge_it)->getDestination() );
+            problem.app_edges_.emplace_back( src, dst );
+            if( src != dst ) {
+                problem.app_nbrs_[src].push_back( dst );
+                problem.app_nbrs_[dst].push_back( src );
+            }
+        }
+    }
+
+    // candidate hardware vertices per application node
+    problem.candidates_.resize( problem.app_ids_.size() );
+    for( uint32_t app = 0; app < problem.app_ids_.size(); ++app ) {
+        for( uint32_t hw = 0; hw < num_hw; ++hw ) {
+            if( problem.fits( app, hw ) ) {
+                problem.candidates_[app].push_back( hw );
+            }
+        }
+
+        if( problem.candidates_[app].empty() ) {
+            output->fatal( CALL_INFO, -1, "Error: No hardware vertex can host application node %" PRIu32 " (%s)\n",
+                           problem.app_ids_[app], getOpString(problem.app_ops_[app]).c_str() );
+        }
+    }
+}
+
+bool AnnealMapper::initialPlacement( const Problem &problem, Placement &placement ) const
+{
+    const uint32_t num_app = problem.app_ids_.size();
+    const uint32_t none = std::numeric_limits< uint32_t >::max();
+    std::vector< bool > used( problem.hw_ids_.size(), 0 );
+    placement.assign( num_app, none );
+
+    // most constrained nodes first so specialized PEs are not consumed by flexible ops
+    std::vector< uint32_t > order( num_app );
+    for( uint32_t i = 0; i < num_app; ++i ) {
+        order[i] = i;
+    }
+    std::stable_sort( order.begin(), order.end(), [&problem]( uint32_t a, uint32_t b ) {
+        return problem.candidates_[a].size() < problem.candidates_[b].size();
+    } );
+
+    // greedily pick the free candidate closest to already placed neighbors
+    for( uint32_t app : order ) {
+        uint32_t best = none;
+        uint64_t best_cost = std::numeric_limits< uint64_t >::max();
+        for( uint32_t hw : problem.candidates_[app] ) {
+            if( used[hw] ) {
+                continue;
+            }
+
+            uint64_t cost = 0;
+            for( uint32_t nbr : problem.app_nbrs_[app] ) {
+                if( placement[nbr] != none ) {
+                    cost += problem.dist( hw, placement[nbr] );
+                }
+            }
+
+            if( cost < best_cost ) {
+                best_cost = cost;
+                best = hw;
+            }
+        }
+
+        if( best == none ) {
+            return 0;
+        }
+
+        placement[app] = best;
+        used[best] = 1;
+    }
+
+    return 1;
+}
+
+uint64_t AnnealMapper::totalCost( const Problem &problem, const Placement &placement ) const
+{
+    uint64_t cost = 0;
+    for( auto &edge : problem.app_edges_ ) {
+        cost += problem.dist( placement[edge.first], placement[edge.second] );
+    }
+
+    return cost;
+}
+
+uint64_t AnnealMapper::anneal( const Problem &problem, Placement &placement, uint64_t seed ) const
+{
+    const uint32_t num_app = problem.app_ids_.size();
+    const uint32_t none = std::numeric_limits< uint32_t >::max();
+
+    // reverse map, hardware index -> app index
+    std::vector< uint32_t > occupant( problem.hw_ids_.size(), none );
+    for( uint32_t app = 0; app < num_app; ++app ) {
+        occupant[placement[app]] = app;
+    }
+
+    // cost of the edges incident to app placed at hw, ignoring edges to skip
+    auto incident = [&problem, &placement]( uint32_t app, uint32_t hw, uint32_t skip ) {
+        int64_t cost = 0;
+        for( uint32_t nbr : problem.app_nbrs_[app] ) {
+            if( nbr != skip ) {
+                cost += problem.dist( hw, placement[nbr] );
+            }
+        }
+        return cost;
+    };
+
+    std::mt19937_64 rng( seed );
+    std::uniform_real_distribution< double > uniform( 0.0, 1.0 );
+
+    uint64_t cost = totalCost( problem, placement );
+    uint64_t best_cost = cost;
+    Placement best = placement;
+
+    const double cooling = ( iterations_ > 1 && start_temp_ > 0.0 && end_temp_ > 0.0 ) ?
+                           std::pow( end_temp_ / start_temp_, 1.0 / (double)( iterations_ - 1 ) ) : 1.0;
+    double temp = start_temp_;
+
+    for( uint64_t iter = 0; iter < iterations_ && num_app > 0 && best_cost > 0; ++iter, temp *= cooling ) {
+        uint32_t app_a = rng() % num_app;
+        const std::vector< uint32_t > &cands = problem.candidates_[app_a];
+        uint32_t hw_a = placement[app_a];
+        uint32_t hw_b = cands[ rng() % cands.size() ];
+        if( hw_b == hw_a ) {
+            continue;
+        }
+
+        // moving into an occupied vertex swaps the two nodes, if legal
+        uint32_t app_b = occupant[hw_b];
+        if( app_b != none && !problem.fits( app_b, hw_a ) ) {
+            continue;
+        }
+
+        // edges between a and b keep their length under a swap, so they are skipped
+        int64_t delta = incident( app_a, hw_b, app_b ) - incident( app_a, hw_a, app_b );
+        if( app_b != none ) {
+            delta += incident( app_b, hw_a, app_a ) - incident( app_b, hw_b, app_a );
+        }
+
+        if( delta <= 0 || ( temp > 0.0 && uniform( rng ) < std::exp( -(double)delta / temp ) ) ) {
+            placement[app_a] = hw_b;
+            occupant[hw_b] = app_a;
+            occupant[hw_a] = app_b;
+            if( app_b != none ) {
+                placement[app_b] = hw_a;
+            }
+
+            cost = (uint64_t)( (int64_t)cost + delta );
+            if( cost < best_cost ) {
+                best_cost = cost;
+                best = placement;
+            }
+        }
+    }
+
+    placement = best;
+    return best_cost;
+}
+
+uint64_t AnnealMapper::hashGraphs( LlyrGraph< opType > &hardwareGraph, LlyrGraph< AppNode > &appGraph ) const
+{
+    // FNV-1a over a canonical dump of both graphs and the search parameters
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash]( const std::string &data ) {
+        for( unsigned char c : data ) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+    };
+
+    std::stringstream dataOut;
+    dataOut << "hw";
+    std::map< uint32_t, Vertex< opType > >* hw_vertex_map = hardwareGraph.getVertexMap();
+    for( auto it = hw_vertex_map->begin(); it != hw_vertex_map->end(); ++it ) {
+        dataOut << ";" << it->first << ":" << (uint32_t)it->second.getValue();
+        std::vector< Edge* >* adjacencyList = it->second.getAdjacencyList();
+        for( auto edge_it = adjacencyList->begin(); edge_it != adjacencyList->end(); ++edge_it ) {
+            dataOut << "," << (*edge_it)->getDestination();
+        }
+    }
+    mix( dataOut.str() );
+
+    dataOut.str("");
+    dataOut << "app";
+    std::map< uint32_t, Vertex< AppNode > >* app_vertex_map = appGraph.getVertexMap();
+    for( auto it = app_vertex_map->begin(); it != app_vertex_map->end(); ++it ) {
+        AppNode node = it->second.getValue();
+        dataOut << ";" << it->first << ":" << (uint32_t)node.optype_;
+        std::vector< Edge* >* adjacencyList = it->second.getAdjacencyList();
+        for( auto edge_it = adjacencyList->begin(); edge_it != adjacencyList->end(); ++edge_it ) {
+            dataOut << "," << (*edge_it)->getDestination();
+        }
+    }
+    mix( dataOut.str() );
+
+    dataOut.str("");
+    dataOut << "anneal;" << num_threads_ << ";" << iterations_ << ";" << start_temp_ << ";" << end_temp_ << ";" << seed_;
+    mix( dataOut.str() );
+
+    return hash;
+}
+
+std::string AnnealMapper::cacheFile( uint64_t key ) const
+{
+    char name[64];
+    snprintf( name, sizeof(name), "llyr_anneal_%016" PRIx64 ".map", key );
+    return cache_dir_ + "/" + name;
+}
+
+bool AnnealMapper::readCache( const std::string &fileName, const Problem &problem, Placement &placement ) const
+{
+    std::ifstream inputStream( fileName, std::ios::in );
+    if( !inputStream.is_open() ) {
+        return 0;
+    }
+
+    std::map< uint32_t, uint32_t > hw_index;
+    for( uint32_t hw = 0; hw < problem.hw_ids_.size(); ++hw ) {
+        hw_index.emplace( problem.hw_ids_[hw], hw );
+    }
+
+    const uint32_t none = std::numeric_limits< uint32_t >::max();
+    std::vector< bool > used( problem.hw_ids_.size(), 0 );
+    placement.assign( problem.app_ids_.size(), none );
+
+    // one "<app vertex> <hardware vertex>" pair per line, in app index order
+    uint32_t app = 0;
+    uint32_t app_id;
+    uint32_t hw_id;
+    while( inputStream >> app_id >> hw_id ) {
+        if( app >= problem.app_ids_.size() || problem.app_ids_[app] != app_id ) {
+            return 0;
+        }
+
+        auto hw_it = hw_index.find( hw_id );
+        if( hw_it == hw_index.end() || used[hw_it->second] ) {
+            return 0;
+        }
+
+        if( !problem.fits( app, hw_it->second ) ) {
+            return 0;
+        }
+
+        placement[app++] = hw_it->second;
+        used[hw_it->second] = 1;
+    }
+
+    return app == problem.app_ids_.size();
+}
+
+void AnnealMapper::writeCache( const std::string &fileName, const Problem &problem, const Placement &placement ) const
+{
+    // write to a temporary and rename so concurrent simulations never see a partial file
+    std::string tempName = fileName + "." + std::to_string( getpid() );
+    std::ofstream outputFile( tempName.c_str(), std::ios::trunc );
+    if( !outputFile ) {
+        return;
+    }
+
+    for( uint32_t app = 0; app < problem.app_ids_.size(); ++app ) {
+        outputFile << problem.app_ids_[app] << " " << problem.hw_ids_[placement[app]] << "\n";
+    }
+    outputFile.close();
+
+    std::rename( tempName.c_str(), fileName.c_str() );
+}
+
+void AnnealMapper::mapGraph(LlyrGraph< opType > hardwareGraph, LlyrGraph< AppNode > appGraph,
+                            LlyrGraph< ProcessingElement* > &graphOut,
+                            LlyrConfig* llyr_config)
+{
+    //setup up i/o for messages
+    char prefix[256];
+    sprintf(prefix, "[t=@t][annealMapper]: ");
+    SST::Output* output_ = new SST::Output(prefix, std::max( llyr_config->verbosity_, verbosity_ ), 0, Output::STDOUT);
+
+    output_->verbose(CALL_INFO, 1, 0, "Starting mapping (%" PRIu32 " chains, %" PRIu64 " iterations)\n",
+                     num_threads_, iterations_);
+
+    Problem problem;
+    buildProblem( hardwareGraph, appGraph, problem, output_ );
+
+    Placement placement;
+    uint64_t cost = 0;
+    bool cached = 0;
+    std::string cacheName;
+    if( cache_dir_ != "" ) {
+        cacheName = cacheFile( hashGraphs( hardwareGraph, appGraph ) );
+        cached = readCache( cacheName, problem, placement );
+        if( cached ) {
+            cost = totalCost( problem, placement );
+            output_->verbose(CALL_INFO, 1, 0, "Using cached mapping %s\n", cacheName.c_str());
+        }
+    }
+
+    if( !cached ) {
+        Placement start;
+        if( !initialPlacement( problem, start ) ) {
+            output_->fatal(CALL_INFO, -1, "Error: Hardware graph does not have enough compatible PEs for the application\n");
+        }
+        output_->verbose(CALL_INFO, 1, 0, "Initial placement cost %" PRIu64 "\n", totalCost( problem, start ));
+
+        // independent chains, the lowest cost (then lowest chain id) wins so results are deterministic
+        std::vector< Placement > results( num_threads_, start );
+        std::vector< uint64_t > costs( num_threads_, 0 );
+        std::vector< std::thread > workers;
+        for( uint32_t i = 1; i < num_threads_; ++i ) {
+            workers.emplace_back( [this, &problem, &results, &costs, i]() {
+                costs[i] = anneal( problem, results[i], seed_ + i );
+            } );
+        }
+        costs[0] = anneal( problem, results[0], seed_ );
+        for( auto &worker : workers ) {
+            worker.join();
+        }
+
+        uint32_t winner = 0;
+        for( uint32_t i = 1; i < num_threads_; ++i ) {
+            if( costs[i] < costs[winner] ) {
+                winner = i;
+            }
+        }
+
+        placement = results[winner];
+        cost = costs[winner];
+
+        if( cache_dir_ != "" ) {
+            writeCache( cacheName, problem, placement );
+        }
+    }
+
+    output_->verbose(CALL_INFO, 1, 0, "Final placement cost %" PRIu64 " hops over %zu edges\n",
+                     cost, problem.app_edges_.size());
+
+    // mapped vertices are numbered hardware vertex + 1 so that node 0 stays free for the dummy root
+    std::map< uint32_t, Vertex< AppNode > >* app_vertex_map_ = appGraph.getVertexMap();
+    std::map< uint32_t, uint32_t > mapping;
+    for( uint32_t app = 0; app < problem.app_ids_.size(); ++app ) {
+        uint32_t currentAppNode = problem.app_ids_[app];
+        uint32_t newNodeNum = problem.hw_ids_[placement[app]] + 1;
+
+        opType tempOp = app_vertex_map_->at(currentAppNode).getValue().optype_;
+        if( tempOp == ADDCONST || tempOp == SUBCONST || tempOp == MULCONST || tempOp == DIVCONST || tempOp == REMCONST ||
+            tempOp == INC || tempOp == INC_RST || tempOp == ACC ||
+            tempOp == LDADDR || tempOp == STREAM_LD || tempOp == STADDR || tempOp == STREAM_ST ) {
+            QueueArgMap* arguments = new QueueArgMap;
+            arguments->emplace( 0, app_vertex_map_->at(currentAppNode).getValue().argument_[0] );
+            addNode( tempOp, arguments, newNodeNum, graphOut, llyr_config );
+        } else {
+            addNode( tempOp, newNodeNum, graphOut, llyr_config );
+        }
+
+        mapping.emplace( currentAppNode, newNodeNum );
+        output_->verbose(CALL_INFO, 32, 0, "-- App %" PRIu32 " -> HW %" PRIu32 "\n", currentAppNode, newNodeNum - 1);
+    }
+
+    // insert dummy as node 0 to make BFS easier
+    addNode( DUMMY, 0, graphOut, llyr_config );
+
+    // now add the edges
+    for( auto appIterator = app_vertex_map_->begin(); appIterator != app_vertex_map_->end(); ++appIterator ) {
+        std::vector< Edge* >* adjacencyList = appIterator->second.getAdjacencyList();
+        for( auto it = adjacencyList->begin(); it != adjacencyList->end(); it++ ) {
+            graphOut.addEdge( mapping.at(appIterator->first), mapping.at((*it)->getDestination()) );
+        }
+    }
+
+    // add edges from the dummy root
+    std::map< uint32_t, Vertex< ProcessingElement* > >* vertex_map_ = graphOut.getVertexMap();
+    for( auto vertexIterator = vertex_map_->begin(); vertexIterator != vertex_map_->end(); ++vertexIterator ) {
+        if( vertexIterator->first != 0 && vertexIterator->second.getInDegree() == 0 ) {
+            graphOut.addEdge( 0, vertexIterator->first );
+        }
+    }
+
+    //-------------- BFS ---------------------------------
+    //Mark all nodes in the PE graph un-visited
+    for( auto vertexIterator = vertex_map_->begin(); vertexIterator != vertex_map_->end(); ++vertexIterator ) {
+        vertexIterator->second.setVisited(0);
+    }
+
+    //Node 0 is a dummy node and is always the entry point
+    std::queue< uint32_t > nodeQueue;
+    nodeQueue.push(0);
+
+    //BFS and add input/output edges
+    while( nodeQueue.empty() == 0 ) {
+        uint32_t currentNode = nodeQueue.front();
+        nodeQueue.pop();
+
+        vertex_map_->at(currentNode).setVisited(1);
+
+        std::vector< Edge* >* adjacencyList = vertex_map_->at(currentNode).getAdjacencyList();
+        for( auto it = adjacencyList->begin(); it != adjacencyList->end(); it++ ) {
+            uint32_t destinationVertex = (*it)->getDestination();
+
+            ProcessingElement* srcNode = vertex_map_->at(currentNode).getValue();
+            ProcessingElement* dstNode = vertex_map_->at(destinationVertex).getValue();
+
+            output_->verbose(CALL_INFO, 32, 0, "Binding %" PRIu32 " -> %" PRIu32 "\n",
+                             srcNode->getProcessorId(), dstNode->getProcessorId());
+
+            srcNode->bindOutputQueue(dstNode);
+            dstNode->bindInputQueue(srcNode);
+
+            if( vertex_map_->at(destinationVertex).getVisited() == 0 ) {
+                vertex_map_->at(destinationVertex).setVisited(1);
+                nodeQueue.push(destinationVertex);
+            }
+        }
+
+        //FIXME Need to use a fake init on ST for now
+        opType tempOp = vertex_map_->at(currentNode).getValue()->getOpBinding();
+        if( tempOp == ST || tempOp == LDADDR || tempOp == STADDR || tempOp == STREAM_LD || tempOp == STREAM_ST || tempOp == ACC ) {
+            vertex_map_->at(currentNode).getValue()->inputQueueInit();
+        }
+    }
+
+    //FIXME Fake init for now, need to read values from stack
+    //Initialize any L/S PEs at the top of the graph
+    std::vector< Edge* >* rootAdjacencyList = vertex_map_->at(0).getAdjacencyList();
+    for( auto it = rootAdjacencyList->begin(); it != rootAdjacencyList->end(); it++ ) {
+        uint32_t destinationVertex = (*it)->getDestination();
+        vertex_map_->at(destinationVertex).getValue()->inputQueueInit();
+    }
+
+}// mapGraph
+
+}// namespace Llyr
+}// namespace SST
+
+#endif // _ANNEAL_MAPPER_H
+
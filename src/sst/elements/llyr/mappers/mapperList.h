@@ -18,5 +18,6 @@
 
 #include "simpleMapper.h"
 #include "pyMapper.h"
+#include "annealMapper.h"
 
 #endif //MAPPER_LIST_H
@@ -1,5 +1,6 @@
 # Automatically generated SST Python input
 import sst
+import sys
 
 # Define SST core options
 sst.setProgramOption("timebase", "1 ps")
@@ -15,6 +16,15 @@ mainDebug = 0
 otherDebug = 0
 debugLevel = 0
 
+# Optional model options: a mapper followed by key=value mapper parameters
+mapper = "llyr.mapper.simple"
+mapperParams = {}
+if len(sys.argv) > 1:
+    mapper = sys.argv[1]
+    for arg in sys.argv[2:]:
+        key, value = arg.split("=", 1)
+        mapperParams["mapper_params." + key] = value
+
 # Define the simulation components
 df_0 = sst.Component("df_0", "llyr.LlyrDataflow")
 df_0.addParams({
@@ -23,8 +33,9 @@ df_0.addParams({
    "mem_init"      : "int-1.mem",
    "application"   : "gemm.in",
    "hardware_graph": "graph_mesh_25.hdw",
-   "mapper"        : "llyr.mapper.simple"
+   "mapper"        : mapper
 })
+df_0.addParams(mapperParams)
 iface = df_0.setSubComponent("iface", "memHierarchy.standardInterface")
 
 df_l1cache = sst.Component("df_l1", "memHierarchy.Cache")
@@ -3,6 +3,9 @@
 from sst_unittest import *
 from sst_unittest_support import *
 
+import os
+import shutil
+
 
 class testcase_llyr_Component(SSTTestCase):
 
@@ -22,6 +25,47 @@ class testcase_llyr_Component(SSTTestCase):
     def test_llyr_simpletest(self):
         self.llyr_test_template("simple_test")
 
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "llyr: test_llyr_anneal skipped if ranks > 1")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "llyr: test_llyr_anneal skipped if threads > 1")
+    def test_llyr_anneal(self):
+        # Map simple_test with the anneal mapper twice sharing a cache directory, the
+        # second run must load the cached placement and simulate exactly like the first
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        sdlfile = "{0}/simple_test.py".format(test_path)
+        cachedir = "{0}/llyr_anneal_cache".format(tmpdir)
+        shutil.rmtree(cachedir, ignore_errors=True)
+        os.makedirs(cachedir)
+
+        otherargs = '--model-options=\"llyr.mapper.anneal threads=2 iterations=20000 seed=1 verbose=1 cache_dir={0}\"'.format(cachedir)
+
+        outfiles = []
+        for run in ["map", "cached"]:
+            outfile = "{0}/test_llyr_anneal_{1}.out".format(outdir, run)
+            errfile = "{0}/test_llyr_anneal_{1}.err".format(outdir, run)
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, timeout_sec=240)
+            testing_remove_component_warning_from_file(outfile)
+            outfiles.append(outfile)
+
+            cached = [f for f in os.listdir(cachedir) if f.endswith(".map")]
+            self.assertEqual(len(cached), 1, "Anneal mapper did not leave one mapping in {0}: {1}".format(cachedir, cached))
+
+            with open(outfile) as fp:
+                loaded = "Using cached mapping {0}/{1}".format(cachedir, cached[0]) in fp.read()
+            if run == "map":
+                self.assertFalse(loaded, "Anneal mapper used a cached mapping on the first run, see {0}".format(outfile))
+            else:
+                self.assertTrue(loaded, "Anneal mapper did not load the cached mapping, see {0}".format(outfile))
+
+        # The mapper reports how it got the placement, only the simulation has to match
+        ignore_lines = ["[annealMapper]"]
+        filesAreTheSame, statDiffs, othDiffs = testing_stat_output_diff(outfiles[1], outfiles[0], ignore_lines, {}, True)
+        if not filesAreTheSame:
+            log_failure(self._prettyPrintDiffs(statDiffs, othDiffs))
+        self.assertTrue(filesAreTheSame, "Run with the cached anneal mapping {0} differs from the first run {1}".format(outfiles[1], outfiles[0]))
+
 #####
 
     def llyr_test_template(self, testcase, testtimeout=240):
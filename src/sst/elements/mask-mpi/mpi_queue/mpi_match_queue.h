@@ -0,0 +1,263 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <mpi_integers.h>
+#include <mpi_types.h>
+#include <mpi_message.h>
+
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#pragma once
+
+namespace SST::MASKMPI {
+
+/**
+ * The (comm, source, tag) signature used for pt2pt matching.
+ * Source and tag may be MPI_ANY_SOURCE/MPI_ANY_TAG.
+ */
+struct MatchKey {
+  MPI_Comm comm;
+  int source;
+  int tag;
+
+  bool operator==(const MatchKey& other) const {
+    return comm == other.comm && source == other.source && tag == other.tag;
+  }
+};
+
+struct MatchKeyHash {
+  size_t operator()(const MatchKey& k) const {
+    uint64_t h = uint64_t(k.comm);
+    h = h * 0x9E3779B97F4A7C15ULL ^ uint32_t(k.source);
+    h = h * 0x9E3779B97F4A7C15ULL ^ uint32_t(k.tag);
+    return size_t(h ^ (h >> 32));
+  }
+};
+
+/**
+ * Requests (receives or probes) waiting for a message, bucketed by their
+ * signature including wildcards. A message has a concrete signature and can
+ * therefore only match four buckets: exact, any-tag, any-source, and
+ * any-source/any-tag. Each bucket is FIFO and every entry carries a posting
+ * sequence number, so the oldest matching request wins as MPI requires.
+ */
+template <class T>
+class WildcardMatchQueue
+{
+ public:
+  void push(T* t, MPI_Comm comm, int source, int tag) {
+    buckets_[MatchKey{comm, source, tag}].push_back(Entry{t, seqnum_++});
+    ++size_;
+  }
+
+  /**
+   * Remove and return the oldest request matching the message signature.
+   * Requests for which stale() is true are dropped as they are encountered.
+   */
+  template <class Stale>
+  T* pop(MPI_Comm comm, int source, int tag, Stale stale) {
+    if (size_ == 0) return nullptr;
+
+    auto best = buckets_.end();
+    for (const MatchKey& key : candidates(comm, source, tag)) {
+      auto it = buckets_.find(key);
+      if (it == buckets_.end()) continue;
+      Bucket& b = it->second;
+      while (!b.empty() && stale(b.front().item)) {
+        b.pop_front();
+        --size_;
+      }
+      if (b.empty()) {
+        buckets_.erase(it);
+      } else if (best == buckets_.end()
+                 || b.front().seqnum < best->second.front().seqnum) {
+        best = it;
+      }
+    }
+    if (best == buckets_.end()) return nullptr;
+
+    T* t = best->second.front().item;
+    best->second.pop_front();
+    if (best->second.empty()) buckets_.erase(best);
+    --size_;
+    return t;
+  }
+
+  /**
+   * Remove every request matching the message signature and hand them
+   * to fn in posting order.
+   */
+  template <class Fn>
+  void popAll(MPI_Comm comm, int source, int tag, Fn fn) {
+    if (size_ == 0) return;
+
+    std::vector<Entry> matched;
+    for (const MatchKey& key : candidates(comm, source, tag)) {
+      auto it = buckets_.find(key);
+      if (it == buckets_.end()) continue;
+      matched.insert(matched.end(), it->second.begin(), it->second.end());
+      buckets_.erase(it);
+    }
+    size_ -= matched.size();
+    std::sort(matched.begin(), matched.end(), [](const Entry& a, const Entry& b){
+      return a.seqnum < b.seqnum;
+    });
+    for (Entry& e : matched) fn(e.item);
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  struct Entry {
+    T* item;
+    uint64_t seqnum;
+  };
+
+  using Bucket = std::deque<Entry>;
+
+  static std::array<MatchKey,4> candidates(MPI_Comm comm, int source, int tag) {
+    return {{ {comm, source, tag}, {comm, source, MPI_ANY_TAG},
+              {comm, MPI_ANY_SOURCE, tag}, {comm, MPI_ANY_SOURCE, MPI_ANY_TAG} }};
+  }
+
+  std::unordered_map<MatchKey, Bucket, MatchKeyHash> buckets_;
+  uint64_t seqnum_ = 0;
+  size_t size_ = 0;
+};
+
+/**
+ * Unexpected messages waiting for a receive or probe. Each message is linked
+ * into the bucket of every signature that can match it, so any request,
+ * wildcard or not, finds the oldest matching message at the front of a
+ * single bucket.
+ */
+class MessageMatchQueue
+{
+ public:
+  ~MessageMatchQueue() {
+    for (auto& pair : buckets_) {
+      // every node is in exactly one exact bucket
+      if (pair.first.source == MPI_ANY_SOURCE || pair.first.tag == MPI_ANY_TAG) continue;
+      for (Node* n : pair.second) delete n;
+    }
+  }
+
+  void push(MpiMessage* msg) {
+    Node* n = new Node;
+    n->msg = msg;
+    int i = 0;
+    for (const MatchKey& key : signatures(msg)) {
+      Bucket& b = buckets_[key];
+      n->keys[i] = key;
+      n->pos[i] = b.insert(b.end(), n);
+      ++i;
+    }
+    ++size_;
+  }
+
+  /** The oldest message matching the request signature, left in the queue */
+  MpiMessage* find(MPI_Comm comm, int source, int tag) const {
+    auto it = buckets_.find(MatchKey{comm, source, tag});
+    return it == buckets_.end() ? nullptr : it->second.front()->msg;
+  }
+
+  /** Remove and return the oldest message matching the request signature */
+  MpiMessage* pop(MPI_Comm comm, int source, int tag) {
+    auto it = buckets_.find(MatchKey{comm, source, tag});
+    if (it == buckets_.end()) return nullptr;
+
+    Node* n = it->second.front();
+    MpiMessage* msg = n->msg;
+    for (int i=0; i < 4; ++i) {
+      auto bit = buckets_.find(n->keys[i]);
+      bit->second.erase(n->pos[i]);
+      if (bit->second.empty()) buckets_.erase(bit);
+    }
+    delete n;
+    --size_;
+    return msg;
+  }
+
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+ private:
+  struct Node;
+  using Bucket = std::list<Node*>;
+
+  struct Node {
+    MpiMessage* msg;
+    MatchKey keys[4];
+    Bucket::iterator pos[4];
+  };
+
+  static std::array<MatchKey,4> signatures(MpiMessage* msg) {
+    MPI_Comm comm = msg->comm();
+    int source = msg->srcRank();
+    int tag = msg->tag();
+    return {{ {comm, source, tag}, {comm, source, MPI_ANY_TAG},
+              {comm, MPI_ANY_SOURCE, tag}, {comm, MPI_ANY_SOURCE, MPI_ANY_TAG} }};
+  }
+
+  std::unordered_map<MatchKey, Bucket, MatchKeyHash> buckets_;
+  size_t size_ = 0;
+};
+
+}
@@ -201,18 +201,16 @@ MpiQueue::send(MpiRequest *key, int count, MPI_Datatype type,
 MpiMessage*
 MpiQueue::findMatchingRecv(MpiQueueRecvRequest* req)
 {
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req->matches(mess)) {
+  MpiMessage* mess = need_recv_match_.pop(req->comm_, req->source_, req->tag_);
+  if (mess) {
 //      mpi_queue_debug("matched recv tag=%s,src=%s on comm=%s to send %s",
 //        api_->tagStr(req->tag_).c_str(),
 //        api_->srcStr(req->source_).c_str(),
 //        api_->commStr(req->comm_).c_str(),
 //        mess->toString().c_str());
-
-      need_recv_match_.erase(it);
-      return mess;
-    }
+    //the signature already matches, this checks the buffer size
+    req->matches(mess);
+    return mess;
   }
 //  mpi_queue_debug("could not match recv tag=%s, src=%s to any of %d sends on comm=%s",
 //    api_->tagStr(req->tag_).c_str(),
@@ -220,7 +218,7 @@ MpiQueue::findMatchingRecv(MpiQueueRecvRequest* req)
 //    need_recv_match_.size(),
 //    api_->commStr(req->comm_).c_str());
 
-  need_send_match_.push_back(req);
+  need_send_match_.push(req, req->comm_, req->source_, req->tag_);
   return nullptr;
 }
 
@@ -271,16 +269,14 @@ MpiQueue::probe(MpiRequest* key, MpiComm* comm,
 
   mpi_queue_probe_request* req = new mpi_queue_probe_request(key, comm->id(), source, tag);
   // Figure out whether we already have a matching message.
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req->matches(mess)){
-      // We're good to go.
-      req->complete(mess);
-      return;
-    }
+  MpiMessage* mess = need_recv_match_.find(comm->id(), source, tag);
+  if (mess) {
+    // We're good to go.
+    req->complete(mess);
+    return;
   }
   // If we get here, we still need to wait for the message.
-  probelist_.push_back(req);
+  probelist_.push(req, comm->id(), source, tag);
 }
 
 //
@@ -296,14 +292,11 @@ MpiQueue::iprobe(MpiComm* comm,
 //    api_->srcStr(source).c_str(), api_->tagStr(tag).c_str(),
 //    api_->commStr(comm).c_str());
 
-  mpi_queue_probe_request req(NULL, comm->id(), source, tag);
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req.matches(mess)) {
-      // This is it
-      if (stat != MPI_STATUS_IGNORE) mess->buildStatus(stat);
-      return true;
-    }
+  MpiMessage* mess = need_recv_match_.find(comm->id(), source, tag);
+  if (mess) {
+    // This is it
+    if (stat != MPI_STATUS_IGNORE) mess->buildStatus(stat);
+    return true;
   }
   return false;
 }
@@ -311,18 +304,14 @@ MpiQueue::iprobe(MpiComm* comm,
 MpiQueueRecvRequest*
 MpiQueue::findMatchingRecv(MpiMessage* message)
 {
-  auto end = need_send_match_.end();
-  for (auto it = need_send_match_.begin(); it != end;) {
-    auto* req = *it;
-    auto tmp = it++;
-    if (req->isCancelled()) {
-      need_send_match_.erase(tmp);
-    } else if (req->matches(message)) {
-      need_send_match_.erase(tmp);
-      return req;
-    }
+  auto* req = need_send_match_.pop(message->comm(), message->srcRank(), message->tag(),
+                                   [](MpiQueueRecvRequest* r){ return r->isCancelled(); });
+  if (req) {
+    //the signature already matches, this checks the buffer size
+    req->matches(message);
+    return req;
   }
-  need_recv_match_.push_back(message);
+  need_recv_match_.push(message);
   return nullptr;
 }
 
@@ -400,17 +389,11 @@ MpiQueue::incomingPt2ptMessage(Iris::sumi::Message* m)
 void
 MpiQueue::notifyProbes(MpiMessage* message)
 {
-  auto pit = probelist_.begin();
-  auto pend = probelist_.end();
-  while (pit != pend) {
-    auto tmp = pit++;
-    mpi_queue_probe_request* preq = *tmp;
-    if (preq->matches(message)){
-      probelist_.erase(tmp);
-      preq->complete(message);
-      delete preq;
-    }
-  }
+  probelist_.popAll(message->comm(), message->srcRank(), message->tag(),
+                    [message](mpi_queue_probe_request* preq){
+    preq->complete(message);
+    delete preq;
+  });
 }
 
 void
@@ -60,6 +60,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <mpi_queue/mpi_queue_recv_request_fwd.h>
 #include <mpi_queue/mpi_queue_probe_request.h>
+#include <mpi_queue/mpi_match_queue.h>
 
 #include <sst/core/params.h>
 
@@ -190,13 +191,14 @@ class MpiQueue
   std::unordered_map<TaskId, hold_list_t> held_;
 
   /// Inbound messages waiting for a matching receive request.
-  std::list<MpiMessage*> need_recv_match_;
-  std::list<MpiQueueRecvRequest*> need_send_match_;
+  MessageMatchQueue need_recv_match_;
+  /// Posted receives waiting for a matching inbound message.
+  WildcardMatchQueue<MpiQueueRecvRequest> need_send_match_;
 
   std::vector<MpiProtocol*> protocols_;
 
   /// Probe requests watching
-  std::list<SST::MASKMPI::mpi_queue_probe_request*> probelist_;
+  WildcardMatchQueue<SST::MASKMPI::mpi_queue_probe_request> probelist_;
 
   progress_queue queue_;
 
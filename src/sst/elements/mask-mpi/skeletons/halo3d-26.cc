@@ -44,6 +44,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <mask_mpi.h>
 #include <mercury/common/skeleton.h>
+#include <mercury/libraries/compute/compute_api.h>
 //#include <sstmac/replacements/sys/time.h>
 //#include <sstmac/replacements/time.h>
 
@@ -98,6 +99,10 @@ int USER_MAIN(int argc, char* argv[]) {
 
   long sleep = 1000;
 
+  // per-cell stencil cost charged to the node compute model
+  long flops_per_cell = 0;
+  long bytes_per_cell = 0;
+
   int print = 0;
 
   for (int i = 1; i < argc; i++) {
@@ -200,6 +205,28 @@ int USER_MAIN(int argc, char* argv[]) {
 
       sleep = atol(argv[i + 1]);
       ++i;
+    } else if (strcmp(argv[i], "-flops") == 0) {
+      if (i == argc) {
+        if (me == 0) {
+          fprintf(stderr, "Error: specified -flops without a value.\n");
+        }
+
+        exit(-1);
+      }
+
+      flops_per_cell = atol(argv[i + 1]);
+      ++i;
+    } else if (strcmp(argv[i], "-bytes") == 0) {
+      if (i == argc) {
+        if (me == 0) {
+          fprintf(stderr, "Error: specified -bytes without a value.\n");
+        }
+
+        exit(-1);
+      }
+
+      bytes_per_cell = atol(argv[i + 1]);
+      ++i;
     } else if (strcmp(argv[i], "-print") == 0){
       print = atoi(argv[i + 1]);
       ++i;
@@ -230,6 +257,8 @@ int USER_MAIN(int argc, char* argv[]) {
     printf("# Iterations:             %7d\n", repeats);
     printf("# Variables:              %7d\n", vars);
     printf("# Sleep:                  %7ld\n", sleep);
+    printf("# Flops per cell:         %7ld\n", flops_per_cell);
+    printf("# Bytes per cell:         %7ld\n", bytes_per_cell);
   }
 
   int posX, posY, posZ;
@@ -322,6 +351,12 @@ int USER_MAIN(int argc, char* argv[]) {
         ;
     }
 
+    if (flops_per_cell || bytes_per_cell) {
+      uint64_t cells = uint64_t(nx) * ny * nz * vars;
+      SST::Hg::computeApi()->computeKernel(cells * flops_per_cell, 0,
+                                           cells * bytes_per_cell);
+    }
+
     MPI_Irecv(recvBuffer, ny * nz * vars, MPI_DOUBLE, xFaceUp, 1000,
               halo_comm, &requests[requestcount++]);
     MPI_Isend(sendBuffer, ny * nz * vars, MPI_DOUBLE, xFaceUp, 1000,
@@ -0,0 +1,159 @@
+/**
+Copyright 2009-2025 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2025, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+/**
+ * Microbenchmark for the pt2pt matching queues. Every rank sends depth
+ * messages with distinct tags to rank 0, which receives them in the opposite
+ * order so each arrival (or each receive, for unexpected messages) matches
+ * the entry furthest from the front of a linear queue. Rank 0 reports the
+ * host time spent per message so the cost can be compared across depths.
+ *
+ * Options:
+ *   -depths d1,d2,...  queue depths per sender (default 16,64,256,1024,4096)
+ *   -anysource         post the receives with MPI_ANY_SOURCE
+ */
+
+#define ssthg_app_name matchdepth
+
+#include <mask_mpi.h>
+#include <mercury/common/skeleton.h>
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+static double
+elapsedUs(std::chrono::steady_clock::time_point start)
+{
+  auto t = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::micro>(t).count();
+}
+
+/**
+ * @param unexpected  If true, all messages are sent before any receive is posted
+ * @return host microseconds rank 0 spent in the receive phase
+ */
+static double
+runPhase(int rank, int size, int depth, bool unexpected, bool anysource)
+{
+  int nrecv = depth * (size - 1);
+  std::vector<MPI_Request> reqs(rank == 0 ? nrecv : depth);
+  double us = 0;
+
+  if (rank != 0){
+    for (int t=0; t < depth; ++t){
+      MPI_Isend(nullptr, 1, MPI_INT, 0, t, MPI_COMM_WORLD, &reqs[t]);
+    }
+    if (unexpected) MPI_Barrier(MPI_COMM_WORLD);
+    MPI_Waitall(depth, reqs.data(), MPI_STATUSES_IGNORE);
+  } else {
+    //let every message land in the unexpected queue first
+    if (unexpected) MPI_Barrier(MPI_COMM_WORLD);
+    auto start = std::chrono::steady_clock::now();
+    int idx = 0;
+    for (int t=depth-1; t >= 0; --t){
+      for (int src=1; src < size; ++src){
+        int source = anysource ? MPI_ANY_SOURCE : src;
+        MPI_Irecv(nullptr, 1, MPI_INT, source, t, MPI_COMM_WORLD, &reqs[idx++]);
+      }
+    }
+    MPI_Waitall(nrecv, reqs.data(), MPI_STATUSES_IGNORE);
+    us = elapsedUs(start);
+  }
+  MPI_Barrier(MPI_COMM_WORLD);
+  return us;
+}
+
+int main(int argc, char** argv)
+{
+  MPI_Init(&argc, &argv);
+  int rank, size;
+  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+  std::vector<int> depths = {16, 64, 256, 1024, 4096};
+  bool anysource = false;
+  for (int i=1; i < argc; ++i){
+    if (strcmp(argv[i], "-depths") == 0 && i+1 < argc){
+      depths.clear();
+      //don't tokenize argv in place, the ranks may share it
+      const char* list = argv[++i];
+      while (*list){
+        char* end;
+        long depth = strtol(list, &end, 10);
+        if (end == list) break;
+        depths.push_back(depth);
+        list = *end == ',' ? end + 1 : end;
+      }
+    } else if (strcmp(argv[i], "-anysource") == 0){
+      anysource = true;
+    } else {
+      if (rank == 0) fprintf(stderr, "Unknown option: %s\n", argv[i]);
+      MPI_Abort(MPI_COMM_WORLD, 1);
+    }
+  }
+
+  if (size < 2){
+    if (rank == 0) fprintf(stderr, "matchdepth needs at least 2 ranks\n");
+    MPI_Abort(MPI_COMM_WORLD, 1);
+  }
+
+  if (rank == 0){
+    printf("# %8s %10s %16s %16s\n", "depth", "messages", "posted us/msg", "unexpected us/msg");
+  }
+
+  for (int depth : depths){
+    double posted = runPhase(rank, size, depth, false, anysource);
+    double unexp = runPhase(rank, size, depth, true, anysource);
+    if (rank == 0){
+      double nmsg = double(depth) * (size - 1);
+      printf("  %8d %10.0f %16.4f %16.4f\n", depth, nmsg, posted / nmsg, unexp / nmsg);
+    }
+  }
+
+  MPI_Finalize();
+  return 0;
+}
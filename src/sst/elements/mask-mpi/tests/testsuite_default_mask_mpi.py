@@ -1,5 +1,6 @@
 # -*- coding: utf-8 -*-
 import os
+import re
 import subprocess
 
 from sst_unittest import *
@@ -70,9 +71,84 @@ class testcase_mask_mpi(SSTTestCase):
             os.environ["SST_LIB_PATH"] = path + ":" + libdir
         self.mask_mpi_template("test_halo3d26")
 
+    def test_sendrecv_mt(self):
+        # Same run split over two threads, the process-wide state is shared between them
+        self._set_lib_path()
+        self.mask_mpi_template("test_sendrecv", threads=2)
+
+    def test_alltoall_mt(self):
+        # Same run split over two threads, the process-wide state is shared between them
+        self._set_lib_path()
+        self.mask_mpi_template("test_alltoall", threads=2)
+
+    def test_halo3d26_mt(self):
+        # Same run split over two threads, the process-wide state is shared between them
+        self._set_lib_path()
+        self.mask_mpi_template("test_halo3d26", threads=2)
+
+    def test_halo3d26_roofline(self):
+        # The simulated time depends on the model, so it is checked against
+        # the roofline bound instead of the reference file
+        self._set_lib_path()
+        outfile = self.mask_mpi_template("test_halo3d26_roofline", filterout="Simulation is complete")
+
+        with open(outfile) as fp:
+            match = re.search(r"simulated time: ([0-9.]+) (\w+)", fp.read())
+        self.assertTrue(match is not None, "Simulated time not found in {0}".format(outfile))
+        scale = { "s" : 1.0, "ms" : 1e-3, "us" : 1e-6, "ns" : 1e-9 }
+        sim_time = float(match.group(1)) * scale[match.group(2)]
+
+        # 10 iterations of 10x10x10 cells at 800B each can not stream
+        # faster than one 11.2 GB/s channel per rank
+        mem_bound = 10 * 1000 * 800 / 11.2e9
+        self.assertTrue(sim_time >= mem_bound,
+                        "Simulated time {0}s is below the roofline memory bound {1}s".format(sim_time, mem_bound))
+
+    def test_matchdepth(self):
+        # The per message costs are host timings, only the depth and message
+        # columns are compared against the reference
+        self._set_lib_path()
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        sdlfile = "{0}/test_matchdepth.py".format(test_path)
+        reffile = "{0}/refFiles/test_matchdepth.out".format(test_path)
+        outfile = "{0}/test_matchdepth.out".format(outdir)
+        cmpfile = "{0}/test_matchdepth.cmp".format(tmpdir)
+        errfile = "{0}/test_matchdepth.err".format(outdir)
+        mpioutfiles = "{0}/test_matchdepth.testfile".format(outdir)
+
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path)
+
+        testing_remove_component_warning_from_file(outfile)
+
+        with open(outfile) as fpin, open(cmpfile, "w") as fpout:
+            for line in fpin:
+                fields = line.split()
+                if len(fields) != 4 or not fields[0].isdigit():
+                    continue
+                for cost in fields[2:]:
+                    self.assertTrue(float(cost) >= 0, "Negative per message cost in {0}".format(line))
+                fpout.write("{0} {1}\n".format(fields[0], fields[1]))
+
+        cmp_result = testing_compare_diff("test_matchdepth", cmpfile, reffile)
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data("test_matchdepth")
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(cmpfile, reffile))
+
 #####
 
-    def mask_mpi_template(self, testcase, striptotail=0):
+    def _set_lib_path(self):
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+
+    def mask_mpi_template(self, testcase, striptotail=0, threads=None, filterout=None):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -80,21 +156,28 @@ class testcase_mask_mpi(SSTTestCase):
 
         # Set the various file paths
         testDataFileName="{0}".format(testcase)
+        runFileName = testDataFileName if threads is None else "{0}_mt{1}".format(testDataFileName, threads)
 
         sdlfile = "{0}/{1}.py".format(test_path, testDataFileName)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
-        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
-        tmpfile = "{0}/{1}.tmp".format(tmpdir, testDataFileName)
-        cmpfile = "{0}/{1}.cmp".format(tmpdir, testDataFileName)
-        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
-        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, runFileName)
+        tmpfile = "{0}/{1}.tmp".format(tmpdir, runFileName)
+        cmpfile = "{0}/{1}.cmp".format(tmpdir, runFileName)
+        errfile = "{0}/{1}.err".format(outdir, runFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path)
+        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, num_threads=threads, set_cwd=test_path)
 
         testing_remove_component_warning_from_file(outfile)
 
         # Copy the outfile to the cmpfile
-        os.system("cp {0} {1}".format(outfile, cmpfile))
+        if filterout is None:
+            os.system("cp {0} {1}".format(outfile, cmpfile))
+        else:
+            with open(outfile) as fpin, open(cmpfile, "w") as fpout:
+                for line in fpin:
+                    if filterout not in line:
+                        fpout.write(line)
 
         if striptotail == 1:
             # Post processing of the output data to scrub it into a format to compare
@@ -110,8 +193,9 @@ class testcase_mask_mpi(SSTTestCase):
         if os_test_file(errfile, "-s"):
             log_testing_note("hg test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
-        cmp_result = testing_compare_sorted_diff(testcase, cmpfile, reffile)
+        cmp_result = testing_compare_sorted_diff(runFileName, cmpfile, reffile)
         if (cmp_result == False):
-            diffdata = testing_get_diff_data(testcase)
+            diffdata = testing_get_diff_data(runFileName)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(cmpfile, reffile))
+        return outfile
@@ -104,12 +104,14 @@ bool Cache::clockTick(Cycle_t time) {
     // Drain any outgoing messages
     bool idle = coherenceMgr_->sendOutgoingEvents();
 
+    bool linksIdle = true;
     if (clockUpLink_) {
-        idle &= linkUp_->clock();
+        linksIdle &= linkUp_->clock();
     }
     if (clockDownLink_) {
-        idle &= linkDown_->clock();
+        linksIdle &= linkDown_->clock();
     }
+    idle &= linksIdle;
 
     // MSHR occupancy
     statMSHROccupancy->addData(mshr_->getSize());
@@ -203,6 +205,17 @@ bool Cache::clockTick(Cycle_t time) {
         return true;
     }
 
+    // In cycle-free mode, if the only pending work is outgoing events waiting
+    // out their access latency, sleep until the cycle before the first is due
+    if (cycleFree_ && linksIdle && eventBuffer_.empty() && retryBuffer_.empty()) {
+        Cycle_t next = coherenceMgr_->getNextDeliveryTime();
+        if (next > timestamp_ + 1) {
+            turnClockOff();
+            cycleFreeSelfLink_->send(next - timestamp_ - 1, nullptr);
+            return true;
+        }
+    }
+
     // Keep the clock on
     return false;
 }
@@ -218,6 +231,11 @@ void Cache::turnClockOn() {
     clockIsOn_ = true;
 }
 
+/* Handler for cycleFreeSelfLink_, restarts the clock so it ticks on the cycle an outgoing event is due */
+void Cache::cycleFreeWakeup(SST::Event * ev) {
+    turnClockOn();
+}
+
 void Cache::turnClockOff() {
     //dbg_->debug(_L3_, "%s turning clock OFF at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), getCurrentSimCycle(), timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = false;
@@ -686,6 +704,7 @@ void Cache::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(linkDown_);
     SST_SER(prefetchSelfLink_);
     SST_SER(timeoutSelfLink_);
+    SST_SER(cycleFreeSelfLink_);
     SST_SER(mshr_);
     SST_SER(coherenceMgr_);
     SST_SER(init_requests_);
@@ -701,6 +720,7 @@ void Cache::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(clockHandler_);
     SST_SER(defaultTimeBase_);
     SST_SER(clockIsOn_);
+    SST_SER(cycleFree_);
     SST_SER(clockUpLink_);
     SST_SER(clockDownLink_);
     SST_SER(lastActiveClockCycle_);
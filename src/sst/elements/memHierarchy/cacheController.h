@@ -87,6 +87,7 @@ public:
             {"verbose",                 "(uint) Output verbosity for warnings/errors. 0[fatal error only], 1[warnings], 2[full state dump on fatal error]","1"},
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
+            {"cycle_free",              "(bool) Instead of ticking every cycle while responses wait out their access latency, turn the clock off and schedule a single wakeup for the cycle the next outgoing event is due. Results are identical; only simulation speed changes.", "false"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
             {"node",			        "(uint) Node number in multinode environment", "0"})
 
@@ -256,6 +257,7 @@ private:
     // Clock helpers - turn clock on & off
     void turnClockOn();
     void turnClockOff();
+    void cycleFreeWakeup(SST::Event * ev);
 
     // Trigger timeouts if events sit in MSHR for too long
     void timeoutWakeup(SST::Event * ev);
@@ -275,6 +277,7 @@ private:
     MemLinkBase* linkDown_ = nullptr;       // link manager down (towards memory)
     Link* prefetchSelfLink_ = nullptr;      // link to delay prefetch request receive
     Link* timeoutSelfLink_ = nullptr;       // link to check for timeouts (possible deadlock)
+    Link* cycleFreeSelfLink_ = nullptr;     // link to wake the clock when an outgoing event is due
     MSHR* mshr_;                            // MSHR
     CoherenceController* coherenceMgr_;     // Coherence protocol - where most of the event handling happens
     std::map<MemEventBase::id_type, std::string> init_requests_;    // Event response routing for untimed/init events
@@ -295,6 +298,7 @@ private:
     Clock::HandlerBase*     clockHandler_;
     TimeConverter           defaultTimeBase_;
     bool                    clockIsOn_;     // Whether clock is on or off
+    bool                    cycleFree_;     // Whether to sleep through cycles that only wait on outgoing latency
     bool                    clockUpLink_;   // Whether link actually needs clock() called or not
     bool                    clockDownLink_; // Whether link actually needs clock() called or not
     SimTime_t               lastActiveClockCycle_;  // Cycle we turned the clock off at - for re-syncing stats
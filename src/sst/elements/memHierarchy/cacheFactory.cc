@@ -793,6 +793,10 @@ void Cache::createClock(Params &params) {
     timestamp_ = 0;
     lastActiveClockCycle_ = 0;
 
+    cycleFree_ = params.find<bool>("cycle_free", false);
+    if (cycleFree_)
+        cycleFreeSelfLink_ = configureSelfLink("cyclefree", frequency, new Event::Handler2<Cache, &Cache::cycleFreeWakeup>(this));
+
     // Deadlock timeout
     timeout_ = params.find<SimTime_t>("maxRequestDelay", 0);
     if (timeout_ > 0) {
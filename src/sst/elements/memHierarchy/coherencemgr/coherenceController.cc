@@ -16,6 +16,8 @@
 
 #include <sst/core/sst_config.h>
 
+#include <limits>
+
 #include "coherencemgr/coherenceController.h"
 
 using namespace SST;
@@ -428,6 +430,16 @@ bool CoherenceController::checkIdle() {
     return outgoing_event_queue_down_.empty() && outgoing_event_queue_up_.empty();
 }
 
+/* Only the queue heads matter: sendOutgoingEvents() stops at the first event that is not ready */
+Cycle_t CoherenceController::getNextDeliveryTime() {
+    Cycle_t next = std::numeric_limits<Cycle_t>::max();
+    if (!outgoing_event_queue_down_.empty())
+        next = outgoing_event_queue_down_.front().delivery_time;
+    if (!outgoing_event_queue_up_.empty())
+        next = std::min(next, (Cycle_t)outgoing_event_queue_up_.front().delivery_time);
+    return next;
+}
+
 
 /* Forward an event using memory address to locate a destination. */
 void CoherenceController::forwardByAddress(MemEventBase * event) {
@@ -117,6 +117,9 @@ public:
     /* Check whether the event queues are empty/subcomponent is doing anything */
     bool checkIdle();
 
+    /* Earliest cycle at which an outgoing event can be sent, or max Cycle_t if none are queued */
+    Cycle_t getNextDeliveryTime();
+
     /* Get which bank an address maps to (call through to cache array) */
     virtual Addr getBank(Addr addr) = 0;
 
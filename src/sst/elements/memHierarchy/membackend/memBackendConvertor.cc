@@ -15,6 +15,7 @@
 
 
 #include <sst_config.h>
+#include <algorithm>
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memoryController.h"
 #include "membackend/memBackendConvertor.h"
@@ -120,6 +121,8 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
+            if ( req->isMemEv() )
+                dequeueLine( static_cast<MemReq*>(req) );
             m_requestQueue.pop_front();
         }
     }
@@ -187,7 +190,8 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             sendResponse(creq->getEvId(), flags);
         } else {
 
-            MemEvent* event = static_cast<MemReq*>(req)->getMemEvent();
+            MemReq* mreq = static_cast<MemReq*>(req);
+            MemEvent* event = mreq->getMemEvent();
 
             Debug(_L10_,"doResponse req is done. %s\n", event->getBriefString().c_str());
 
@@ -196,23 +200,21 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             doResponseStat( event->getCmd(), latency );
 
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
             sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
 
             // TODO clock responses
             // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
+            std::vector<MemEvent*>& flushes = mreq->getFlushes();
+            if (!flushes.empty()) {
+                // Respond in event ID order
+                std::sort(flushes.begin(), flushes.end(), memEventCmp());
+                for (MemEvent* flush : flushes) {
+                    auto it = m_waitingFlushes.find(flush);
+                    if (--(it->second) == 0) {
                         sendResponse(flush->getID(), flush->getFlags());
-                        m_waitingFlushes.erase(flush);
+                        m_waitingFlushes.erase(it);
                     }
                 }
-                m_dependentRequests.erase(evID);
             }
         }
         delete req;
@@ -260,8 +262,8 @@ void MemBackendConvertor::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(m_requestQueue);
     SST_SER(m_pendingRequests);
     SST_SER(m_frontendRequestWidth);
+    SST_SER(m_queuedLines);
     SST_SER(m_waitingFlushes);
-    SST_SER(m_dependentRequests);
     SST_SER(stat_GetSLatency);
     SST_SER(stat_GetSXLatency);
     SST_SER(stat_GetXLatency);
@@ -21,6 +21,10 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
@@ -149,6 +153,10 @@ class MemBackendConvertor : public SubComponent {
             ++m_numReq;
         }
         void decrement( ) { --m_numReq; }
+
+        /* Flushes that cannot complete until this request does */
+        void addFlush( MemEvent* flush ) { m_flushes.push_back(flush); }
+        std::vector<MemEvent*>& getFlushes() { return m_flushes; }
         bool issueDone() {
             return m_offset >= m_event->getSize();
         }
@@ -169,12 +177,14 @@ class MemBackendConvertor : public SubComponent {
             SST_SER(m_event);
             SST_SER(m_offset);
             SST_SER(m_numReq);
+            SST_SER(m_flushes);
         }
         ImplementSerializable(SST::MemHierarchy::MemBackendConvertor::MemReq)
       private:
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        std::vector<MemEvent*> m_flushes;
     };
 
   public:
@@ -234,37 +244,30 @@ protected:
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
-            // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
-            for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
-                if (!(*it)->isMemEv())
-                    continue;
-                MemReq * mr = static_cast<MemReq*>(*it);
-                if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
-                }
-            }
-
-            if (dependsOn.empty()) return false;
-            m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
+            // A flush waits for every request to its line that has not finished issuing
+            auto line = m_queuedLines.find(ev->getBaseAddr());
+            if (line == m_queuedLines.end()) return false;
+            for (MemReq* mr : line->second)
+                mr->addFlush(ev);
+            m_waitingFlushes[ev] = line->second.size();
             return true;
         }
-
         uint32_t id = genReqId();
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
+        m_queuedLines[ev->getBaseAddr()].push_back( req );
         m_pendingRequests[id] = req;
         return true;
     }
 
+    /* Called as a request leaves m_requestQueue. Requests leave in order, so it is the oldest for its line */
+    void dequeueLine( MemReq* req ) {
+        auto line = m_queuedLines.find(req->baseAddr());
+        line->second.pop_front();
+        if (line->second.empty())
+            m_queuedLines.erase(line);
+    }
+
     inline void doClockStat( ) {
         stat_totalCycles->addData(1);
     }
@@ -333,8 +336,8 @@ protected:
     PendingRequests         m_pendingRequests;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    std::unordered_map<Addr, std::deque<MemReq*> > m_queuedLines;  // Requests in m_requestQueue, by line
+    std::unordered_map<MemEvent*, uint32_t> m_waitingFlushes;         // Number of requests each flush still waits on
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
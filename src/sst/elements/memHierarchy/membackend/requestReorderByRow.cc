@@ -69,9 +69,9 @@ RequestReorderRow::RequestReorderRow(ComponentId_t id, Params &params) : SimpleM
     bankMask = banks - 1;
     rowOffset = log2Of(rowSize.getRoundedValue());
     lineOffset = log2Of(requestSize.getRoundedValue());
+    requestQueue.resize(banks);
+    rowCount.resize(banks);
     for (unsigned int i = 0; i < banks; i++) {
-        std::list<Req >* bankList = new std::list<Req>;
-        requestQueue.push_back(bankList);
         lastRow.push_back(-1);  // No last request to this bank
         reorderCount.push_back(maxReqsPerRow);  // No requests reordered to this row
     }
@@ -84,10 +84,18 @@ bool RequestReorderRow::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned
 #endif
     int bank = (addr >> lineOffset) & bankMask;
 
-    requestQueue[bank]->push_back(Req(id,addr,isWrite,numBytes));
+    requestQueue[bank].push_back(Req(id,addr,isWrite,numBytes));
+    rowCount[bank][addr >> rowOffset]++;
     return true;
 }
 
+void RequestReorderRow::popRequest(unsigned int bank, std::list<Req>::iterator it) {
+    std::unordered_map<unsigned int, unsigned int>::iterator count = rowCount[bank].find(it->addr >> rowOffset);
+    if (--(count->second) == 0)
+        rowCount[bank].erase(count);
+    requestQueue[bank].erase(it);
+}
+
 /*
  * Issue as many requests as we can up to requestsPerCycle
  * by searching up to searchWindowSize requests
@@ -101,16 +109,17 @@ bool RequestReorderRow::clock(Cycle_t cycle) {
         // For current bank
         unsigned int bank = nextBank;
         for (unsigned int i = 0; i < banks; i++) {
-            if (requestQueue[bank]->empty()) {
+            if (requestQueue[bank].empty()) {
                 bank = (bank + 1) % banks;
                 continue;
             }
 
             // Decide whether to try to re-order a request to this bank or issue a new row
+            // Only search the bank's queue if it actually holds a request to the open row
             bool reorderIssued = false;
-            if (reorderCount[bank] != maxReqsPerRow) {
-                std::list<Req>* bankList = requestQueue[bank];
-                for (std::list<Req>::iterator it = bankList->begin(); it != bankList->end(); it++) {
+            if (reorderCount[bank] != maxReqsPerRow && rowCount[bank].find(lastRow[bank]) != rowCount[bank].end()) {
+                std::list<Req>& bankList = requestQueue[bank];
+                for (std::list<Req>::iterator it = bankList.begin(); it != bankList.end(); it++) {
                     unsigned int row = (*it).addr >> rowOffset;
 
                     if (row == lastRow[bank]) {
@@ -121,7 +130,7 @@ bool RequestReorderRow::clock(Cycle_t cycle) {
                             reqsIssuedThisCycle++;
                             nextBank = (bank + 1) % banks;
                             reorderCount[bank]++;
-                            bankList->erase(it);
+                            popRequest(bank, it);
                             break;
                         } else {
                             break;
@@ -132,13 +141,13 @@ bool RequestReorderRow::clock(Cycle_t cycle) {
 
             if (!reorderIssued) {
                 // Try to issue oldest request
-				Req& req = *requestQueue[bank]->begin();
+                Req& req = requestQueue[bank].front();
                 if (backend->issueRequest( req.id, req.addr, req.isWrite, req.numBytes ) ) {
                     reqsIssuedThisCycle++;
                     nextBank = (bank + 1) % banks;
                     reorderCount[bank] = 1;
                     lastRow[bank] = req.addr >> rowOffset;
-                    requestQueue[bank]->erase(requestQueue[bank]->begin());
+                    popRequest(bank, requestQueue[bank].begin());
                 }
             }
 
@@ -19,6 +19,7 @@
 
 #include "sst/elements/memHierarchy/membackend/memBackend.h"
 #include <list>
+#include <unordered_map>
 #include <vector>
 
 namespace SST {
@@ -73,7 +74,10 @@ private:
     unsigned int rowOffset;     // Offset for determining request row
     unsigned int lineOffset;    // Offset for determining line (needed for finding bank)
     int reqsPerCycle;           // Number of requests to issue per cycle (max) -> memCtrl limits how many we accept
-    std::vector< std::list<Req>* > requestQueue;
+    void popRequest( unsigned int bank, std::list<Req>::iterator it );
+
+    std::vector< std::list<Req> > requestQueue;
+    std::vector< std::unordered_map<unsigned int, unsigned int> > rowCount; // Queued requests per row, per bank
     std::vector<unsigned int> reorderCount;
     std::vector<unsigned int> lastRow;
 
@@ -82,11 +82,16 @@ bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBy
 bool TimingDRAM::clock(Cycle_t cycle)
 {
     output->verbose(CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",m_cycle);
+    bool idle = true;
     for ( unsigned i = 0; i < m_channels.size(); i++ ) {
         m_channels[i]->clock(m_cycle);
+        idle &= m_channels[i]->isIdle();
     }
     ++m_cycle;
-    return false;
+
+    // m_cycle only counts clock calls, so letting the clock turn off while
+    // nothing is outstanding does not change relative timing
+    return idle;
 }
 
 //==================================================================================
@@ -94,7 +99,8 @@ bool TimingDRAM::clock(Cycle_t cycle)
 //==================================================================================
 
 TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handler, Params& params, unsigned mc, unsigned myNum, Output* output, AddrMapper* mapper ) :
-    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0)
+    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0),
+    m_nextActionCycle(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Channel:@p():@l:mc=" << mc << ":chan=" << myNum << ": ";
@@ -123,29 +129,28 @@ TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handl
 
 void TimingDRAM::Channel::clock( SimTime_t cycle )
 {
+    /* No command retires, no bank can issue and no bank changes state before m_nextActionCycle */
+    if ( cycle < m_nextActionCycle ) {
+        return;
+    }
+
     if (mem_h_is_debug)
         m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",cycle);
 
-    std::list<Cmd*>::iterator iter = m_issuedCmds.begin();
-
-    /* Check all outstanding commands to see if anything is finished */
-    while ( iter != m_issuedCmds.end() ) {
-        if ( (*iter)->isDone(cycle) ) {
-            Cmd* cmd = (*iter);
-
-            if (mem_h_is_debug)
-                m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
-                        cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
+    /* Retire finished commands, in issue order */
+    while ( ! m_issuedCmds.empty() && m_issuedCmds.begin()->first <= cycle ) {
+        Cmd* cmd = m_issuedCmds.begin()->second;
 
-            if (cmd->getTrans() != nullptr) {
-                m_retiredTrans.push(cmd->getTrans());
-            }
+        if (mem_h_is_debug)
+            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
+                    cycle, cmd->getName(), cmd->getRank(), cmd->getBank(), cmd->getRow());
 
-            delete (*iter);
-            iter = m_issuedCmds.erase(iter);
-        } else {
-            ++iter;
+        if (cmd->getTrans() != nullptr) {
+            m_retiredTrans.push(cmd->getTrans());
         }
+
+        cmd->retire();
+        m_issuedCmds.erase(m_issuedCmds.begin());
     }
 
     /* Return a response if possible */
@@ -155,7 +160,7 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
                     m_retiredTrans.front()->id, m_retiredTrans.front()->bank, m_retiredTrans.front()->addr, m_retiredTrans.front()->createTime);
 
         m_responseHandler(m_retiredTrans.front()->id);
-        delete m_retiredTrans.front();
+        m_transPool.push_back( m_retiredTrans.front() );
 
         m_retiredTrans.pop();
         m_pendingCount--;
@@ -166,11 +171,25 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     if ( cmd ) {
         if (mem_h_is_debug)
             m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " issue %s for rank=%d bank=%d row=%d\n",
-                    cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
+                    cycle, cmd->getName(), cmd->getRank(), cmd->getBank(), cmd->getRow());
 
         m_dataBusAvailCycle = cmd->issue();
 
-        m_issuedCmds.push_back(cmd);
+        m_issuedCmds.insert( std::make_pair( cmd->retireCycle(), cmd ) );
+    }
+
+    /* Work out when the next clock can do something */
+    if ( ! m_retiredTrans.empty() ) {
+        m_nextActionCycle = cycle + 1;
+        return;
+    }
+
+    m_nextActionCycle = m_issuedCmds.empty() ? NEVER : m_issuedCmds.begin()->first;
+    for ( unsigned i = 0; i < m_ranks.size() && m_nextActionCycle > cycle + 1; i++ ) {
+        SimTime_t next = m_ranks[i]->nextActionCycle( cycle + 1, m_dataBusAvailCycle );
+        if ( next < m_nextActionCycle ) {
+            m_nextActionCycle = next;
+        }
     }
 }
 
@@ -260,6 +279,30 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     return nullptr;
 }
 
+SimTime_t TimingDRAM::Rank::nextActionCycle( SimTime_t cycle, SimTime_t dataBusAvailCycle )
+{
+    SimTime_t next = NEVER;
+
+    std::set<unsigned>::iterator iter = m_banksActive.begin();
+    while ( iter != m_banksActive.end() ) {
+        // Idle banks have nothing to do; popCmd() would drop them on its next visit
+        if ( m_banks[*iter]->isIdle() ) {
+            iter = m_banksActive.erase(iter);
+            continue;
+        }
+
+        SimTime_t bankNext = m_banks[*iter]->nextActionCycle( cycle, dataBusAvailCycle );
+        if ( bankNext < next ) {
+            next = bankNext;
+            if ( next == cycle ) {
+                break;
+            }
+        }
+        ++iter;
+    }
+    return next;
+}
+
 //==================================================================================
 // Bank
 //==================================================================================
@@ -310,16 +353,57 @@ TimingDRAM::Cmd* TimingDRAM::Bank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     if ( ! m_cmdQ.empty() && m_cmdQ.front()->canIssue( cycle, dataBusAvailCycle ) ) {
         cmd = m_cmdQ.front();
         if (mem_h_is_debug)
-            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "%s row=%d\n",cmd->getName().c_str(), cmd->getRow() );
+            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "%s row=%d\n",cmd->getName(), cmd->getRow() );
         m_cmdQ.pop_front();
     }
     return cmd;
 }
 
+SimTime_t TimingDRAM::Bank::nextActionCycle( SimTime_t cycle, SimTime_t dataBusAvailCycle )
+{
+    // update() will pull in a transaction
+    if ( ! m_transQ->empty() ) {
+        return cycle;
+    }
+
+    // update() will consult the page policy, which may be counting cycles
+    if ( nullptr == m_lastCmd && m_row != -1 && m_pagePolicy->canClose() ) {
+        return cycle;
+    }
+
+    if ( m_cmdQ.empty() ) {
+        return NEVER;
+    }
+
+    SimTime_t earliest = m_cmdQ.front()->earliestIssue( dataBusAvailCycle );
+    return earliest < cycle ? cycle : earliest;
+}
+
+TimingDRAM::Cmd* TimingDRAM::Bank::allocCmd()
+{
+    if ( m_cmdPool.empty() ) {
+        return new Cmd();
+    }
+    Cmd* cmd = m_cmdPool.back();
+    m_cmdPool.pop_back();
+    return cmd;
+}
+
+TimingDRAM::Bank::~Bank()
+{
+    for ( unsigned i = 0; i < m_cmdPool.size(); i++ ) {
+        delete m_cmdPool[i];
+    }
+    for ( unsigned i = 0; i < m_cmdQ.size(); i++ ) {
+        delete m_cmdQ[i];
+    }
+}
+
 void TimingDRAM::Bank::update( SimTime_t current )
 {
     if ( nullptr == m_lastCmd && m_row != -1 && m_pagePolicy->shouldClose( current ) ) {
-        Cmd* cmd = new Cmd( this, Cmd::PRE, m_trp_lat );
+        Cmd* cmd = allocCmd();
+        cmd->init( this, Cmd::PRE, m_trp_lat );
         m_cmdQ.push_back(cmd);
         m_row = -1;
         return;
@@ -339,16 +423,19 @@ void TimingDRAM::Bank::update( SimTime_t current )
 
     if ( trans->row != m_row ) {
         if ( m_row != -1 ) {
-            cmd = new Cmd( this, Cmd::PRE, m_trp_lat );
+            cmd = allocCmd();
+            cmd->init( this, Cmd::PRE, m_trp_lat );
             m_cmdQ.push_back(cmd);
         }
 
-        cmd = new Cmd( this, Cmd::ACT, m_rcd_lat, trans->row );
+        cmd = allocCmd();
+        cmd->init( this, Cmd::ACT, m_rcd_lat, trans->row );
         m_cmdQ.push_back(cmd);
         m_row = trans->row;
     }
 
     unsigned val = trans->isWrite ? m_col_wr_lat :  m_col_rd_lat;
-    cmd = new Cmd( this, Cmd::COL, val, trans->row, m_data_lat, trans );
+    cmd = allocCmd();
+    cmd->init( this, Cmd::COL, val, trans->row, m_data_lat, trans );
     m_cmdQ.push_back(cmd);
 }
@@ -13,6 +13,8 @@
 #ifndef _H_SST_MEMH_TIMING_DRAM_BACKEND
 #define _H_SST_MEMH_TIMING_DRAM_BACKEND
 
+#include <limits>
+#include <map>
 #include <queue>
 
 #include <sst/core/componentExtension.h>
@@ -62,6 +64,7 @@ public:
 /* Begin class definition */
 private:
     const uint64_t DBG_MASK = 0x1;
+    static constexpr SimTime_t NEVER = std::numeric_limits<SimTime_t>::max();
 
     class Cmd;
 
@@ -79,6 +82,18 @@ private:
 
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
 
+        /* Earliest cycle at or after 'cycle' at which popCmd() could change
+         * bank state or return a command. Returns NEVER if the bank is waiting
+         * on an issued command to retire (retirement wakes the channel anyway).
+         */
+        SimTime_t nextActionCycle( SimTime_t cycle, SimTime_t dataBusAvailCycle );
+
+        /* Retired commands are recycled rather than deleted */
+        void freeCmd( Cmd* cmd ) {
+            clearLastCmd();
+            m_cmdPool.push_back( cmd );
+        }
+
         void setLastCmd( Cmd* cmd ) {
             m_lastCmd = cmd;
         }
@@ -108,8 +123,11 @@ private:
         unsigned getRank() { return m_rank; }
         unsigned getBank() { return m_bank; }
 
+        ~Bank();
+
       private:
         void update( SimTime_t );
+        Cmd* allocCmd();
         const char* prefix() { return m_pre.c_str(); }
 
         Output*             m_output;
@@ -126,6 +144,7 @@ private:
         unsigned            m_bank;
         unsigned            m_row;
         std::deque<Cmd*>    m_cmdQ;
+        std::vector<Cmd*>   m_cmdPool;
         TransactionQ*       m_transQ;
         PagePolicy*         m_pagePolicy;
     };
@@ -133,9 +152,19 @@ private:
     class Cmd {
       public:
         enum Op { PRE, ACT, COL } m_op;
-        Cmd( Bank* bank, Op op, unsigned cycles, unsigned row = -1, unsigned dataCycles = 0, Transaction* trans  = NULL  ) :
-            m_bank(bank), m_op(op), m_cycles(cycles), m_row(row), m_dataCycles(dataCycles), m_trans(trans)
-        {
+        Cmd() : m_bank(nullptr), m_trans(nullptr) {}
+        Cmd( Bank* bank, Op op, unsigned cycles, unsigned row = -1, unsigned dataCycles = 0, Transaction* trans  = NULL  ) {
+            init( bank, op, cycles, row, dataCycles, trans );
+        }
+
+        void init( Bank* bank, Op op, unsigned cycles, unsigned row = -1, unsigned dataCycles = 0, Transaction* trans  = NULL  ) {
+            m_bank = bank;
+            m_op = op;
+            m_cycles = cycles;
+            m_row = row;
+            m_dataCycles = dataCycles;
+            m_trans = trans;
+
             switch( m_op ) {
               case PRE:
                 m_name = "PRE";
@@ -149,11 +178,7 @@ private:
             }
             if (mem_h_is_debug)
                 m_bank->verbose(__LINE__,__FUNCTION__,"new %s for rank=%d bank=%d row=%d\n",
-                        getName().c_str(), getRank(), getBank(), getRow());
-        }
-
-        ~Cmd() {
-            m_bank->clearLastCmd();
+                        getName(), getRank(), getBank(), getRow());
         }
 
         SimTime_t issue() {
@@ -163,6 +188,11 @@ private:
             return m_dataBusAvailCycle;
         }
 
+        /* Hand the command back to its bank for reuse */
+        void retire() {
+            m_bank->freeCmd(this);
+        }
+
         bool canIssue( SimTime_t currentCycle, SimTime_t dataBusAvailCycle ) {
             bool ret=false;
 
@@ -211,8 +241,34 @@ private:
             return ( now >= m_finiTime );
         }
 
+        /* Earliest cycle at which canIssue() can succeed given the bank's last
+         * command and the data bus. Returns NEVER if the bank's last command
+         * must retire first.
+         */
+        SimTime_t earliestIssue( SimTime_t dataBusAvailCycle ) {
+            SimTime_t earliest = 0;
+
+            Cmd* lastCmd = m_bank->getLastCmd();
+            if ( lastCmd ) {
+                if ( m_op != COL || lastCmd->m_op != COL ) {
+                    return NEVER;
+                }
+                earliest = lastCmd->m_issueTime + m_dataCycles;
+            }
+
+            if ( dataBusAvailCycle > m_cycles && dataBusAvailCycle - m_cycles > earliest ) {
+                earliest = dataBusAvailCycle - m_cycles;
+            }
+            return earliest;
+        }
+
+        /* Cycle at which Channel::clock() first sees this command as done */
+        SimTime_t retireCycle() {
+            return m_finiTime > m_issueTime ? m_finiTime : m_issueTime + 1;
+        }
+
         // these are used for debugging
-        std::string& getName()  { return m_name; }
+        const char* getName()   { return m_name; }
         unsigned getRank()      { return m_bank->getRank(); }
         unsigned getBank()      { return m_bank->getBank(); }
         unsigned getRow()       { return m_row; }
@@ -220,7 +276,7 @@ private:
       private:
 
         Bank*           m_bank;
-        std::string     m_name;
+        const char*     m_name;
         unsigned        m_cycles;
         unsigned        m_row;
         unsigned        m_dataCycles;
@@ -258,6 +314,8 @@ private:
             return !m_banksActive.empty();
         }
 
+        SimTime_t nextActionCycle( SimTime_t cycle, SimTime_t dataBusAvailCycle );
+
       private:
 
         const char* prefix() { return m_pre.c_str(); }
@@ -290,15 +348,44 @@ private:
             if (mem_h_is_debug)
                 m_output->verbosePrefix(prefix(),CALL_INFO, 3, DBG_MASK,"reqId=%" PRIu64 " rank=%d addr=%#" PRIx64 ", createTime=%" PRIu64 "\n", id, rank, addr, createTime );
 
-            Transaction* trans = new Transaction( createTime, id, addr, isWrite, numBytes, m_mapper->getBank(addr),
+            Transaction* trans;
+            if ( m_transPool.empty() ) {
+                trans = new Transaction( createTime, id, addr, isWrite, numBytes, m_mapper->getBank(addr),
                                                 m_mapper->getRow(addr) );
+            } else {
+                trans = m_transPool.back();
+                m_transPool.pop_back();
+                *trans = Transaction( createTime, id, addr, isWrite, numBytes, m_mapper->getBank(addr),
+                                                m_mapper->getRow(addr) );
+            }
             m_pendingCount++;
             m_ranks[ rank ]->pushTrans( trans );
+
+            // new work, re-evaluate the banks on the next clock
+            m_nextActionCycle = 0;
             return true;
         }
 
         void clock(SimTime_t );
 
+        bool isIdle() {
+            if ( m_pendingCount || ! m_issuedCmds.empty() ) {
+                return false;
+            }
+            for ( unsigned i = 0; i < m_ranks.size(); i++ ) {
+                if ( m_ranks[i]->hasActiveBanks() ) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        ~Channel() {
+            for ( unsigned i = 0; i < m_transPool.size(); i++ ) {
+                delete m_transPool[i];
+            }
+        }
+
       private:
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
         const char* prefix() { return m_pre.c_str(); }
@@ -313,8 +400,13 @@ private:
         unsigned            m_maxPendingTrans;
         unsigned            m_pendingCount;
 
-        std::list<Cmd*>     m_issuedCmds;
+        /* Issued commands keyed by the cycle they retire; equal keys keep issue order */
+        std::multimap<SimTime_t, Cmd*> m_issuedCmds;
         std::queue<Transaction*> m_retiredTrans;
+        std::vector<Transaction*> m_transPool;
+
+        /* Nothing can retire, issue or change bank state before this cycle */
+        SimTime_t           m_nextActionCycle;
 
         std::function<void(ReqId)> m_responseHandler;
     };
@@ -0,0 +1,151 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_OPENADDRMAP_H
+#define MEMHIERARCHY_OPENADDRMAP_H
+
+#include <stdint.h>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Flat hash map using open addressing with linear probing.
+ *
+ * Intended for per-event bookkeeping tables that are searched, filled and
+ * drained on every request (e.g., outstanding request and MSHR tables).
+ * Entries live in a single array so a lookup is usually one cache miss.
+ *
+ * Interface is the subset of std::map used by those tables, with one
+ * difference: iterators are plain pointers to the stored pair and are
+ * invalidated by any insert or erase on the same map.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key> >
+class OpenAddrMap {
+public:
+    typedef std::pair<Key, Value> value_type;
+    typedef value_type* iterator;
+
+    OpenAddrMap(size_t capacity = 64) : size_(0) {
+        size_t cap = 8;
+        while (cap < capacity) cap <<= 1;
+        resize(cap);
+    }
+
+    iterator end() { return nullptr; }
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    iterator find(const Key& key) {
+        size_t idx = home(key);
+        while (used_[idx]) {
+            if (slots_[idx].first == key)
+                return &slots_[idx];
+            idx = (idx + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    /* Like std::map::insert, an existing entry is left unchanged */
+    iterator insert(value_type entry) {
+        iterator it = find(entry.first);
+        if (it != nullptr)
+            return it;
+
+        if ((size_ + 1) * 2 > slots_.size())
+            resize(slots_.size() * 2);
+
+        size_t idx = home(entry.first);
+        while (used_[idx])
+            idx = (idx + 1) & mask_;
+        slots_[idx] = std::move(entry);
+        used_[idx] = true;
+        size_++;
+        return &slots_[idx];
+    }
+
+    size_t erase(const Key& key) {
+        iterator it = find(key);
+        if (it == nullptr)
+            return 0;
+        erase(it);
+        return 1;
+    }
+
+    /* Backward-shift deletion so that lookups never need tombstones */
+    void erase(iterator it) {
+        size_t hole = it - &slots_[0];
+        size_t idx = hole;
+        while (true) {
+            idx = (idx + 1) & mask_;
+            if (!used_[idx])
+                break;
+            size_t want = home(slots_[idx].first);
+            // Move the entry back if its home slot is not cyclically in (hole, idx]
+            bool stays = (hole <= idx) ? (hole < want && want <= idx) : (hole < want || want <= idx);
+            if (!stays) {
+                slots_[hole] = std::move(slots_[idx]);
+                hole = idx;
+            }
+        }
+        slots_[hole] = value_type();
+        used_[hole] = false;
+        size_--;
+    }
+
+private:
+    size_t home(const Key& key) const {
+        // Fibonacci hashing spreads line-aligned addresses and sequential IDs
+        return (uint64_t)(Hash()(key) * 0x9E3779B97F4A7C15ULL) >> shift_;
+    }
+
+    void resize(size_t cap) {
+        std::vector<value_type> oldSlots;
+        std::vector<bool> oldUsed;
+        oldSlots.swap(slots_);
+        oldUsed.swap(used_);
+
+        slots_.resize(cap);
+        used_.assign(cap, false);
+        mask_ = cap - 1;
+        shift_ = 64;
+        for (size_t c = cap; c > 1; c >>= 1)
+            shift_--;
+
+        for (size_t i = 0; i < oldSlots.size(); i++) {
+            if (!oldUsed[i])
+                continue;
+            size_t idx = home(oldSlots[i].first);
+            while (used_[idx])
+                idx = (idx + 1) & mask_;
+            slots_[idx] = std::move(oldSlots[i]);
+            used_[idx] = true;
+        }
+    }
+
+    std::vector<value_type> slots_;
+    std::vector<bool> used_;
+    size_t size_;
+    size_t mask_;
+    unsigned shift_;
+};
+
+}
+}
+
+#endif /* MEMHIERARCHY_OPENADDRMAP_H */
@@ -17,6 +17,7 @@
 #include <sst/core/sst_config.h>
 #include <sst/core/params.h>
 #include <sst/core/interfaces/stringEvent.h>
+#include <algorithm>
 
 #include "scratchpad.h"
 #include "membackend/scratchBackendConvertor.h"
@@ -437,7 +438,7 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    OpenAddrMap<SST::Event::id_type,SST::Event::id_type,EventIDHash>::iterator it = responseIDMap_.find(ev->getResponseToID());
 
     if (it == responseIDMap_.end()) {
         dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
@@ -465,8 +466,8 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
     // issue ready events
     uint32_t responseThisCycle = (responsesPerCycle_ == 0) ? 1 : 0;
-    while (!procMsgQueue_.empty() && procMsgQueue_.begin()->first < timestamp_) {
-        MemEventBase * sendEv = procMsgQueue_.begin()->second;
+    while (procMsgQueue_.ready(timestamp_)) {
+        MemEventBase * sendEv = procMsgQueue_.front();
 
         if (mem_h_is_debug_event(sendEv)) {
             debug = true;
@@ -475,13 +476,13 @@ bool Scratchpad::clock(Cycle_t cycle) {
         }
 
         linkUp_->send(sendEv);
-        procMsgQueue_.erase(procMsgQueue_.begin());
+        procMsgQueue_.pop();
         responseThisCycle++;
         if (responseThisCycle == responsesPerCycle_) break;
     }
 
-    while (!memMsgQueue_.empty() && memMsgQueue_.begin()->first < timestamp_) {
-        MemEvent * sendEv = memMsgQueue_.begin()->second;
+    while (memMsgQueue_.ready(timestamp_)) {
+        MemEvent * sendEv = memMsgQueue_.front();
         sendEv->setDst(linkDown_->getTargetDestination(sendEv->getBaseAddr()));
 
         if (mem_h_is_debug_event(sendEv)) {
@@ -492,7 +493,7 @@ bool Scratchpad::clock(Cycle_t cycle) {
 
         linkDown_->send(sendEv);
 
-        memMsgQueue_.erase(memMsgQueue_.begin());
+        memMsgQueue_.pop();
     }
 
     linkDown_->clock();
@@ -734,7 +735,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), saddr, daddr, remoteRead->getID().first, remoteRead->getID().second, remoteRead->getBaseAddr());
     }
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, remoteRead));
+    memMsgQueue_.insert(timestamp_, remoteRead);
 
     // Insert into mshr and send inv if needed
     // start base addr -> end base addr
@@ -742,19 +743,19 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     uint32_t lineCount = 1 + (ev->getDstAddr() + ev->getSize() - ev->getDstBaseAddr() - 1)/ scratchLineSize_;
     for (uint32_t i = 0; i < lineCount; i++) {
         Addr baseAddr = ev->getDstBaseAddr() + i*scratchLineSize_;
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+        MSHRList* entries = findMSHR(baseAddr);
+        if (entries == nullptr) {
             bool needAck = startGet(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Get, true, needAck))));
+            entries = &(mshr_.insert(std::make_pair(baseAddr, MSHRList(1, MSHREntry(ev->getID(), Command::Get, true, needAck))))->second);
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Get, true));
+            entries->push_back(MSHREntry(ev->getID(), Command::Get, true));
         }
 
         if (mem_h_is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
-
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entries->back().getString().c_str());
     }
+    getOutstanding(ev->getID()).setCount(lineCount);
 }
 
 
@@ -786,31 +787,28 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
 
     outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
 
-    Addr addr = ev->getSrcAddr();
-    Addr baseAddr = ev->getSrcBaseAddr();
-    uint32_t bytesLeft = ev->getSize();
-    while (bytesLeft != 0) {
-        uint32_t size = (baseAddr + scratchLineSize_) - addr;
-        if (size > bytesLeft) size = bytesLeft;
+    uint32_t lineCount = 0;
+    if (ev->getSize() != 0)
+        lineCount = 1 + (ev->getSrcAddr() + ev->getSize() - ev->getSrcBaseAddr() - 1) / scratchLineSize_;
 
-        if (mshr_.find(baseAddr) == mshr_.end()) {
+    Addr baseAddr = ev->getSrcBaseAddr();
+    for (uint32_t i = 0; i < lineCount; i++) {
+        MSHRList* entries = findMSHR(baseAddr);
+        if (entries == nullptr) {
             bool needAck = startPut(baseAddr, ev);
-            mshr_.insert(std::make_pair(baseAddr, std::list<MSHREntry>(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))));
+            entries = &(mshr_.insert(std::make_pair(baseAddr, MSHRList(1, MSHREntry(ev->getID(), Command::Put, !needAck, needAck))))->second);
         } else {
-            mshr_.find(baseAddr)->second.push_back(MSHREntry(ev->getID(), Command::Put));
+            entries->push_back(MSHREntry(ev->getID(), Command::Put));
         }
 
         if (mem_h_is_debug_addr(baseAddr))
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(),
-                    baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
+                    baseAddr, entries->back().getString().c_str());
 
-        bytesLeft -= size;
         baseAddr += scratchLineSize_;
-        addr = baseAddr;
-
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
     }
+    getOutstanding(ev->getID()).setCount(lineCount);
 }
 
 
@@ -902,12 +900,8 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
 
         std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-        uint32_t offset = addr - request->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        std::vector<uint8_t>& payload = getOutstanding(requestID).remoteWrite->getPayload();
+        std::copy(data.begin(), data.begin() + size, payload.begin() + (addr - request->getSrcAddr()));
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString(dlevel).c_str());
@@ -953,13 +947,9 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
 
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
-    // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-    uint32_t offset = addr - put->getSrcAddr();
-    for (uint32_t i = 0; i < size; i++) {
-        payload[i+offset] = response->getPayload()[i];
-    }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    // Update write payload in place
+    std::vector<uint8_t>& payload = getOutstanding(requestID).remoteWrite->getPayload();
+    std::copy(response->getPayload().begin(), response->getPayload().begin() + size, payload.begin() + (addr - put->getSrcAddr()));
 
     // Clear this mshr entry
     updatePut(requestID);
@@ -999,7 +989,7 @@ void Scratchpad::handleNack(MemEventBase * event) {
         uint64_t backoff = (0x1 << retries);
         nackedEvent->incrementRetries();
 
-        procMsgQueue_.insert(std::make_pair(timestamp_ + backoff, nackedEvent));
+        procMsgQueue_.insert(timestamp_ + backoff, nackedEvent);
 
     } else {
         delete nackedEvent;
@@ -1025,7 +1015,7 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
     responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.insert(timestamp_, request);
 }
 
 
@@ -1044,11 +1034,11 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
     request->setFlag(MemEvent::F_NORESPONSE);
     request->setFlag(MemEvent::F_NONCACHEABLE);
 
-    memMsgQueue_.insert(std::make_pair(timestamp_, request));
+    memMsgQueue_.insert(timestamp_, request);
 
     MemEvent * response = event->makeResponse();
 
-    procMsgQueue_.insert(std::make_pair(timestamp_, response));
+    procMsgQueue_.insert(timestamp_, response);
 
     delete event;
 }
@@ -1127,43 +1117,45 @@ void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_ty
 
 // Update MSHR
 void Scratchpad::updateMSHR(Addr baseAddr) {
+    MSHRList* entries = findMSHR(baseAddr);
+
     // Remove top event
-    mshr_.find(baseAddr)->second.pop_front();
+    entries->pop_front();
 
     // Start next event
-    while (!mshr_.find(baseAddr)->second.empty()) {
-        MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
+    while (!entries->empty()) {
+        MSHREntry * entry = &(entries->front());
 
         if (entry->cmd == Command::GetS) {
             std::vector<uint8_t> readData = doScratchRead(entry->scratch);
-            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->second.response)->setPayload(readData);
+            static_cast<MemEvent*>(getOutstanding(entry->id).response)->setPayload(readData);
 
             if (mem_h_is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
 
-            if (caching_ && (outstandingEventList_.find(entry->id)->second.request->queryFlag(MemEvent::F_NONCACHEABLE))) {
+            if (caching_ && (getOutstanding(entry->id).request->queryFlag(MemEvent::F_NONCACHEABLE))) {
                 cacheStatus_.at(baseAddr/scratchLineSize_) = true;
             }
             break;
         } else if (entry->cmd == Command::GetX || entry->cmd == Command::Write) {
             doScratchWrite(entry->scratch);
             finishRequest(entry->id);
-            mshr_.find(baseAddr)->second.pop_front();
+            entries->pop_front();
 
             if (mem_h_is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
 
         } else if (entry->cmd == Command::Get) {
-            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(getOutstanding(entry->id).request));
             if (!entry->needData) {
                 doScratchWrite(entry->scratch);
                 entry->scratch = nullptr;
             }
             if (!entry->needAck && !entry->needData) {
                 updateGet(entry->id);
-                mshr_.find(baseAddr)->second.pop_front();
+                entries->pop_front();
 
                 if (mem_h_is_debug_addr(baseAddr))
                     dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Remove   0x%-16" PRIx64 "\n",
@@ -1176,7 +1168,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(getOutstanding(entry->id).request));
             entry->needData = !entry->needAck;
 
             if (mem_h_is_debug_addr(baseAddr))
@@ -1190,7 +1182,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
     }
 
     // Clear mshr entry if list is empty
-    if (mshr_.find(baseAddr)->second.empty()) {
+    if (entries->empty()) {
         mshr_.erase(baseAddr);
 
         if (mem_h_is_debug_addr(baseAddr))
@@ -1226,7 +1218,7 @@ void Scratchpad::doScratchWrite(MemEvent * event) {
 }
 
 void Scratchpad::sendResponse(MemEventBase * event) {
-    procMsgQueue_.insert(std::make_pair(timestamp_, event));
+    procMsgQueue_.insert(timestamp_, event);
 }
 
 
@@ -1243,7 +1235,7 @@ bool Scratchpad::startGet(Addr baseAddr, MoveEvent * get) {
         inv->setInstructionPointer(get->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), get->getSrcBaseAddr(), get->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.insert(timestamp_, inv);
         return true;
     }
     return false;
@@ -1263,7 +1255,7 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         inv->setInstructionPointer(put->getInstructionPointer());
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Inv         (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), put->getSrcBaseAddr(), put->getDstBaseAddr(), inv->getID().first, inv->getID().second, inv->getBaseAddr());
-        procMsgQueue_.insert(std::make_pair(timestamp_, inv));
+        procMsgQueue_.insert(timestamp_, inv);
         return true;
     } else {
         // Derive addr and size from baseAddr and the put request
@@ -1281,50 +1273,48 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
 
         std::vector<uint8_t> data = doScratchRead(read);
 
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
-        uint32_t offset = addr - put->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        // Fill the remote write's payload in place; copying it per line is quadratic in the Put size
+        std::vector<uint8_t>& payload = getOutstanding(put->getID()).remoteWrite->getPayload();
+        std::copy(data.begin(), data.begin() + size, payload.begin() + (addr - put->getSrcAddr()));
         return false;
     }
 }
 
 void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
+    OutstandingEvent& put = getOutstanding(putID);
+    uint32_t count = put.decrementCount();
     if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
+        MoveEvent * request = static_cast<MoveEvent*>(put.request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(),
-                put->getSrcBaseAddr(),
-                put->getDstBaseAddr(),
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
-//        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
-//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
+                request->getSrcBaseAddr(),
+                request->getDstBaseAddr(),
+                put.remoteWrite->getID().first,
+                put.remoteWrite->getID().second,
+                put.remoteWrite->getBaseAddr());
+        memMsgQueue_.insert(timestamp_, put.remoteWrite);
+        sendResponse(put.response);
+        delete put.request;
         outstandingEventList_.erase(putID);
     }
 
 }
 
 void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
+    OutstandingEvent& get = getOutstanding(getID);
+    uint32_t count = get.decrementCount();
     if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
+        sendResponse(get.response);
+        delete get.request;
         outstandingEventList_.erase(getID);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
+    OutstandingEvent& request = getOutstanding(requestID);
+    if (request.response != nullptr)
+        sendResponse(request.response);
+    delete request.request;
     outstandingEventList_.erase(requestID);
 }
 
@@ -29,6 +29,8 @@
 #include "sst/elements/memHierarchy/moveEvent.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/openAddrMap.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -169,11 +171,13 @@ private:
             uint32_t count;             // Number of lines we are waiting on - when 0, the request is complete
                                         // i.e., for a read or write, just 1, for a get or put, the size/lineSize
 
+            OutstandingEvent() : request(nullptr), response(nullptr), remoteWrite(nullptr), count(0) { }
             OutstandingEvent(MemEventBase * request, MemEventBase * response) : request(request), response(response), remoteWrite(nullptr), count(0) { }
             OutstandingEvent(MemEventBase * request, MemEventBase * response, MemEvent * write) : request(request), response(response), remoteWrite(write), count(0) { }
 
             uint32_t decrementCount() { count--; return count; }
             void incrementCount() { count++; }
+            void setCount(uint32_t c) { count = c; }
             uint32_t getCount() { return count; }
     };
     // MSHR entry
@@ -230,15 +234,30 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
-    std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
+    struct EventIDHash {
+        size_t operator()(const SST::Event::id_type& id) const { return (id.first << 20) ^ id.second; }
+    };
+
+    typedef std::list<MSHREntry> MSHRList;
+
+    OpenAddrMap<SST::Event::id_type,SST::Event::id_type,EventIDHash> responseIDMap_;  // Map a forwarded request ID to a original request ID
+    OpenAddrMap<SST::Event::id_type,Addr,EventIDHash> responseIDAddrMap_;             // Map an outstanding scratch request ID to the request's baseAddr
+    OpenAddrMap<SST::Event::id_type,OutstandingEvent,EventIDHash> outstandingEventList_; // List of all outstanding events
+    OpenAddrMap<Addr,MSHRList> mshr_; // MSHR for scratch accesses
+
+    // The returned list moves when mshr_ grows or shifts entries on erase, so do not
+    // hold it across an insert or erase. MSHREntry pointers into the list stay valid
+    // because moving a std::list keeps its nodes.
+    MSHRList* findMSHR(Addr baseAddr) {
+        OpenAddrMap<Addr,MSHRList>::iterator it = mshr_.find(baseAddr);
+        return it == mshr_.end() ? nullptr : &(it->second);
+    }
 
+    OutstandingEvent& getOutstanding(SST::Event::id_type id) { return outstandingEventList_.find(id)->second; }
 
-    // Outgoing message queues - map send timestamp to event
-    std::multimap<uint64_t, MemEventBase*> procMsgQueue_;
-    std::multimap<uint64_t, MemEvent*> memMsgQueue_;
+    // Outgoing message queues - send time to event
+    TimingWheel<MemEventBase*> procMsgQueue_;
+    TimingWheel<MemEvent*> memMsgQueue_;
 
     // Throughput limits
     uint32_t responsesPerCycle_;
@@ -0,0 +1,202 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <list>
+#include <map>
+#include <vector>
+
+#include "openAddrMap.h"
+#include "timingWheel.h"
+
+using namespace SST::MemHierarchy;
+
+/*
+ *  Test for the Scratchpad bookkeeping tables
+ *  Contains:
+ *      * TimingWheel wrap-around, checked against the std::multimap it replaced
+ *      * TimingWheel events beyond the ring (NACK backoff) and same-cycle order
+ *      * OpenAddrMap growth, erase and reinsert, checked against std::map
+ *      * MSHR list entries keep their address across table growth
+ *
+ *  Prints one line per test, returns non-zero on the first mismatch.
+ */
+
+static uint64_t rngState = 0x2545F4914F6CDD1DULL;
+static uint64_t nextRand() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return rngState;
+}
+
+#define CHECK(cond, ...) \
+    if (!(cond)) { printf("FAIL "); printf(__VA_ARGS__); printf("\n"); return false; }
+
+/* Drain everything due before 'now' from both queues and compare */
+static bool drain(TimingWheel<int>& wheel, std::multimap<uint64_t, int>& ref, uint64_t now, uint64_t& popped) {
+    while (wheel.ready(now)) {
+        CHECK(!ref.empty() && ref.begin()->first < now, "wheel has an event at cycle %llu the reference does not", (unsigned long long)now);
+        CHECK(wheel.front() == ref.begin()->second, "wheel returned event %d, expected %d at cycle %llu",
+                wheel.front(), ref.begin()->second, (unsigned long long)now);
+        wheel.pop();
+        ref.erase(ref.begin());
+        popped++;
+    }
+    CHECK(ref.empty() || ref.begin()->first >= now, "wheel missed event %d due at cycle %llu",
+            ref.begin()->second, (unsigned long long)ref.begin()->first);
+    CHECK(wheel.size() == ref.size(), "wheel holds %zu events, expected %zu", wheel.size(), ref.size());
+    return true;
+}
+
+static bool testWheelWrap() {
+    // A small ring so the head wraps around it many times
+    TimingWheel<int> wheel(8);
+    std::multimap<uint64_t, int> ref;
+    uint64_t popped = 0;
+    int id = 0;
+    uint64_t now = 0;
+    for (; now < 20000; now++) {
+        // Mostly near-term sends, as queued at the current timestamp
+        int count = nextRand() % 3;
+        for (int i = 0; i < count; i++) {
+            uint64_t time = now + nextRand() % 8;
+            wheel.insert(time, id);
+            ref.insert(std::make_pair(time, id++));
+        }
+        // Skip ahead now and then, like a clock that was turned off
+        if (nextRand() % 64 == 0)
+            now += nextRand() % 40;
+        if (!drain(wheel, ref, now, popped))
+            return false;
+    }
+    if (!drain(wheel, ref, now + 16, popped))
+        return false;
+    CHECK(wheel.empty(), "wheel not empty after the final drain");
+    printf("wheel wrap-around: %llu of %d events in order\n", (unsigned long long)popped, id);
+    return true;
+}
+
+static bool testWheelFarFuture() {
+    TimingWheel<int> wheel(8);
+    std::multimap<uint64_t, int> ref;
+    uint64_t popped = 0;
+    int id = 0;
+
+    // Backoffs well past the ring, several landing on the same cycle
+    const uint64_t backoffs[] = { 1000, 64, 1000, 9, 1000, 513, 8, 7 };
+    for (uint64_t backoff : backoffs) {
+        wheel.insert(backoff, id);
+        ref.insert(std::make_pair(backoff, id++));
+    }
+
+    // Nothing is due until the first event's cycle has passed
+    CHECK(!wheel.ready(7), "wheel reports an event before cycle 7");
+    if (!drain(wheel, ref, 8, popped))
+        return false;
+
+    // Add to a cycle that still has events waiting in the overflow map
+    for (uint64_t now = 8; now <= 1001; now++) {
+        if (now == 600 || now == 995) {
+            wheel.insert(1000, id);
+            ref.insert(std::make_pair(1000, id++));
+        }
+        if (!drain(wheel, ref, now, popped))
+            return false;
+    }
+    CHECK(wheel.empty(), "wheel not empty after cycle 1000");
+    printf("wheel far-future: %llu of %d events in order\n", (unsigned long long)popped, id);
+    return true;
+}
+
+static bool testMapGrowErase() {
+    // Line-aligned addresses, as used by the MSHR
+    OpenAddrMap<uint64_t, uint64_t> map(8);
+    std::map<uint64_t, uint64_t> ref;
+
+    for (uint64_t i = 0; i < 4096; i++) {
+        uint64_t addr = i * 64;
+        map.insert(std::make_pair(addr, i));
+        ref.insert(std::make_pair(addr, i));
+    }
+    CHECK(map.size() == 4096, "map holds %zu entries after growth, expected 4096", map.size());
+
+    // Erase every other line, survivors must still be found past the holes
+    for (uint64_t i = 0; i < 4096; i += 2) {
+        CHECK(map.erase(i * 64) == 1, "erase of line %llu failed", (unsigned long long)i);
+        ref.erase(i * 64);
+    }
+    CHECK(map.erase((uint64_t)0) == 0, "second erase of line 0 succeeded");
+
+    // Random mix of inserts, erases and lookups over a small address range
+    for (int op = 0; op < 200000; op++) {
+        uint64_t addr = (nextRand() % 8192) * 64;
+        switch (nextRand() % 3) {
+            case 0:
+                map.insert(std::make_pair(addr, op));
+                ref.insert(std::make_pair(addr, op));
+                break;
+            case 1:
+                CHECK(map.erase(addr) == ref.erase(addr), "erase of 0x%llx disagrees with std::map", (unsigned long long)addr);
+                break;
+            default:
+                break;
+        }
+        OpenAddrMap<uint64_t, uint64_t>::iterator it = map.find(addr);
+        std::map<uint64_t, uint64_t>::iterator rit = ref.find(addr);
+        CHECK((it == map.end()) == (rit == ref.end()), "lookup of 0x%llx disagrees with std::map", (unsigned long long)addr);
+        CHECK(it == map.end() || it->second == rit->second, "value of 0x%llx disagrees with std::map", (unsigned long long)addr);
+    }
+    CHECK(map.size() == ref.size(), "map holds %zu entries, expected %zu", map.size(), ref.size());
+    for (std::map<uint64_t, uint64_t>::iterator rit = ref.begin(); rit != ref.end(); rit++) {
+        OpenAddrMap<uint64_t, uint64_t>::iterator it = map.find(rit->first);
+        CHECK(it != map.end() && it->second == rit->second, "entry 0x%llx lost", (unsigned long long)rit->first);
+    }
+    printf("map growth and erase: %zu entries match std::map\n", ref.size());
+    return true;
+}
+
+static bool testMSHREntries() {
+    // The scratchpad holds MSHREntry pointers into the per-line lists. The
+    // lists themselves move when the table grows or shifts on erase.
+    OpenAddrMap<uint64_t, std::list<int> > mshr(8);
+    std::vector<int*> entries;
+    for (int i = 0; i < 1024; i++) {
+        std::list<int>& list = mshr.insert(std::make_pair((uint64_t)i * 64, std::list<int>(1, i)))->second;
+        entries.push_back(&list.front());
+    }
+    for (int i = 0; i < 1024; i += 3)
+        mshr.erase((uint64_t)i * 64);
+    for (int i = 0; i < 1024; i++) {
+        OpenAddrMap<uint64_t, std::list<int> >::iterator it = mshr.find((uint64_t)i * 64);
+        if (i % 3 == 0) {
+            CHECK(it == mshr.end(), "line %d still present after erase", i);
+            continue;
+        }
+        CHECK(it != mshr.end() && &it->second.front() == entries[i], "entry for line %d moved", i);
+        CHECK(*entries[i] == i, "entry for line %d changed", i);
+    }
+    printf("mshr entries: stable across growth and erase\n");
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (!testWheelWrap()) return 1;
+    if (!testWheelFarFuture()) return 1;
+    if (!testMapGrowErase()) return 1;
+    if (!testMSHREntries()) return 1;
+    return 0;
+}
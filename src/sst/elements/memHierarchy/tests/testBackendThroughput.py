@@ -0,0 +1,104 @@
+import sst
+import sys
+
+# Backend throughput benchmark: a request generator is wired straight to a
+# memory controller so that nearly all simulation work is in the memory
+# backend. There are no caches and no processor model.
+#
+# Usage: sst --print-timing-info testBackendThroughput.py --model-options="<pattern> [requests] [backend]"
+#   pattern  : 'stream' (sequential addresses) or 'random'
+#   requests : number of requests to issue (default 20000)
+#   backend  : memory backend element (default memHierarchy.timingDRAM)
+#
+# Backend throughput in requests/sec is the request count divided by the
+# 'Run loop time' reported by --print-timing-info.
+
+pattern = "random"
+requests = 20000
+backend = "memHierarchy.timingDRAM"
+
+if len(sys.argv) > 1:
+    pattern = sys.argv[1]
+if len(sys.argv) > 2:
+    requests = int(sys.argv[2])
+if len(sys.argv) > 3:
+    backend = sys.argv[3]
+
+if pattern not in ("stream", "random"):
+    print("testBackendThroughput.py: unknown pattern '{}', expected 'stream' or 'random'".format(pattern))
+    sys.exit(-1)
+
+clock = "2GHz"
+mem_size = "512MiB"
+
+if pattern == "stream":
+    gen = sst.Component("gen", "memHierarchy.streamCPU")
+    gen.addParams({
+        "commFreq" : 1,
+        "memSize" : 512*1024*1024,
+        "clock" : clock,
+        "maxOutstanding" : 64,
+        "reqsPerIssue" : 4,
+        "num_loadstore" : requests,
+        "do_write" : 1,
+        "verbose" : 0,
+    })
+else:
+    gen = sst.Component("gen", "memHierarchy.standardCPU")
+    gen.addParams({
+        "memFreq" : 1,
+        "memSize" : mem_size,
+        "clock" : clock,
+        "rngseed" : 17,
+        "maxOutstanding" : 64,
+        "opCount" : requests,
+        "reqsPerIssue" : 4,
+        "write_freq" : 30,
+        "read_freq" : 70,
+        "verbose" : 0,
+    })
+iface = gen.setSubComponent("memory", "memHierarchy.standardInterface")
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1.2GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+
+memory = memctrl.setSubComponent("backend", backend)
+memory.addParams({
+    "mem_size" : mem_size,
+    "max_requests_per_cycle" : -1,
+})
+if backend == "memHierarchy.timingDRAM":
+    memory.addParams({
+        "id" : 0,
+        "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+        "addrMapper.interleave_size" : "64B",
+        "addrMapper.row_size" : "1KiB",
+        "channels" : 2,
+        "channel.numRanks" : 2,
+        "channel.rank.numBanks" : 8,
+        "channel.transaction_Q_size" : 64,
+        "channel.rank.bank.CL" : 14,
+        "channel.rank.bank.CL_WR" : 12,
+        "channel.rank.bank.RCD" : 14,
+        "channel.rank.bank.TRP" : 14,
+        "channel.rank.bank.dataCycles" : 2,
+        "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+        "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+        "channel.rank.bank.pagePolicy.close" : 0,
+        "printconfig" : 0,
+        "channel.printconfig" : 0,
+        "channel.rank.printconfig" : 0,
+        "channel.rank.bank.printconfig" : 0,
+    })
+
+link = sst.Link("link_gen_mem")
+link.connect( (iface, "lowlink", "1000ps"), (memctrl, "highlink", "1000ps") )
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForComponentType("memHierarchy.standardCPU")
+sst.enableAllStatisticsForComponentType("memHierarchy.MemController")
@@ -0,0 +1,11 @@
+import sst
+
+# Rerun the DistributedCaches model with every cache in cycle-free mode.
+# Skipping idle cycles must not change any result, so this test shares
+# the DistributedCaches reference output.
+exec(open("testDistributedCaches.py").read())
+
+for x in range(cores):
+    sst.findComponentByName("l1cache" + str(x)).addParam("cycle_free", 1)
+for x in range(caches):
+    sst.findComponentByName("l2cache" + str(x)).addParam("cycle_free", 1)
@@ -0,0 +1,96 @@
+import sst
+
+# Flush-heavy traffic against a slow memory so that FlushLine/FlushLineInv
+# requests routinely arrive while requests to the same line are still queued
+# in the memory backend convertor.
+# Caches use maxRequestDelay so that a flush that is never answered is
+# reported as a deadlock instead of silently ending the simulation.
+
+cores = 4
+coreclock = "2GHz"
+
+DEBUG_L1 = 0
+DEBUG_L2 = 0
+DEBUG_MEM = 0
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({
+      "bus_frequency" : coreclock,
+})
+
+for x in range(cores):
+    cpu = sst.Component("core" + str(x), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "memFreq" : 1,
+        "memSize" : "2KiB",     # few lines so flushes often hit queued requests
+        "verbose" : 0,
+        "clock" : coreclock,
+        "rngseed" : 311+x,
+        "maxOutstanding" : 32,
+        "opCount" : 5000,
+        "reqsPerIssue" : 2,
+        "write_freq" : 30,      # 30% writes
+        "read_freq" : 30,       # 30% reads
+        "flush_freq" : 20,      # 20% flushes
+        "flushinv_freq" : 20,   # 20% flush-inv
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 2,
+        "replacement_policy" : "lru",
+        "coherence_protocol" : "MESI",
+        "cache_size" : "1KiB",
+        "associativity" : 2,
+        "L1" : 1,
+        "maxRequestDelay" : 1000000,
+        "debug" : DEBUG_L1,
+        "debug_level" : 10,
+    })
+
+    cpu_l1_link = sst.Link("link_cpu_cache_" + str(x))
+    cpu_l1_link.connect( (iface, "lowlink", "500ps"), (l1cache, "highlink", "500ps") )
+
+    l1_bus_link = sst.Link("link_l1_bus_" + str(x))
+    l1_bus_link.connect( (l1cache, "lowlink", "500ps"), (bus, "highlink" + str(x), "500ps") )
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+      "cache_frequency" : coreclock,
+      "access_latency_cycles" : 8,
+      "replacement_policy" : "lru",
+      "coherence_protocol" : "MESI",
+      "cache_size" : "4KiB",
+      "associativity" : 4,
+      "maxRequestDelay" : 1000000,
+      "debug" : DEBUG_L2,
+      "debug_level" : 10,
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+    "debug" : DEBUG_MEM,
+    "debug_level" : 10,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "mem_size" : "512MiB",
+    "access_time" : "80ns",
+    "max_requests_per_cycle" : 1,
+})
+
+bus_l2_link = sst.Link("link_bus_l2")
+bus_l2_link.connect( (bus, "lowlink0", "500ps"), (l2cache, "highlink", "500ps") )
+
+l2_mem_link = sst.Link("link_l2_mem")
+l2_mem_link.connect( (l2cache, "lowlink", "1ns"), (memctrl, "highlink", "1ns") )
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+sst.enableAllStatisticsForComponentType("memHierarchy.standardCPU")
+sst.enableAllStatisticsForComponentType("memHierarchy.MemController")
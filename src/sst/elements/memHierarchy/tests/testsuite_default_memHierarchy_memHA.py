@@ -4,6 +4,8 @@ from sst_unittest import *
 from sst_unittest_support import *
 import os.path
 import re
+import shutil
+import time
 
 
 ################################################################################
@@ -49,6 +51,14 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_DistributedCaches(self):
         self.memHA_Template("DistributedCaches")
 
+    def test_memHA_CycleFree(self):
+        # Rerun the default clocking mode alongside so the wall clock of
+        # both modes is reported
+        default_sec = self.memHA_Template("DistributedCaches", run_name="CycleFree_default")
+        cyclefree_sec = self.memHA_Template("CycleFree", reffile_case="DistributedCaches")
+        log_testing_note("memHA CycleFree wall clock: default {0:.2f}s, cycle_free {1:.2f}s ({2:.2f}x)".format(
+                         default_sec, cyclefree_sec, default_sec / max(cyclefree_sec, 1e-6)))
+
     def test_memHA_Flushes_2(self):
         self.memHA_Template("Flushes_2")
 
@@ -156,6 +166,9 @@ class testcase_memHierarchy_memHA(SSTTestCase):
     def test_memHA_ScratchNetwork(self):
         self.memHA_Template("ScratchNetwork")
 
+    def test_memHA_ScratchpadTables(self):
+        self.memHA_Tool_Template("scratchpadTables")
+
     def test_memHA_StdMem(self):
         self.memHA_Template("StdMem")
 
@@ -182,7 +195,7 @@ class testcase_memHierarchy_memHA(SSTTestCase):
 #####
 
     def memHA_Template(self, testcase,
-                       ignore_err_file=False, testtimeout=240):
+                       ignore_err_file=False, testtimeout=240, reffile_case=None, run_name=None):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -195,6 +208,13 @@ class testcase_memHierarchy_memHA(SSTTestCase):
         testDataFileName=("test_memHA_{0}".format(testcase))
         sdlfile = "{0}/test{1}.py".format(test_path, testcasename_sdl)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        if reffile_case is not None:
+            # Variants of another test that must reproduce its output exactly
+            reffile = "{0}/refFiles/test_memHA_{1}.out".format(test_path, reffile_case)
+
+        if run_name is not None:
+            # Extra runs of a model keep their own output files
+            testDataFileName = "test_memHA_{0}".format(run_name)
 
         tmpfile = "{0}/{1}.tmp".format(outdir, testDataFileName)
 
@@ -208,8 +228,10 @@ class testcase_memHierarchy_memHA(SSTTestCase):
         log_debug("ref file = {0}".format(reffile))
 
         # Run SST in the tests directory
+        start = time.time()
         self.run_sst(sdlfile, outfile, errfile, set_cwd=test_path,
                      timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+        wall_sec = time.time() - start
 
         # Lines to ignore
         # These are generated by DRAMSim
@@ -244,6 +266,41 @@ class testcase_memHierarchy_memHA(SSTTestCase):
             log_failure(diffdata)
             self.assertTrue(filesAreTheSame, "Output file {0} does not pass check against the Reference File {1} ".format(outfile, reffile))
 
+        return wall_sec
+
+###
+    # Build a standalone test program from tests/<toolname> against the
+    # memHierarchy headers, run it and compare its output to the reference
+    def memHA_Tool_Template(self, toolname, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tmpdir = self.get_test_output_tmp_dir()
+
+        elementdir = os.path.abspath("{0}/../".format(test_path))
+        tooldir = "{0}/{1}".format(tmpdir, toolname)
+        testDataFileName = "test_memHA_{0}{1}".format(toolname[0].upper(), toolname[1:])
+        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+
+        if os.path.isdir(tooldir):
+            shutil.rmtree(tooldir, True)
+        os.makedirs(tooldir)
+        shutil.copy("{0}/{1}/Makefile".format(test_path, toolname), tooldir)
+        os_symlink_file("{0}/{1}".format(test_path, toolname), tooldir, "{0}.cc".format(toolname))
+
+        rtn = OSCommand("make MEMH_DIR={0}".format(elementdir), set_cwd=tooldir).run()
+        log_debug("Make result = {0}; output =\n{1}".format(rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "{0}.cc failed to compile".format(toolname))
+
+        rtn = OSCommand("./{0}".format(toolname), output_file_path=outfile, set_cwd=tooldir).run(timeout_sec=testtimeout)
+        self.assertTrue(rtn.result() == 0, "{0} failed, see {1}".format(toolname, outfile))
+
+        cmp_result = testing_compare_diff(testDataFileName, outfile, reffile)
+        if cmp_result == False:
+            diffdata = testing_get_diff_data(testDataFileName)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
+
 ###
     # Remove lines containing any string found in 'remove_strs' from in_file
     # If out_file != None, output is out_file
@@ -24,6 +24,16 @@ class testcase_memHierarchy_memory(SSTTestCase):
         # Put test based teardown code here. it is called once after every test
         super(type(self), self).tearDown()
 
+    # Backend throughput benchmark, generator wired directly to timingDRAM
+    # Pass if the simulation completes without error output and the backend
+    # served every generated request
+    def test_memory_backend_throughput_stream(self):
+        self.memh_template_throughput("stream")
+
+    def test_memory_backend_throughput_random(self):
+        self.memh_template_throughput("random")
+
+
 #####
     # Test writing memory backing to mmap
     # Pass if output mmap file matches ref file
@@ -79,8 +89,59 @@ class testcase_memHierarchy_memory(SSTTestCase):
 
         self.memh_template_backing(teststr="init", testnum=5, seed0=20, seed1=21, seed2=22, seed3=23, backing_infile=None, backing_reffile=ref_file, backing_outfile=out_file)
 
+    # Flush-heavy traffic through the memory backend convertor
+    # Pass if the simulation completes without a cache timeout or error output
+    # and every core retires all of its operations
+    def test_memory_flushes(self):
+        test_path = self.get_testsuite_dir()
+        test_run_dir = self.get_test_output_run_dir()
+        test_tmp_dir = self.get_test_output_tmp_dir()
+
+        test_config = "{}/testFlushHeavy.py".format(test_path)
+        test_output = "{}/test_memHierarchy_memory_flushes.out".format(test_run_dir)
+        test_err    = "{}/test_memHierarchy_memory_flushes.err".format(test_run_dir)
+        test_mpi_output = "{}/test_memHierarchy_memory_flushes.testfile".format(test_run_dir)
+        test_cmp = "{}/test_memHierarchy_memory_flushes.cmp".format(test_tmp_dir)
+        test_ref = "{}/refFiles/test_memHierarchy_memory_flushes.out".format(test_path)
+
+        self.run_sst(test_config, test_output, test_err, set_cwd=test_path,
+                     timeout_sec=240, mpi_out_files=test_mpi_output)
+
+        with open(test_output) as fn:
+            self.assertIn("Simulation is complete", fn.read(), "No end of simulation detected in output file {}".format(test_output))
+
+        self.assertFalse(os_test_file(test_err, "-s"), "Error file is non-empty {}".format(test_err))
+
+        # A core only ends once every request has its response, so each must
+        # report opCount operations. The flushes must also have reached memory.
+        ops = self._sum_statistics(test_output, ["reads", "writes", "flushes", "flushinvs"])
+        with open(test_cmp, "w") as fp:
+            for comp in sorted(ops):
+                fp.write("{} ops {}\n".format(comp, ops[comp]))
+        self.memh_compare_ref("test_memHierarchy_memory_flushes", test_cmp, test_ref)
+
+        written = self._sum_statistics(test_output, ["requests_received_PutM"])
+        self.assertTrue(written.get("memory", 0) > 0, "No flushed data reached memory in {}".format(test_output))
+
 
 #####
+    # Sum the Sum.u64 field of the named accumulator statistics per component
+    def _sum_statistics(self, outfile, stats):
+        sums = {}
+        with open(outfile) as fp:
+            for line in fp:
+                match = re.match(r"\s*(\S+)\.(\w+) : Accumulator : Sum\.u64 = (\d+);", line)
+                if match and match.group(2) in stats:
+                    sums[match.group(1)] = sums.get(match.group(1), 0) + int(match.group(3))
+        return sums
+
+    def memh_compare_ref(self, testname, cmpfile, reffile):
+        cmp_result = testing_compare_diff(testname, cmpfile, reffile)
+        if cmp_result == False:
+            diffdata = testing_get_diff_data(testname)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output file {} does not match Reference File {}".format(cmpfile, reffile))
+
 
     def memh_template_backing(self, teststr, testnum, seed0, seed1, seed2, seed3, backing_infile=None, backing_reffile=None, backing_outfile=None, ignore_err_file=False, testtimeout=240):
 
@@ -117,4 +178,35 @@ class testcase_memHierarchy_memory(SSTTestCase):
         self.assertFalse(os_test_file(test_err, "-s"), "Error file is non-empty {}".format(test_err))
 
 
+    def memh_template_throughput(self, pattern, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        test_run_dir = self.get_test_output_run_dir()
+
+        test_config = "{}/testBackendThroughput.py".format(test_path)
+        test_output = "{}/test_memHierarchy_memory_throughput_{}.out".format(test_run_dir, pattern)
+        test_err    = "{}/test_memHierarchy_memory_throughput_{}.err".format(test_run_dir, pattern)
+        test_mpi_output = "{}/test_memHierarchy_memory_throughput_{}.testfile".format(test_run_dir, pattern)
+        test_cmp = "{}/test_memHierarchy_memory_throughput_{}.cmp".format(self.get_test_output_tmp_dir(), pattern)
+        test_ref = "{}/refFiles/test_memHierarchy_memory_throughput_{}.out".format(test_path, pattern)
+
+        args = '--model-options="{}"'.format(pattern)
+
+        self.run_sst(test_config, test_output, test_err, other_args=args, set_cwd=test_path,
+                     timeout_sec=testtimeout, mpi_out_files=test_mpi_output)
+
+        with open(test_output) as fn:
+            self.assertIn("Simulation is complete", fn.read(), "No end of simulation detected in output file {}".format(test_output))
+
+        self.assertFalse(os_test_file(test_err, "-s"), "Error file is non-empty {}".format(test_err))
 
+        # Without caches every generated request reaches the backend exactly once
+        issued = self._sum_statistics(test_output, ["reads", "writes"])
+        received = self._sum_statistics(test_output, ["requests_received_GetS", "requests_received_GetSX",
+                                                      "requests_received_GetX", "requests_received_Write",
+                                                      "requests_received_PutM"])
+        with open(test_cmp, "w") as fp:
+            for comp in sorted(issued):
+                fp.write("{} issued {}\n".format(comp, issued[comp]))
+            for comp in sorted(received):
+                fp.write("{} received {}\n".format(comp, received[comp]))
+        self.memh_compare_ref("test_memHierarchy_memory_throughput_{}".format(pattern), test_cmp, test_ref)
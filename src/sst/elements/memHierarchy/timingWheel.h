@@ -0,0 +1,100 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_TIMINGWHEEL_H
+#define MEMHIERARCHY_TIMINGWHEEL_H
+
+#include <stdint.h>
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Time-ordered event queue for a clocked component.
+ *
+ * Drop-in for a std::multimap<uint64_t, T> used as a send queue: events come
+ * out in time order and, for equal times, in insertion order. Events within
+ * 'slots' cycles of the oldest pending time go into a ring of per-cycle
+ * buckets. Events further out wait in an overflow map until the ring reaches them.
+ *
+ * Insert times must not be older than the oldest time still pending (or the
+ * last time passed to ready()).
+ */
+template<typename T>
+class TimingWheel {
+public:
+    TimingWheel(uint32_t slots = 64) : head_(0), size_(0) {
+        uint32_t n = 1;
+        while (n < slots) n <<= 1;
+        slots_.resize(n);
+        mask_ = n - 1;
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    void insert(uint64_t time, T ev) {
+        if (time - head_ <= mask_)
+            slots_[time & mask_].push_back(ev);
+        else
+            overflow_.insert(std::make_pair(time, ev));
+        size_++;
+    }
+
+    /* Is there an event with a time strictly less than 'time'? Positions front() on it. */
+    bool ready(uint64_t time) {
+        if (size_ == 0) {
+            if (head_ < time) head_ = time;
+            return false;
+        }
+        while (head_ < time) {
+            if (!slots_[head_ & mask_].empty())
+                return true;
+            advance();
+        }
+        return false;
+    }
+
+    T front() { return slots_[head_ & mask_].front(); }
+
+    void pop() {
+        slots_[head_ & mask_].pop_front();
+        size_--;
+    }
+
+private:
+    void advance() {
+        head_++;
+        uint64_t horizon = head_ + mask_;
+        while (!overflow_.empty() && overflow_.begin()->first <= horizon) {
+            slots_[overflow_.begin()->first & mask_].push_back(overflow_.begin()->second);
+            overflow_.erase(overflow_.begin());
+        }
+    }
+
+    std::vector<std::deque<T> > slots_;
+    std::multimap<uint64_t, T> overflow_;
+    uint64_t head_;     // Oldest time that may still have events in the ring
+    uint64_t mask_;
+    size_t size_;
+};
+
+}
+}
+
+#endif /* MEMHIERARCHY_TIMINGWHEEL_H */
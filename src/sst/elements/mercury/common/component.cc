@@ -15,19 +15,19 @@
 
 #include <mercury/common/component.h>
 
+#include <atomic>
+
 namespace SST {
 namespace Hg {
 
-static int _self_id_(-1);
+static std::atomic<int> _self_id_(-1);
 
 template<> int HgBase<SST::Component>::self_id() {
-    ++_self_id_;
-    return _self_id_;
+    return ++_self_id_;
   }
 
 template<> int HgBase<SST::SubComponent>::self_id() {
-    ++_self_id_;
-    return _self_id_;
+    return ++_self_id_;
   }
 
 template class HgBase<SST::Component>;
@@ -22,6 +22,7 @@
 #include <mercury/common/events.h>
 #include <mercury/common/timestamp.h>
 #include <cstdint>
+#include <mutex>
 
 namespace SST {
 namespace Hg {
@@ -36,12 +37,15 @@ public:
 HgBase(uint32_t id) :
     CoreBase(id)
   {
-    static int selfid = 0;
-    if (!time_converter_){
-      time_converter_ = CoreBase::getTimeConverter(_tick_spacing_string_);
+    {
+      // Components on different threads are constructed concurrently
+      static std::mutex init_lock;
+      std::lock_guard<std::mutex> lock(init_lock);
+      if (!time_converter_){
+        time_converter_ = CoreBase::getTimeConverter(_tick_spacing_string_);
+      }
     }
     self_link_ = CoreBase::configureSelfLink("HgComponent" + std::to_string(self_id()), time_converter_,new SST::Event::Handler2<HgBase,&HgBase::handleExecutionEvent>(this));
-    ++selfid;
 
     RankInfo num_ranks = CoreBase::getNumRanks();
     nthread_ = num_ranks.thread;
@@ -52,8 +52,15 @@ NodeCL::NodeCL(ComponentId_t id, Params &params)
 
   out_->debug(CALL_INFO, 1, 0, "instantiating memory model\n");
   mem_ = new MemoryModel(params,this);
+  roofline_ = nullptr;
+  std::string mem_model = params.find<std::string>("memory_model", "flow");
+  if (mem_model == "roofline") {
+    roofline_ = new RooflineModel(params,this);
+  } else if (mem_model != "flow") {
+    out_->fatal(CALL_INFO, -1, "unknown memory_model %s\n", mem_model.c_str());
+  }
   out_->debug(CALL_INFO, 1, 0, "instantiating instruction processor\n");
-  proc_ = new InstructionProcessor(params,mem_,this);
+  proc_ = new InstructionProcessor(params,mem_,roofline_,this);
 
   out_->debug(CALL_INFO, 1, 0, "exiting constructor\n");
 }
@@ -23,6 +23,7 @@
 #include <mercury/components/operating_system_CL.h>
 #include <mercury/libraries/compute/instruction_processor.h>
 #include <mercury/libraries/compute/memory_model.h>
+#include <mercury/libraries/compute/roofline_model.h>
 #include <cstdint>
 #include <memory>
 
@@ -50,10 +51,23 @@ public:
       SST::Hg::NodeBase
   )
 
+  SST_ELI_DOCUMENT_PARAMS(
+    {"memory_model", "Node memory model: flow (packetized channel flows) or roofline (analytic bandwidth sharing)", "flow"},
+    {"frequency", "Core clock frequency", "2.0 GHz"},
+    {"parallelism", "Instructions retired per cycle per thread", "1.0"},
+    {"negligible_compute_bytes", "Kernels touching at most this many bytes skip the memory model", "64B"},
+    {"channel_bandwidth", "Bandwidth of a single memory channel", "12.0 GB/s"},
+    {"num_channels", "Number of memory channels", "4"},
+    {"flow_mtu", "Request size used by the flow memory model", "512"},
+    {"core_memory_bandwidth", "Roofline model: peak memory bandwidth of one thread", "channel_bandwidth"},
+    {"node_memory_bandwidth", "Roofline model: memory bandwidth shared by all threads on the node", "num_channels*channel_bandwidth"},
+  )
+
   NodeCL(SST::ComponentId_t id, SST::Params &params);
   ~NodeCL() {
     delete proc_;
     delete mem_;
+    delete roofline_;
   }
 
   int ncores() { return ncores_; }
@@ -68,6 +82,7 @@ private:
   int nsockets_;
   InstructionProcessor* proc_;
   MemoryModel* mem_;
+  RooflineModel* roofline_;
   OperatingSystemCL* osCL_;
 };
 
@@ -30,6 +30,8 @@
 #include <sst/core/params.h>
 #include <stdlib.h>
 #include <sys/mman.h>
+#include <atomic>
+#include <mutex>
 #include <sst/core/component.h> // or
 #include <sst/core/subcomponent.h> // or
 #include <sst/core/componentExtension.h>
@@ -62,6 +64,10 @@ std::vector<OperatingSystem*> OperatingSystem::active_os_;
 
 std::map<std::string,SST::Hg::loaderAPI*> OperatingSystem::loaders_;
 
+// Guards the process-wide state set up by the first OperatingSystem;
+// operating systems on different threads are constructed concurrently
+static std::mutex statics_lock_;
+
 class DeleteThreadEvent :
     public ExecutionEvent
 {
@@ -87,6 +93,7 @@ OperatingSystem::OperatingSystem(SST::ComponentId_t id, SST::Params& params, Nod
   next_mutex_(0),
   params_(params)
 {
+  std::unique_lock<std::mutex> statics_guard(statics_lock_);
   TimeDelta::initStamps(TimeDelta::ASEC_PER_TICK);
 
   if (active_os_.size() == 0){
@@ -94,16 +101,6 @@ OperatingSystem::OperatingSystem(SST::ComponentId_t id, SST::Params& params, Nod
     active_os_.resize(num_ranks.thread);
   }
 
-  my_addr_ = node_->addr();
-
-  next_outgoing_id_.src_node = my_addr_;
-  next_outgoing_id_.msg_num = 0;
-  verbose_ = params.find<unsigned int>("verbose", 1);
-  out_ = std::unique_ptr<SST::Output>(
-      new SST::Output(sprintf("Node%d:HgOperatingSystem:", my_addr_), verbose_, 0,
-                      Output::STDOUT));
-  out_->debug(CALL_INFO, 1, 0, "constructing\n");
-
   if (sst_hg_nullptr == nullptr){
 
     int range_bit_size = 30;
@@ -120,19 +117,33 @@ OperatingSystem::OperatingSystem(SST::ComponentId_t id, SST::Params& params, Nod
   }
 
   if (!time_converter_){
-      time_converter_ = SST::BaseComponent::getTimeConverter(tickIntervalString());
-    }
+    time_converter_ = SST::BaseComponent::getTimeConverter(tickIntervalString());
+  }
+  SST::TimeConverter time_converter = time_converter_;
+  //the stack pool settings are process-wide, the first os sets them
+  StackAlloc::init(params);
+  statics_guard.unlock();
+
+  my_addr_ = node_->addr();
+
+  next_outgoing_id_.src_node = my_addr_;
+  next_outgoing_id_.msg_num = 0;
+  verbose_ = params.find<unsigned int>("verbose", 1);
+  out_ = std::unique_ptr<SST::Output>(
+      new SST::Output(sprintf("Node%d:HgOperatingSystem:", my_addr_), verbose_, 0,
+                      Output::STDOUT));
+  out_->debug(CALL_INFO, 1, 0, "constructing\n");
 
   // These are libraries that a SST::Hg::Library depends on. We have core load them early
   // in hopes that everything is in place when the SST::Hg::Library is instanced.
   requireDependencies(params_,*this);
 
   // Configure self link to handle event timing
-  selfEventLink_ = configureSelfLink("self", time_converter_, new Event::Handler2<Hg::OperatingSystem,&OperatingSystem::handleEvent>(this));
+  selfEventLink_ = configureSelfLink("self", time_converter, new Event::Handler2<Hg::OperatingSystem,&OperatingSystem::handleEvent>(this));
   assert(selfEventLink_);
-  selfEventLink_->setDefaultTimeBase(time_converter_);
+  selfEventLink_->setDefaultTimeBase(time_converter);
 
-  StackAlloc::init(params);
+  print_stack_stats_ = params.find<bool>("print_stack_stats", false);
   initThreading(params);
 }
 
@@ -163,6 +174,15 @@ OperatingSystem::setup() {
 
 //static thread_lock loader_lock;
 
+void
+OperatingSystem::finish() {
+  //the stack pool is shared by every os in the process, report it once
+  static std::atomic<bool> stack_stats_printed(false);
+  if (print_stack_stats_ && !stack_stats_printed.exchange(true)){
+    StackAlloc::printStats(*out_);
+  }
+}
+
 void
 OperatingSystem::requireDependencies(SST::Params& params, SST::Hg::OperatingSystem& me) {
   std::vector<std::string> libs;
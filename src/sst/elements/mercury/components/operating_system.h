@@ -57,6 +57,8 @@ SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
 
   void setup() override;
 
+  void finish() override;
+
   void handleEvent(SST::Event *ev) override;
 
   bool clockTic(SST::Cycle_t) override {
@@ -152,6 +154,8 @@ protected:
   ThreadContext *des_context_;
 
   unsigned int verbose_;
+
+  bool print_stack_stats_;
   unsigned int nranks_;
   unsigned int npernode_;
   Thread* blocked_thread_;
@@ -15,6 +15,8 @@
 
 #pragma once
 
+#include <mercury/common/timestamp.h>
+
 namespace SST {
 namespace Hg {
 
@@ -26,7 +28,23 @@ class ComputeAPI
   virtual void computeBlockMemcpy(uint64_t bytes) = 0;
   virtual void write(uint64_t bytes) = 0;
   virtual void copy(uint64_t bytes) = 0;
+
+  /**
+   * Charge a kernel to the node's processor and memory models.
+   * Runtime is bounded below by both the instruction count and the
+   * bytes streamed, so memory-bound kernels slow down when other
+   * ranks on the node are streaming at the same time.
+   * @param flops   Floating point operations executed
+   * @param intops  Integer operations executed
+   * @param bytes   Bytes moved to or from main memory
+   * @param nthread Number of cores the kernel is spread over
+   */
+  virtual void computeKernel(uint64_t flops, uint64_t intops,
+                             uint64_t bytes, int nthread = 1) = 0;
 };
 
+/** The compute library of the calling skeleton thread */
+ComputeAPI* computeApi();
+
 } // end namespace Hg
 } // end namespace SST
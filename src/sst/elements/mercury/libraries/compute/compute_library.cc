@@ -18,10 +18,17 @@
 #include <mercury/components/operating_system_CL.h>
 #include <mercury/libraries/compute/compute_library.h>
 #include <mercury/operating_system/process/app.h>
+#include <mercury/operating_system/process/thread.h>
 
 namespace SST {
 namespace Hg {
 
+ComputeAPI* computeApi()
+{
+  Thread* t = OperatingSystem::currentThread();
+  return t->getLibrary<ComputeLibrary>("ComputeLibrary");
+}
+
 ComputeLibrary::ComputeLibrary(SST::Params &params, App *parent)
     : Library(params, parent)
 {
@@ -64,6 +71,16 @@ ComputeLibrary::copy(uint64_t bytes)
   doAccess(bytes);
 }
 
+void
+ComputeLibrary::computeKernel(uint64_t flops, uint64_t intops,
+                              uint64_t bytes, int nthread)
+{
+  if (nthread < 1) {
+    sst_hg_abort_printf("ComputeLibrary can't compute a kernel on %d threads", nthread);
+  }
+  computeDetailed(flops, intops, bytes, nthread);
+}
+
 void
 ComputeLibrary::doAccess(uint64_t bytes)
 {
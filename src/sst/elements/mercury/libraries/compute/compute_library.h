@@ -50,6 +50,9 @@ class ComputeLibrary : public ComputeAPI, public Library
 
   void copy(uint64_t bytes) override;
 
+  void computeKernel(uint64_t flops, uint64_t intops,
+                     uint64_t bytes, int nthread = 1) override;
+
   private:
 
   void doAccess(uint64_t bytes);
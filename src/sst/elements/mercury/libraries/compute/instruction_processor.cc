@@ -21,8 +21,9 @@
 namespace SST {
 namespace Hg {
 
-InstructionProcessor::InstructionProcessor(SST::Params& params, MemoryModel* mem, NodeCL* node) :
-mem_(mem), nodeCL_(node)
+InstructionProcessor::InstructionProcessor(SST::Params& params, MemoryModel* mem,
+                                           RooflineModel* roofline, NodeCL* node) :
+mem_(mem), roofline_(roofline), nodeCL_(node)
 {
   negligible_bytes_ = params.find<SST::UnitAlgebra>("negligible_compute_bytes", "64B").getRoundedValue();
 
@@ -60,6 +61,9 @@ InstructionProcessor::compute(Event* ev, ExecutionEvent* cb)
   uint64_t bytes = st.mem_sequential;
   if (bytes <= negligible_bytes_) {
     nodeCL_->sendDelayedExecutionEvent(instr_time, cb);
+  } else if (roofline_) {
+    //overlap compute with a bandwidth-shared memory stream
+    roofline_->access(bytes, instr_time, nthread, cb);
   } else {
     //do the full memory modeling
     TimeDelta byte_request_delay = instr_time / bytes;
@@ -18,6 +18,7 @@
 #include <sst/core/params.h>
 #include <mercury/common/timestamp.h>
 #include <mercury/libraries/compute/memory_model.h>
+#include <mercury/libraries/compute/roofline_model.h>
 
 namespace SST {
 namespace Hg {
@@ -26,7 +27,8 @@ class InstructionProcessor {
  public:
 
   InstructionProcessor(SST::Params& params,
-                        MemoryModel* mem, NodeCL* nd);
+                        MemoryModel* mem, RooflineModel* roofline,
+                        NodeCL* nd);
 
   ~InstructionProcessor() { }
 
@@ -40,6 +42,7 @@ class InstructionProcessor {
   TimeDelta instructionTime(BasicComputeEvent* msg);
 
   MemoryModel* mem_;
+  RooflineModel* roofline_;
   NodeCL* nodeCL_;
 
   TimeDelta tflop_;
@@ -0,0 +1,139 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <mercury/libraries/compute/roofline_model.h>
+#include <mercury/common/errors.h>
+#include <mercury/components/operating_system.h>
+#include <mercury/components/node_CL.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace SST {
+namespace Hg {
+
+RooflineModel::RooflineModel(SST::Params &params, NodeCL* parent) :
+  parent_node_(parent),
+  kernel_id_(0),
+  epoch_(0)
+{
+  // default to the same peak as the flow model: one channel per stream,
+  // num_channels streams at once
+  double channel_bw = params.find<SST::UnitAlgebra>("channel_bandwidth",
+                        "12.0 GB/s").getValue().toDouble();
+  int num_channels = params.find<int>("num_channels",4);
+  core_bandwidth_ = channel_bw;
+  if (params.contains("core_memory_bandwidth")){
+    core_bandwidth_ = params.find<SST::UnitAlgebra>("core_memory_bandwidth")
+                        .getValue().toDouble();
+  }
+  node_bandwidth_ = channel_bw * num_channels;
+  if (params.contains("node_memory_bandwidth")){
+    node_bandwidth_ = params.find<SST::UnitAlgebra>("node_memory_bandwidth")
+                        .getValue().toDouble();
+  }
+  if (core_bandwidth_ <= 0 || node_bandwidth_ <= 0){
+    sst_hg_abort_printf("roofline memory model requires positive bandwidths");
+  }
+}
+
+void
+RooflineModel::access(uint64_t bytes, TimeDelta compute_time, int nthread,
+                      ExecutionEvent* cb)
+{
+  advance();
+  Kernel& k = kernels_[kernel_id_++];
+  k.callback = cb;
+  k.compute_done = parent_node_->os()->now() + compute_time;
+  k.bytes_left = bytes;
+  k.max_rate = core_bandwidth_ * std::max(nthread, 1);
+  k.rate = 0;
+  rebalance();
+}
+
+void
+RooflineModel::advance()
+{
+  Timestamp now = parent_node_->os()->now();
+  double dt = (now - last_update_).sec();
+  last_update_ = now;
+  if (dt <= 0) return;
+
+  for (auto& pair : kernels_){
+    Kernel& k = pair.second;
+    k.bytes_left = std::max(0.0, k.bytes_left - k.rate * dt);
+  }
+}
+
+void
+RooflineModel::rebalance()
+{
+  OperatingSystem* os = parent_node_->os();
+  Timestamp now = os->now();
+
+  // retire drained kernels, they only wait on the compute bound now
+  for (auto it = kernels_.begin(); it != kernels_.end(); ){
+    Kernel& k = it->second;
+    if (k.bytes_left < 1.0){
+      os->sendExecutionEvent(std::max(now, k.compute_done), k.callback);
+      it = kernels_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+
+  ++epoch_;
+  if (kernels_.empty()) return;
+
+  // max-min fair share: kernels capped below the fair share
+  // hand the remainder to the others
+  std::vector<Kernel*> order;
+  order.reserve(kernels_.size());
+  for (auto& pair : kernels_){
+    order.push_back(&pair.second);
+  }
+  std::sort(order.begin(), order.end(), [](Kernel* a, Kernel* b){
+    return a->max_rate < b->max_rate;
+  });
+
+  double bw_left = node_bandwidth_;
+  size_t nleft = order.size();
+  double next_drain = std::numeric_limits<double>::max();
+  for (Kernel* k : order){
+    k->rate = std::min(k->max_rate, bw_left / nleft);
+    bw_left -= k->rate;
+    --nleft;
+    next_drain = std::min(next_drain, k->bytes_left / k->rate);
+  }
+
+  // round up a tick so the drain event never fires before the bytes are gone
+  TimeDelta delay = TimeDelta(next_drain) + TimeDelta(1, TimeDelta::exact);
+  os->sendDelayedExecutionEvent(delay, newCallback(this, &RooflineModel::drain, epoch_));
+}
+
+void
+RooflineModel::drain(uint64_t epoch)
+{
+  // a kernel arrived or drained since this was scheduled
+  if (epoch != epoch_) return;
+
+  advance();
+  rebalance();
+}
+
+} // end namespace Hg
+} // end namespace SST
@@ -0,0 +1,73 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#pragma once
+
+#include <mercury/common/events.h>
+#include <mercury/common/timestamp.h>
+#include <mercury/components/node_CL_fwd.h>
+#include <sst/core/params.h>
+
+#include <map>
+
+namespace SST {
+namespace Hg {
+
+/**
+ * Analytic node memory model. Every active kernel streams its bytes at a
+ * fluid rate: the node memory bandwidth is split max-min fairly between
+ * kernels, and no kernel may exceed core_memory_bandwidth per thread.
+ * A kernel finishes at max(compute time, memory time), i.e. the roofline
+ * bound, but memory time stretches when other ranks on the node contend
+ * for bandwidth. Rates are only recomputed when a kernel starts or drains,
+ * so the event count is independent of the number of bytes moved.
+ */
+class RooflineModel {
+ public:
+  RooflineModel(SST::Params& params, NodeCL* parent);
+
+  ~RooflineModel() {}
+
+  std::string toString() const { return "roofline memory model"; }
+
+  void access(uint64_t bytes, TimeDelta compute_time, int nthread,
+              ExecutionEvent* cb);
+
+ private:
+  struct Kernel {
+    ExecutionEvent* callback;
+    Timestamp compute_done;
+    double bytes_left;
+    double max_rate;
+    double rate;
+  };
+
+  void advance();
+
+  void rebalance();
+
+  void drain(uint64_t epoch);
+
+  NodeCL* parent_node_;
+  std::map<uint64_t, Kernel> kernels_;
+  Timestamp last_update_;
+  double node_bandwidth_;
+  double core_bandwidth_;
+  uint64_t kernel_id_;
+  uint64_t epoch_;
+};
+
+} // end namespace Hg
+} // end namespace SST
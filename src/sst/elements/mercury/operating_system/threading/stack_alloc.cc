@@ -22,8 +22,11 @@
 #include <mercury/operating_system/threading/stack_alloc_chunk.h>
 #include <mercury/operating_system/threading/thread_lock.h>
 
+#include <sys/mman.h>
 #include <unistd.h>
 
+#include <algorithm>
+
 namespace SST {
 namespace Hg {
 
@@ -31,6 +34,17 @@ StackAlloc::chunk_set StackAlloc::chunks_;
 size_t StackAlloc::suggested_chunk_ = 0;
 size_t StackAlloc::stacksize_ = 0;
 bool StackAlloc::protect_stacks_ = false;
+bool StackAlloc::guard_pages_ = false;
+bool StackAlloc::release_stacks_ = false;
+size_t StackAlloc::live_ = 0;
+size_t StackAlloc::peak_live_ = 0;
+uint64_t StackAlloc::total_allocs_ = 0;
+uint64_t StackAlloc::reused_allocs_ = 0;
+size_t StackAlloc::max_resident_ = 0;
+bool StackAlloc::track_resident_ = false;
+
+//alloc and free must share the same lock
+static thread_lock stack_lock;
 
 extern "C" {
 int sst_hg_global_stacksize;
@@ -49,11 +63,23 @@ StackAlloc::init(SST::Params& params)
   if (stack_rem != 0){
     sst_hg_global_stacksize += (4096 - stack_rem);
   }
-  std::string chunk = Hg::sprintf("%dB", 8*sst_hg_global_stacksize);
+  //chunks only reserve address space, so they can be large
+  std::string chunk = Hg::sprintf("%dB", 64*sst_hg_global_stacksize);
   suggested_chunk_ = params.find<SST::UnitAlgebra>("stack_chunk_size", chunk).getRoundedValue();
   stacksize_ = sst_hg_global_stacksize;
 
   protect_stacks_ = params.find<bool>("protect_stacks", false);
+  //each guard page splits the mapping - large rank counts may need a
+  //larger vm.max_map_count
+  guard_pages_ = params.find<bool>("stack_guard_pages", false);
+  release_stacks_ = params.find<bool>("release_stacks", false);
+  //mincore on every free is only worth it when the footprint is reported
+  track_resident_ = params.find<bool>("print_stack_stats", false);
+
+  if (guard_pages_ && stacksize_ < 4*4096){
+    sst_hg_throw_printf(ValueError,
+        "stack_size must be at least 16KB to use stack_guard_pages");
+  }
 }
 
 void
@@ -74,25 +100,41 @@ StackAlloc::chunk_set::clear()
 void*
 StackAlloc::alloc()
 {
-  static thread_lock lock;
-  lock.lock();
+  stack_lock.lock();
   if (stacksize_ == 0) {
     sst_hg_throw_printf(ValueError, "stackalloc::stacksize was not initialized");
   }
 
-  if(chunks_.available.empty()){
-    // grab a new chunk.
-    chunk* new_chunk = new chunk(stacksize_, suggested_chunk_, protect_stacks_);
-    chunks_.allocations.push_back(new_chunk);
-    void* buf = new_chunk->getNextStack();
-    while (buf != nullptr){
-      chunks_.available.push_back(buf);
+  void* buf;
+  if (!chunks_.available.empty()){
+    buf = chunks_.available.back();
+    chunks_.available.pop_back();
+    ++reused_allocs_;
+  } else {
+    //carve the next stack out of the newest chunk, grabbing a new one
+    //when it is exhausted - untouched stacks never commit any memory
+    buf = chunks_.allocations.empty() ? nullptr : chunks_.allocations.back()->getNextStack();
+    if (buf == nullptr){
+      chunk* new_chunk = new chunk(stacksize_, suggested_chunk_, protect_stacks_);
+      chunks_.allocations.push_back(new_chunk);
       buf = new_chunk->getNextStack();
+      if (buf == nullptr){
+        sst_hg_throw_printf(ValueError,
+            "stack_chunk_size %llu is too small for stack_size %llu",
+            (unsigned long long) suggested_chunk_, (unsigned long long) stacksize_);
+      }
+    }
+    if (guard_pages_){
+      //page 0 holds the thread-local metadata, so the guard sits right
+      //above it where an overflowing stack would run into it
+      mprotect((char*)buf + 4096, 4096, PROT_NONE);
     }
   }
-  void *buf = chunks_.available.back();
-  chunks_.available.pop_back();
-  lock.unlock();
+
+  ++total_allocs_;
+  ++live_;
+  peak_live_ = std::max(peak_live_, live_);
+  stack_lock.unlock();
   return buf;
 }
 
@@ -101,10 +143,53 @@ StackAlloc::alloc()
 //
 void StackAlloc::free(void* buf)
 {
-  static thread_lock lock;
-  lock.lock();
+  size_t resident = track_resident_ ? residentBytes(buf) : 0;
+  if (release_stacks_){
+    madvise(buf, stacksize_, MADV_DONTNEED);
+  }
+
+  stack_lock.lock();
+  if (track_resident_){
+    max_resident_ = std::max(max_resident_, resident);
+  }
   chunks_.available.push_back(buf);
-  lock.unlock();
+  --live_;
+  stack_lock.unlock();
+}
+
+size_t
+StackAlloc::residentBytes(void* buf)
+{
+  static const size_t page_size = sysconf(_SC_PAGESIZE);
+  std::vector<unsigned char> pages(stacksize_ / page_size);
+  if (mincore(buf, stacksize_, pages.data()) != 0){
+    return 0;
+  }
+  size_t resident = 0;
+  for (unsigned char p : pages){
+    if (p & 1) resident += page_size;
+  }
+  return resident;
+}
+
+size_t
+StackAlloc::reserved()
+{
+  stack_lock.lock();
+  size_t nchunks = chunks_.allocations.size();
+  stack_lock.unlock();
+  return nchunks * ((protect_stacks_) ? 2 * suggested_chunk_ : suggested_chunk_);
+}
+
+void
+StackAlloc::printStats(SST::Output& out)
+{
+  out.output("Stack pool: %llu stacks of %lluB, %llu recycled, peak live %llu, "
+             "%lluB reserved, max stack footprint %lluB, peak committed <= %lluB\n",
+             (unsigned long long) total_allocs_, (unsigned long long) stacksize_,
+             (unsigned long long) reused_allocs_, (unsigned long long) peak_live_,
+             (unsigned long long) reserved(), (unsigned long long) max_resident_,
+             (unsigned long long) peakCommitted());
 }
 
 
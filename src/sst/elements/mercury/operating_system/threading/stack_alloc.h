@@ -16,7 +16,9 @@
 #pragma once
 
 #include <sst/core/params.h>
+#include <sst/core/output.h>
 
+#include <cstdint>
 #include <cstring>
 #include <vector>
 
@@ -29,8 +31,14 @@ namespace Hg {
  * which allocates uniform-size chunks (with the NX bit unset)
  * and sets guard pages on each side of the allocated stacks.
  *
- * This allocator does not return memory to the system until it is
- * deleted, but regions can be allocated and free-d repeatedly.
+ * Chunks only reserve address space (MAP_NORESERVE); pages are committed
+ * by the kernel on first touch.  Stacks of finished threads are recycled
+ * LIFO so the hottest stack is reused first.  With release_stacks set,
+ * the pages of a free-d stack are handed back to the system so the
+ * committed footprint follows the number of live threads.
+ *
+ * This allocator does not unmap memory until it is deleted, but regions
+ * can be allocated and free-d repeatedly.
  */
 class StackAlloc
 {
@@ -52,6 +60,23 @@ class StackAlloc
   static size_t stacksize_;
   /// Optionally added a protected stack between each stack we return
   static bool protect_stacks_;
+  /// Optionally protect the page just above the TLS page of each stack
+  static bool guard_pages_;
+  /// Return the pages of free-d stacks to the system
+  static bool release_stacks_;
+
+  /// Number of stacks currently handed out and its high water mark
+  static size_t live_;
+  static size_t peak_live_;
+  /// Number of stacks handed out, and how many of those were recycled
+  static uint64_t total_allocs_;
+  static uint64_t reused_allocs_;
+  /// Largest committed footprint of a single stack, sampled at free
+  static size_t max_resident_;
+  /// Sample the footprint at free, only needed for the stack stats
+  static bool track_resident_;
+
+  static size_t residentBytes(void* buf);
 
  public:
   static size_t stacksize() {
@@ -74,6 +99,23 @@ class StackAlloc
 
   static void clear();
 
+  static size_t peakLive() {
+    return peak_live_;
+  }
+
+  static size_t maxResident() {
+    return max_resident_;
+  }
+
+  /// Upper bound on the committed stack memory at any point of the run
+  static size_t peakCommitted() {
+    return peak_live_ * max_resident_;
+  }
+
+  static size_t reserved();
+
+  static void printStats(SST::Output& out);
+
 };
 
 } // end of namespace Hg
@@ -36,8 +36,9 @@ StackAlloc::chunk::chunk(size_t stacksize, size_t suggested_chunk_size, bool pro
   stacksize_(stacksize),
   step_size_((protect_) ? 2 * stacksize_ : stacksize_)
 {
-  // Now allocate our chunk.
-  int mmap_flags = MAP_PRIVATE | MAP_ANON;
+  // Now allocate our chunk.  Only address space is reserved here, pages
+  // get committed on first touch.
+  int mmap_flags = MAP_PRIVATE | MAP_ANON | MAP_NORESERVE;
   addr_ = (char*)mmap(0, size_, PROT_READ | PROT_WRITE,
                       mmap_flags, -1, 0);
   if(addr_ == MAP_FAILED) {
@@ -1,5 +1,6 @@
 import sst
 import sst.hg
+import sys
 
 node0 = sst.Component("Node0", "hg.Node")
 os0 = node0.setSubComponent("os_slot", "hg.OperatingSystem")
@@ -11,5 +12,9 @@ os0.addParams({ "app1.name" : "ostest"})
 os0.addParams({ "app1.exe_library_name" : "ostest"})
 os0.addParams({ "app1.argv" : "arg1 arg2"})
 
+# Model option --stack-stats reports the user-thread stack pool at the end
+if "--stack-stats" in sys.argv[1:]:
+    os0.addParams({ "print_stack_stats" : "true"})
+
 #node0.addParams({ "verbose" : "100"})
 #os0.addParams({ "verbose" : "100"})
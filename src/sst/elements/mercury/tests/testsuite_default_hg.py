@@ -1,5 +1,6 @@
 # -*- coding: utf-8 -*-
 import os
+import re
 import subprocess
 
 from sst_unittest import *
@@ -29,9 +30,38 @@ class testcase_hg(SSTTestCase):
             os.environ["SST_LIB_PATH"] = path + ":" + libdir
         self.simple_components_template("ostest")
 
+    def test_testme_mt(self):
+        # Same run split over two threads, the process-wide state is shared between them
+        self._set_lib_path()
+        self.simple_components_template("ostest", threads=2)
+
+    def test_testme_stack_stats(self):
+        # Same run with the stack pool report, which samples the committed
+        # footprint of every free-d stack
+        self._set_lib_path()
+        outfile = self.simple_components_template("ostest", testname="ostest_stack_stats",
+                                                  otherargs='--model-options=\"--stack-stats\"',
+                                                  filterout="Stack pool:")
+
+        with open(outfile) as fp:
+            match = re.search(r"Stack pool: (\d+) stacks of \d+B, \d+ recycled, peak live (\d+), "
+                              r"\d+B reserved, max stack footprint (\d+)B", fp.read())
+        self.assertIsNotNone(match, "No stack pool report in {0}".format(outfile))
+        self.assertTrue(int(match.group(1)) > 0, "Stack pool report in {0} has no stacks".format(outfile))
+        self.assertTrue(int(match.group(2)) > 0, "Stack pool report in {0} has no live stacks".format(outfile))
+        self.assertTrue(int(match.group(3)) > 0, "Stack pool report in {0} did not sample a stack footprint".format(outfile))
+
 #####
 
-    def simple_components_template(self, testcase, striptotail=0):
+    def _set_lib_path(self):
+        libdir = sstsimulator_conf_get_value("SST_ELEMENT_LIBRARY","SST_ELEMENT_LIBRARY_LIBDIR",str)
+        path = os.environ.get("SST_LIB_PATH")
+        if path is None or path == "":
+            os.environ["SST_LIB_PATH"] = libdir
+        else:
+            os.environ["SST_LIB_PATH"] = path + ":" + libdir
+
+    def simple_components_template(self, testcase, striptotail=0, threads=None, testname=None, otherargs="", filterout=None):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -39,21 +69,27 @@ class testcase_hg(SSTTestCase):
 
         # Set the various file paths
         testDataFileName="{0}".format(testcase)
+        runFileName = testDataFileName if testname is None else testname
+        if threads is not None:
+            runFileName = "{0}_mt{1}".format(runFileName, threads)
 
         sdlfile = "{0}/{1}.py".format(test_path, testDataFileName)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
-        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
-        tmpfile = "{0}/{1}.tmp".format(tmpdir, testDataFileName)
-        cmpfile = "{0}/{1}.cmp".format(tmpdir, testDataFileName)
-        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
-        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, runFileName)
+        tmpfile = "{0}/{1}.tmp".format(tmpdir, runFileName)
+        cmpfile = "{0}/{1}.cmp".format(tmpdir, runFileName)
+        errfile = "{0}/{1}.err".format(outdir, runFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
 
-        self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+        self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, num_threads=threads)
 
         testing_remove_component_warning_from_file(outfile)
 
-        # Copy the outfile to the cmpfile
-        os.system("cp {0} {1}".format(outfile, cmpfile))
+        # Copy the outfile to the cmpfile, without the lines the reference does not have
+        with open(outfile) as src, open(cmpfile, "w") as dst:
+            for line in src:
+                if filterout is None or filterout not in line:
+                    dst.write(line)
 
         if striptotail == 1:
             # Post processing of the output data to scrub it into a format to compare
@@ -69,8 +105,9 @@ class testcase_hg(SSTTestCase):
         if os_test_file(errfile, "-s"):
             log_testing_note("hg test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
 
-        cmp_result = testing_compare_sorted_diff(testcase, cmpfile, reffile)
+        cmp_result = testing_compare_sorted_diff(runFileName, cmpfile, reffile)
         if (cmp_result == False):
-            diffdata = testing_get_diff_data(testcase)
+            diffdata = testing_get_diff_data(runFileName)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(cmpfile, reffile))
+        return outfile
@@ -0,0 +1,149 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CKPT_BLOCK_H
+#define _CKPT_BLOCK_H
+
+#include <stdio.h>
+#include <string.h>
+#include <assert.h>
+#include <inttypes.h>
+#include <vector>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+namespace SST {
+
+namespace MMU_Lib {
+
+// Checkpoint state that grows with the memory footprint, one record per page, is written as a
+// binary block inside the otherwise text checkpoint files. The block starts with the text line
+// "<name>: <numRecords> <rawBytes> <numBytes>" followed by numBytes of records. The records are
+// zlib compressed when compression was asked for, libz is available and it makes the block smaller,
+// numBytes less than rawBytes tells the reader the block is compressed.
+//
+// Records are packed one field at a time, least significant byte first, so no struct padding or
+// bitfield layout ends up in a checkpoint.
+
+class CkptPacker {
+  public:
+    template< class T >
+    void pack( T value ) {
+        for ( size_t i = 0; i < sizeof(T); i++ ) {
+            m_bytes.push_back( (uint8_t) ( (uint64_t) value >> ( 8 * i ) ) );
+        }
+    }
+    void reserve( size_t numBytes ) { m_bytes.reserve( numBytes ); }
+    const std::vector<uint8_t>& bytes() const { return m_bytes; }
+
+  private:
+    std::vector<uint8_t> m_bytes;
+};
+
+class CkptUnpacker {
+  public:
+    CkptUnpacker( const std::vector<uint8_t>& bytes ) : m_bytes( bytes ), m_pos( 0 ) {}
+
+    template< class T >
+    T unpack() {
+        assert( m_pos + sizeof(T) <= m_bytes.size() );
+        uint64_t value = 0;
+        for ( size_t i = 0; i < sizeof(T); i++ ) {
+            value |= (uint64_t) m_bytes[m_pos++] << ( 8 * i );
+        }
+        return (T) value;
+    }
+    bool done() const { return m_pos == m_bytes.size(); }
+
+  private:
+    const std::vector<uint8_t>& m_bytes;
+    size_t m_pos;
+};
+
+inline void writeCkptBlock( FILE* fp, const char* name, size_t numRecords, const std::vector<uint8_t>& bytes, bool compress = false )
+{
+    uint64_t rawBytes = bytes.size();
+    const uint8_t* data = bytes.data();
+    uint64_t numBytes = rawBytes;
+
+#ifdef HAVE_LIBZ
+    std::vector<uint8_t> buffer;
+    if ( compress && rawBytes ) {
+        uLongf destLen = compressBound( rawBytes );
+        buffer.resize( destLen );
+        int ret = compress2( buffer.data(), &destLen, data, rawBytes, Z_BEST_SPEED );
+        if ( Z_OK == ret && destLen < rawBytes ) {
+            data = buffer.data();
+            numBytes = destLen;
+        }
+    }
+#endif
+
+    fprintf( fp, "%s: %zu %" PRIu64 " %" PRIu64 "\n", name, numRecords, rawBytes, numBytes );
+    if ( numBytes ) {
+        size_t ret = fwrite( data, numBytes, 1, fp );
+        assert( 1 == ret );
+    }
+}
+
+inline void writeCkptBlock( FILE* fp, const char* name, size_t numRecords, const CkptPacker& packer, bool compress = false )
+{
+    writeCkptBlock( fp, name, numRecords, packer.bytes(), compress );
+}
+
+// returns the number of records, the packed records are left in bytes
+inline size_t readCkptBlock( FILE* fp, const char* name, std::vector<uint8_t>& bytes )
+{
+    char str[80];
+    size_t numRecords;
+    uint64_t rawBytes;
+    uint64_t numBytes;
+
+    int ret = fscanf( fp, "%79s %zu %" SCNu64 " %" SCNu64, str, &numRecords, &rawBytes, &numBytes );
+    assert( 4 == ret );
+    assert( 0 == strncmp( str, name, strlen(name) ) && ':' == str[strlen(name)] );
+    // the format can't skip whitespace after the numbers, the records could start with a whitespace byte
+    ret = fgetc( fp );
+    assert( '\n' == ret );
+
+    bytes.resize( rawBytes );
+
+    if ( numBytes == rawBytes ) {
+        if ( rawBytes ) {
+            ret = fread( bytes.data(), rawBytes, 1, fp );
+            assert( 1 == ret );
+        }
+    } else {
+#ifdef HAVE_LIBZ
+        std::vector<uint8_t> buffer( numBytes );
+        ret = fread( buffer.data(), numBytes, 1, fp );
+        assert( 1 == ret );
+        uLongf destLen = rawBytes;
+        ret = uncompress( bytes.data(), &destLen, buffer.data(), numBytes );
+        assert( Z_OK == ret && destLen == rawBytes );
+#else
+        fprintf( stderr, "Error: checkpoint block %s is compressed and libz is not available\n", name );
+        assert(0);
+#endif
+    }
+    return numRecords;
+}
+
+}
+}
+
+#endif
@@ -45,7 +45,8 @@ class MMU : public SubComponent {
 
     MMU(SST::ComponentId_t id, SST::Params& params);
     virtual ~MMU() {}
-    virtual void checkpoint( std::string ) = 0;
+    // compress is a request, the page tables are only compressed if libz is available
+    virtual void checkpoint( std::string, bool compress = false ) = 0;
     virtual void checkpointLoad( std::string ) = 0;
 
     virtual void init(unsigned int phase);
@@ -161,7 +161,7 @@ int SimpleMMU::getPerms( unsigned pid, uint32_t vpn ) {
     return  pte->perms;
 }
 
-void SimpleMMU::checkpoint( std::string dir ) {
+void SimpleMMU::checkpoint( std::string dir, bool compress ) {
 
     std::stringstream filename;
     filename << dir << "/" << getName();
@@ -173,7 +173,7 @@ void SimpleMMU::checkpoint( std::string dir ) {
     for ( auto & x : m_pageTableMap ) {
         auto pageTable = x.second;
         fprintf(fp,"pid: %i\n",x.first);
-        pageTable->checkpoint( fp );
+        pageTable->checkpoint( fp, compress );
     }
 
     fprintf(fp,"m_coreToPid.size() %zu\n", m_coreToPid.size());
@@ -19,6 +19,7 @@
 #include <sst/core/link.h>
 #include "mmu.h"
 #include "mmuTypes.h"
+#include "ckptBlock.h"
 
 namespace SST {
 
@@ -44,7 +45,7 @@ class SimpleMMU : public MMU {
     )
 
     SimpleMMU(SST::ComponentId_t id, SST::Params& params);
-    void checkpoint( std::string );
+    void checkpoint( std::string, bool compress );
     void checkpointLoad( std::string );
 
     virtual void removeWrite( unsigned pid );
@@ -105,18 +106,20 @@ class SimpleMMU : public MMU {
       public:
         PageTable() {}
         PageTable( SST::Output* output, FILE* fp ) {
-            int size;
-
-            assert( 1 == fscanf( fp, "pteMap.size() %d\n", &size ) );
-            output->debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"pteMap.size() %d\n",size);
-            for ( auto i = 0; i < size; i++ ) {
-                uint32_t vpn;
-                uint32_t ppn;
-                uint32_t perms;
-                assert( 3 == fscanf( fp, "vpn: %d, ppn: %d, perms: %x\n", &vpn, &ppn, &perms ) );
-                output->debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"vpn: %d, ppn: %d, perms: %x\n", vpn, ppn, perms );
-                pteMap[vpn] = PTE( ppn, perms );
+            std::vector<uint8_t> bytes;
+
+            size_t size = readCkptBlock( fp, "pteMap", bytes );
+            output->debug(CALL_INFO_LONG,1,MMU_DBG_CHECKPOINT,"pteMap.size() %zu\n",size);
+            CkptUnpacker records( bytes );
+            // the records were written in vpn order
+            for ( size_t i = 0; i < size; i++ ) {
+                uint32_t vpn = records.unpack<uint32_t>();
+                uint32_t ppn = records.unpack<uint32_t>();
+                uint32_t perms = records.unpack<uint32_t>();
+                output->debug(CALL_INFO_LONG,2,MMU_DBG_CHECKPOINT,"vpn: %d, ppn: %d, perms: %x\n", vpn, ppn, perms );
+                pteMap.emplace_hint( pteMap.end(), vpn, PTE( ppn, perms ) );
             }
+            assert( records.done() );
         }
 
         void add( uint32_t vpn, PTE pte ) {
@@ -142,11 +145,15 @@ class SimpleMMU : public MMU {
                 printf("PageTabl::%s() %s vpn=%d ppn=%d perm=%#x\n",__func__,str.c_str(),kv.first,kv.second.ppn,kv.second.perms);
             }
         }
-        void checkpoint( FILE* fp ) {
-            fprintf(fp,"pteMap.size() %zu\n",pteMap.size());
+        void checkpoint( FILE* fp, bool compress ) {
+            CkptPacker records;
+            records.reserve( pteMap.size() * 3 * sizeof(uint32_t) );
             for ( auto & x : pteMap ) {
-                fprintf(fp,"vpn: %d, ppn: %d, perms: %d \n", x.first,x.second.ppn,x.second.perms );
+                records.pack<uint32_t>( x.first );
+                records.pack<uint32_t>( x.second.ppn );
+                records.pack<uint32_t>( x.second.perms );
             }
+            writeCkptBlock( fp, "pteMap", pteMap.size(), records, compress );
         }
       private:
         std::map<uint32_t,PTE> pteMap;
@@ -74,21 +74,29 @@ Pool::Pool(Params params, SST::OpalComponent::MemType mem_type, int id)
 //Create free frames of size framesize, note that the size is in KB
 void Pool::build_mem()
 {
-	int i=0;
 	num_frames = ceil(size/frsize);
 	real_size = num_frames * frsize;
+	frbytes = (uint64_t) frsize*1024;
 
-	//std::vector<int> numbers;
-	//for(int i=0; i<num_frames; i++)       // add 0-99 to the vector
-    //	numbers.push_back(i);
+	frames.resize(num_frames);
+	for(int i=0; i< num_frames; i++) {
+		frames[i].starting_address = ((uint64_t) i*frbytes) + start;
+		frames[i].frame_number = i;
+	}
 
-    // random allocation of frames
-	//unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
-	//std::shuffle(numbers.begin(), numbers.end(), std::default_random_engine(seed));
+	// Every frame starts out free, the bits past the last frame stay clear
+	freemap.assign((num_frames + 63) / 64, 0);
+	for(int i=0; i< num_frames/64; i++)
+		freemap[i] = ~(uint64_t) 0;
+	if(num_frames % 64)
+		freemap[num_frames/64] = ((uint64_t) 1 << (num_frames % 64)) - 1;
+	freehint = 0;
 
-	for(i=0; i< num_frames; i++) {
-		freelist.push_back(((uint64_t) i*frsize*1024) + start);
-	}
+	// Single frames are handed out in the order they became free, starting in address order
+	freequeue.clear();
+	queued.assign(num_frames, true);
+	for(int i=0; i< num_frames; i++)
+		freequeue.push_back(i);
 
 	available_frames = num_frames;
 
@@ -96,51 +104,95 @@ void Pool::build_mem()
 
 }
 
+uint64_t Pool::findFree()
+{
+	// Entries taken by a contiguous allocation after they were queued are stale
+	while(!freequeue.empty() && !isFree(freequeue.front())) {
+		queued[freequeue.front()] = false;
+		freequeue.pop_front();
+	}
+	return freequeue.empty() ? num_frames : freequeue.front();
+}
+
+uint64_t Pool::findLowestFree()
+{
+	for(size_t w = freehint; w < freemap.size(); w++) {
+		if(freemap[w]) {
+			freehint = w;
+			return (w << 6) + __builtin_ctzll(freemap[w]);
+		}
+	}
+	freehint = freemap.size();
+	return num_frames;
+}
+
+uint64_t Pool::findFreeRun(int N)
+{
+	uint64_t run = 0;
+	for(uint64_t i = findLowestFree(); i < (uint64_t) num_frames; i++) {
+		if(!isFree(i)) {
+			run = 0;
+			// Skip fully allocated words
+			if(!freemap[i >> 6])
+				i = (i | 63);
+			continue;
+		}
+		if(++run == (uint64_t) N)
+			return i + 1 - N;
+	}
+	return num_frames;
+}
+
+void Pool::markAllocated(uint64_t index)
+{
+	freemap[index >> 6] &= ~((uint64_t) 1 << (index & 63));
+	frames[index].metadata = 0;
+	if(!freequeue.empty() && freequeue.front() == index) {
+		queued[index] = false;
+		freequeue.pop_front();
+	}
+	available_frames--;
+}
+
+void Pool::markFree(uint64_t index)
+{
+	freemap[index >> 6] |= ((uint64_t) 1 << (index & 63));
+	if((index >> 6) < freehint)
+		freehint = index >> 6;
+	// A frame still queued from before a contiguous allocation keeps its place
+	if(!queued[index]) {
+		queued[index] = true;
+		freequeue.push_back(index);
+	}
+	available_frames++;
+}
+
 REQRESPONSE Pool::allocate_frames(int pages)
+{
+	std::vector<uint64_t> addresses;
+	return allocate_frames(pages, addresses);
+}
+
+REQRESPONSE Pool::allocate_frames(int pages, std::vector<uint64_t>& addresses)
 {
 
 	REQRESPONSE response;
 	response.status =0;
 
-	if(available_frames < pages) {
+	if(available_frames < pages || pages <= 0) {
 		return response;
 	}
 
-	int frames = pages;
-	std::list<Frame*> frames_allocated;
-
 	// Fixme: Shuffle memory to make continuous memory available
-	while(frames) {
-		// Make sure pool has free frames in the requested memory pool type. If not deallocate allocated frames (if number of frames to be allocated are > 1)
-		if(freelist.empty()) {
-			while(!frames_allocated.empty()) {
-				Frame *frame = frames_allocated.front();
-				freelist.push_back(frame->starting_address);
-				alloclist.erase(frame->starting_address);
-				frames_allocated.pop_front();
-				available_frames++;
-				delete frame;
-			}
-			break;
-		}
-		else
-		{
-			uint64_t frameAddr = freelist.front();
-			freelist.erase(freelist.begin());
-			Frame *frame = new Frame(frameAddr,0);
-			alloclist[frame->starting_address] = frame;
-			frames_allocated.push_back(frame);
-			available_frames--;
-		}
-		frames--;
-
+	for(int i=0; i<pages; i++) {
+		uint64_t index = findFree();
+		markAllocated(index);
+		addresses.push_back(frames[index].starting_address);
 	}
 
-	if(!frames_allocated.empty()) {
-		response.address = (frames_allocated.front())->starting_address;
-		response.pages = pages;
-		response.status = 1;
-	}
+	response.address = addresses[addresses.size() - pages];
+	response.pages = pages;
+	response.status = 1;
 
 	return response;
 
@@ -153,29 +205,21 @@ REQRESPONSE Pool::allocate_frame(int N)
 	REQRESPONSE response;
 	response.status = 0;
 
-
 	// Make sure we have free frames first
-	if(freelist.empty())
+	if(available_frames < N || N <= 0)
 		return response;
 
-	// For now, we will assume you can only allocate 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating contigous physical spaces
-	if(N>1)
+	uint64_t index = (N == 1) ? findFree() : findFreeRun(N);
+	if(index >= (uint64_t) num_frames)
 		return response;
 
-	else
-	{
-		// Simply, pop the first free frame and assign it
-		uint64_t frameAddr = freelist.front();
-		freelist.erase(freelist.begin());
-		Frame *temp = new Frame(frameAddr,0);
-		alloclist[temp->starting_address] = temp;
-		available_frames--;
-		response.address = temp->starting_address;
-		response.pages = 1;
-		response.status = 1;
-		return response;
+	for(int i=0; i<N; i++)
+		markAllocated(index + i);
 
-	}
+	response.address = frames[index].starting_address;
+	response.pages = N;
+	response.status = 1;
+	return response;
 
 }
 
@@ -186,34 +230,26 @@ REQRESPONSE Pool::deallocate_frames(int pages, uint64_t starting_pAddress)
 {
 
 	REQRESPONSE response;
-	int frames = pages;
+	int remaining = pages;
 	uint64_t pAddress = starting_pAddress;
-	uint64_t frame_number;
 
-	while(frames) {
+	while(remaining) {
 
 		// If we can find the frame to be free in the allocated list
-		std::map<uint64_t, Frame*>::iterator it;
-		it = alloclist.find(pAddress);
-		if (it != alloclist.end())
+		if(isAllocated(pAddress))
 		{
-			//Remove from allocation map and add to free list
-			Frame *temp = it->second;
-			freelist.push_back(temp->starting_address);
-			alloclist.erase(pAddress);
-			delete temp;
+			markFree(frameIndex(pAddress));
 		}
 		else
 		{
 			response.address = pAddress; //physical address of the frame which failed to deallocate.
-			response.pages = frames; //This indicates number of frames that are not deallocated.
+			response.pages = remaining; //This indicates number of frames that are not deallocated.
 			response.status = 0;
 			return response;
 		}
 
-		frame_number = (pAddress - start) / frsize * 1024;
-		pAddress += ((uint64_t) (frame_number+1)*frsize*1024) + start; //to get the next frame physical address
-		frames--;
+		pAddress += frbytes; //to get the next frame physical address
+		remaining--;
 	}
 
 	response.status = 1; //successfully deallocated
@@ -227,68 +263,31 @@ REQRESPONSE Pool::deallocate_frame(uint64_t X, int N)
 	REQRESPONSE response;
 	response.status = 0;
 
+	// All N frames must be allocated before any of them is freed
+	for(int i=0; i<N; i++)
+		if(!isAllocated(X + i*frbytes))
+			return response;
 
-	// For now, we will assume you can free only 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating and freeing contigous physical spaces
-	if(N>1)
-		return response;
-	else
-	{
-		// If we can find the frame to be free in the allocated list
-		if(alloclist.find(X)!=alloclist.end())
-		{
-			// Remove from allocation map and add to free list
-			Frame * temp = alloclist[X];
-			freelist.push_back(temp->starting_address);
-			alloclist.erase(X);
-			delete temp;
-			available_frames++;
-			response.status = 1;
-		}
-		else // Means we couldn't find an allocated frame that is being unmapped
-			response.status = 0;
-
-	}
+	for(int i=0; i<N; i++)
+		markFree(frameIndex(X) + i);
 
+	response.status = 1;
 	return response;
 }
 
 bool Pool::isAllocated(uint64_t address)
 {
-	if(alloclist.find(address)==alloclist.end())
+	if(!contains(address) || (address - start) % frbytes)
 		return false;
 
-	return true;
+	return !isFree(frameIndex(address));
 }
 
-/*REQRESPONSE Pool::allocate_frame_address(uint64_t address)
+Frame* Pool::getFrame(uint64_t address)
 {
+	if(!contains(address))
+		return nullptr;
 
-	REQRESPONSE response;
-	response.status = 0;
-
-	// Make sure we have free frames first
-	if(freelist.empty())
-		return response;
-
-	// For now, we will assume you can only allocate 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating contigous physical spaces
-	if(N>1)
-		return response;
-
-	else
-	{
-		int index = freelist_index[address];
-		Frame * temp = freelist[index];
-		//freelist.remove(temp);
-		freelist.erase(freelist.begin()+index);
-		alloclist[temp->starting_address] = temp;
-		available_frames--;
-		response.address = temp->starting_address;
-		response.pages = 1;
-		response.status = 1;
-		return response;
-
-	}
-
-}*/
-
-
+	uint64_t index = frameIndex(address);
+	return isFree(index) ? nullptr : &frames[index];
+}
@@ -12,8 +12,8 @@
 
 #include "opal_event.h"
 
-#include <list>
-#include <map>
+#include <vector>
+#include <deque>
 #include <cmath>
 
 
@@ -35,6 +35,8 @@ class Frame{
 		// Constructor with paramteres
 		Frame(uint64_t st, uint64_t md) { starting_address = st; metadata = 0;}
 
+		Frame(uint64_t st, uint64_t md, int fn) { starting_address = st; metadata = 0; frame_number = fn;}
+
 		~Frame(){}
 
 		// The starting address of the frame
@@ -57,19 +59,7 @@ class Pool{
 		//Constructor for pool
 		Pool(Params parmas, SST::OpalComponent::MemType mem_type, int id);
 
-		~Pool() {
-/*			while(!freelist.empty()) {
-				Frame* frame = freelist.front();
-				freelist.erase(freelist.begin());
-				delete frame;
-			}
-*/
-			std::map<uint64_t, Frame*>::iterator it;
-			for(it=alloclist.begin();it!=alloclist.end();it++) {
-				Frame* frame = it->second;
-				delete frame;
-			}
-		}
+		~Pool() { }
 
 		void finish() {}
 
@@ -93,10 +83,19 @@ class Pool{
 		// Deallocate 'size' contigiuous memory starting from physical address 'starting_pAddress', returns a structure which indicates success or not
 		REQRESPONSE deallocate_frames(int size, uint64_t starting_pAddress);
 
+		// Allocate 'pages' frames that need not be contiguous, their physical addresses are appended to 'addresses'
+		REQRESPONSE allocate_frames(int pages, std::vector<uint64_t>& addresses);
+
 		bool isAllocated(uint64_t address);
 
+		// Does the physical address fall inside this pool
+		bool contains(uint64_t address) { return (start <= address) && (address < start + (uint64_t) num_frames*frbytes); }
+
+		// Allocated frame holding the physical address, nullptr if the frame is free or outside the pool
+		Frame* getFrame(uint64_t address);
+
 		// Current number of free frames
-		int freeframes() { return freelist.size(); }
+		int freeframes() { return available_frames; }
 
 		// Frame size in KBs
 		int frsize;
@@ -139,13 +138,41 @@ class Pool{
 		//Memory technology
 		SST::OpalComponent::MemTech memTech;
 
-		// The list of free frames
-		std::list<uint64_t> freelist;
+		// Frame size in bytes
+		uint64_t frbytes;
+
+		// Frame table indexed by frame number, frame_number = (address - start) / frbytes
+		std::vector<Frame> frames;
+
+		// One bit per frame, set when the frame is free
+		std::vector<uint64_t> freemap;
+
+		// No word of freemap below this index has a free frame
+		size_t freehint;
+
+		// Free frames in the order single frames are handed out: address order at first,
+		// freed frames go to the tail like the free list this replaced
+		std::deque<uint64_t> freequeue;
+
+		// Set while a frame has an entry in freequeue, the entry may be stale
+		std::vector<bool> queued;
+
+		uint64_t frameIndex(uint64_t address) { return (address - start) / frbytes; }
+
+		bool isFree(uint64_t index) { return (freemap[index >> 6] >> (index & 63)) & 1; }
+
+		// Returns the index of the next free frame in freequeue order, or num_frames if there is none
+		uint64_t findFree();
+
+		// Returns the index of the lowest free frame, or num_frames if there is none
+		uint64_t findLowestFree();
+
+		// Returns the index of the lowest run of N free frames, or num_frames if there is none
+		uint64_t findFreeRun(int N);
 
-		//std::map<uint64_t, int> freelist_index;
+		void markAllocated(uint64_t index);
 
-		// The list of allocated frames --- the key is the starting physical address
-		std::map<uint64_t, Frame*> alloclist;
+		void markFree(uint64_t index);
 
 };
 
@@ -32,6 +32,7 @@ Opal::Opal(SST::ComponentId_t id, SST::Params& params): Component(id) {
 	output = new SST::Output("OpalComponent[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
 
 	max_inst = (uint32_t) params.find<uint32_t>("max_inst", 1);
+	batch_faults = params.find<bool>("batch_faults", true);
 	num_nodes = (uint32_t) params.find<uint32_t>("num_nodes", 1);
 	nodeInfo = new NodePrivateInfo*[num_nodes];
 	num_cores = 0;
@@ -185,7 +186,7 @@ void Opal::setNextMemPool( int node, int fault_level )
 void Opal::processHint(int node, int fileId, uint64_t vAddress, int size)
 {
 
-	std::map<int, std::pair<std::vector<int>*, std::vector<uint64_t>* > >::iterator fileIdHint = opalBase->mmapFileIdHints.find(fileId);
+	std::unordered_map<int, std::pair<std::vector<int>*, std::vector<uint64_t>* > >::iterator fileIdHint = opalBase->mmapFileIdHints.find(fileId);
 
 	//fileId is already registered by another node
 	if( fileIdHint != opalBase->mmapFileIdHints.end() )
@@ -226,11 +227,14 @@ REQRESPONSE Opal::isAddressReserved(int node, uint64_t vAddress)
 	response.status = 0;
 
 
-	for (std::map<uint64_t, std::pair<int, std::pair<int, int> > >::iterator it= (nodeInfo[node]->reservedSpace).begin(); it!=(nodeInfo[node]->reservedSpace).end(); ++it)
+	// Reserved regions do not overlap, so only the closest region starting at or below vAddress can hold it
+	std::map<uint64_t, std::pair<int, std::pair<int, int> > >::iterator it = nodeInfo[node]->reservedSpace.upper_bound(vAddress);
+	if(it != nodeInfo[node]->reservedSpace.begin())
 	{
+		--it;
 		uint64_t reservedVAddress = it->first;
 		int pages_reserved = (it->second).second.first;
-		if(reservedVAddress <= vAddress && vAddress < reservedVAddress + pages_reserved*nodeInfo[node]->page_size) {
+		if(vAddress < reservedVAddress + pages_reserved*nodeInfo[node]->page_size) {
 			response.status = 1;
 			response.address = reservedVAddress;
 		}
@@ -365,9 +369,10 @@ REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddres
 	REQRESPONSE response;
 	response.status = 0;
 
-	int fileID = nodeInfo[node]->reservedSpace[reserved_vAddress].first;
-	int pages_reserved = nodeInfo[node]->reservedSpace[reserved_vAddress].second.first;
-	int pages_used = nodeInfo[node]->reservedSpace[reserved_vAddress].second.second;
+	std::pair<int, std::pair<int, int> >& reserved = nodeInfo[node]->reservedSpace[reserved_vAddress];
+	int fileID = reserved.first;
+	int pages_reserved = reserved.second.first;
+	int pages_used = reserved.second.second;
 
 	std::vector<uint64_t> *reserved_pAddress = opalBase->mmapFileIdHints[fileID].second;
 
@@ -406,7 +411,7 @@ REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddres
 		response.address = *it;
 		response.pages = pages;
 		response.status = 1;
-		nodeInfo[node]->reservedSpace[reserved_vAddress].second.second += pages;
+		reserved.second.second += pages;
 
 	}
 	else
@@ -466,6 +471,57 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 
 }
 
+/* Services the run of page faults at the head of the request queue that come from the same core
+ * with one pass over the local frame table. Only used when every fault in the run would have been
+ * served from local memory anyway (local-first policy, not reserved, enough free frames), so the
+ * frames handed out are the same as servicing the faults one at a time.
+ * Returns the number of faults serviced, 0 if the head of the queue has to go through processRequest.
+ */
+uint32_t Opal::processRequestBatch(uint32_t max_requests)
+{
+	OpalEvent *head = opalBase->requestQ.front();
+	int node = head->getNodeId();
+	int coreId = head->getCoreId();
+
+	if(nodeInfo[node]->memoryAllocationPolicy || nodeInfo[node]->allocatedmempool)
+		return 0;
+
+	uint32_t count = 0;
+	for(std::deque<OpalEvent*>::iterator it = opalBase->requestQ.begin(); it != opalBase->requestQ.end() && count < max_requests; it++) {
+		OpalEvent *ev = *it;
+		if(ev->getType() != SST::OpalComponent::EventType::REQUEST || ev->getNodeId() != node || ev->getCoreId() != coreId)
+			break;
+		if(ceil(ev->getSize()/(nodeInfo[node]->page_size)) != 1)
+			break;
+		if(4 != ev->getFaultLevel() && !nodeInfo[node]->reservedSpace.empty() && isAddressReserved(node, ev->getAddress()).status)
+			break;
+		count++;
+	}
+
+	if(count < 2)
+		return 0;
+
+	Pool *pool = nodeInfo[node]->pool;
+	batch_pAddress.clear();
+	if(!pool->allocate_frames(count, batch_pAddress).status)
+		return 0;
+
+	for(uint32_t i = 0; i < count; i++) {
+		OpalEvent *ev = opalBase->requestQ.front();
+		opalBase->requestQ.pop_front();
+
+		nodeInfo[node]->profileEvent(SST::OpalComponent::MemType::LOCAL);
+
+		OpalEvent *tse = new OpalEvent(EventType::RESPONSE);
+		tse->setResp(ev->getAddress(), batch_pAddress[i], nodeInfo[node]->page_size);
+		tse->setCoreId(coreId);
+		nodeInfo[node]->coreInfo[coreId].mmuLink->send(tse);
+		delete ev;
+	}
+
+	return count;
+}
+
 
 bool Opal::tick(SST::Cycle_t x)
 {
@@ -505,6 +561,13 @@ bool Opal::tick(SST::Cycle_t x)
 
 			case SST::OpalComponent::EventType::REQUEST:
 			{
+				if(batch_faults) {
+					uint32_t served = processRequestBatch(max_inst - inst_served);
+					if(served) {
+						inst_served += served;
+						continue;
+					}
+				}
 				removeEvent = processRequest(ev->getNodeId(), ev->getCoreId(), ev->getAddress(), ev->getFaultLevel(), ev->getSize());
 			}
 			break;
@@ -519,7 +582,7 @@ bool Opal::tick(SST::Cycle_t x)
 				break;
 			}
 
-			opalBase->requestQ.pop();
+			opalBase->requestQ.pop_front();
 			delete ev;
 			inst_served++;
 		}
@@ -15,11 +15,12 @@
 #include <fstream>
 #include <sstream>
 #include <map>
+#include <unordered_map>
 #include <algorithm>
 
 #include <stdint.h>
 #include <poll.h>
-#include <queue>
+#include <deque>
 
 #include <sst/core/sst_types.h>
 #include <sst/core/event.h>
@@ -47,19 +48,19 @@ public:
 
         while( !requestQ.empty() ) {
             delete requestQ.front();
-            requestQ.pop();
+            requestQ.pop_front();
         }
 
-        std::map<int, std::pair<std::vector<int>*, std::vector<uint64_t>* > >::iterator it;
+        std::unordered_map<int, std::pair<std::vector<int>*, std::vector<uint64_t>* > >::iterator it;
         for(it=mmapFileIdHints.begin(); it!=mmapFileIdHints.end(); it++){
             delete (it->second).second;
             delete (it->second).first;
         }
     }
 
-    std::queue<OpalEvent*> requestQ; // stores page fault requests, hints and shootdown acknowledgement events from all the cores
+    std::deque<OpalEvent*> requestQ; // stores page fault requests, hints and shootdown acknowledgement events from all the cores
 
-    std::map<int, std::pair<std::vector<int>*, std::vector<uint64_t>* > > mmapFileIdHints; // used to store reserved memory which is useful for inter-node communication
+    std::unordered_map<int, std::pair<std::vector<int>*, std::vector<uint64_t>* > > mmapFileIdHints; // used to store reserved memory which is useful for inter-node communication
 };
 
 class MemoryPrivateInfo
@@ -103,7 +104,7 @@ public:
 
     bool contains(uint64_t page)
     {
-        return ((pool->start <= page) && (page < pool->start + pool->num_frames*pool->frsize)) ? true : false;
+        return pool->contains(page);
     }
 
     void serialize_order(SST::Core::Serialization::serializer& ser)
@@ -145,7 +146,7 @@ public:
         OpalEvent *ev =  static_cast<OpalComponent::OpalEvent*> (e);
         ev->setNodeId(nodeId);
         ev->setCoreId(coreId);
-        opalBase->requestQ.push(ev);
+        opalBase->requestQ.push_back(ev);
     }
 
     void serialize_order(SST::Core::Serialization::serializer& ser)
@@ -278,6 +279,8 @@ public:
 
     bool processRequest(int node, int coreId, uint64_t vAddress, int fault_level, int size);
 
+    uint32_t processRequestBatch(uint32_t max_requests);
+
     void processHint(int node, int fileId, uint64_t vAddress, int size);
 
     void deallocateSharedMemory(uint64_t page, int N);
@@ -309,6 +312,7 @@ public:
         {"latency", "The time to be spent to service a memory request", "1000"},
         {"verbose", "debug level", "1"},
         {"max_inst", "maximum number of instructions per cycle", "1"},
+        {"batch_faults", "Service back-to-back page faults from the same core with a single local memory allocation", "1"},
         {"num_nodes", "number of disaggregated nodes in the system", "1"},
         {"cores_per_node", "total number of cores. this will be used to account for TLB shootdown latency", "1"},
         {"num_ports", "total number of request links", "2"},
@@ -365,6 +369,10 @@ public:
 
     long long int max_inst; //maximum instructions per cycle
 
+    bool batch_faults; // service back-to-back page faults from one core together
+
+    std::vector<uint64_t> batch_pAddress; // frames allocated for the current fault batch
+
     uint32_t num_nodes; // stores total number of nodes available in the system
 
     uint32_t num_cores; // stores total number of cores from all the nodes in the system
@@ -0,0 +1,85 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#include <sst_config.h>
+
+#include "opalPoolTest.h"
+
+#include <cinttypes>
+
+using namespace SST::OpalComponent;
+
+PoolTest::PoolTest(SST::ComponentId_t id, SST::Params& params) : Component(id)
+{
+	output.init("", 0, 0, Output::STDOUT);
+
+	int frames = params.find<int>("frames", 16);
+	int frame_size = params.find<int>("frame_size", 4);
+
+	if(frames < 16)
+		output.fatal(CALL_INFO, -1, "%s, Error - frames must be at least 16\n", getName().c_str());
+
+	Params poolParams;
+	poolParams.insert("size", std::to_string(frames * frame_size));
+	poolParams.insert("frame_size", std::to_string(frame_size));
+	poolParams.insert("start", "0");
+
+	pool = new Pool(poolParams, SST::OpalComponent::MemType::LOCAL, 0);
+	frbytes = (uint64_t) frame_size*1024;
+}
+
+void PoolTest::report(const char* op, REQRESPONSE response)
+{
+	if(!response.status) {
+		output.output("PoolTest: %s: failed, %d free\n", op, pool->freeframes());
+		return;
+	}
+
+	uint64_t first = response.address / frbytes;
+
+	// Every frame of the run has to be allocated for the allocation to be contiguous
+	bool contiguous = true;
+	for(int i=0; i<response.pages; i++)
+		contiguous = contiguous && pool->isAllocated(response.address + i*frbytes);
+
+	if(response.pages == 1)
+		output.output("PoolTest: %s: frame %" PRIu64 ", %d free\n", op, first, pool->freeframes());
+	else
+		output.output("PoolTest: %s: frames %" PRIu64 "-%" PRIu64 "%s, %d free\n", op, first, first + response.pages - 1,
+			contiguous ? "" : " not allocated", pool->freeframes());
+}
+
+void PoolTest::reportFree(const char* op, REQRESPONSE response)
+{
+	output.output("PoolTest: %s: %s, %d free\n", op, response.status ? "ok" : "failed", pool->freeframes());
+}
+
+void PoolTest::setup()
+{
+	for(int i=0; i<4; i++)
+		report("allocate 1", pool->allocate_frame(1));
+
+	// Freed frames are reused after the frames that were never allocated
+	reportFree("free frame 1", pool->deallocate_frame(1*frbytes, 1));
+	reportFree("free frame 0", pool->deallocate_frame(0, 1));
+	report("allocate 1", pool->allocate_frame(1));
+
+	// Contiguous runs come from the lowest free frames that fit
+	report("allocate 3", pool->allocate_frame(3));
+	report("allocate 9", pool->allocate_frame(9));
+	reportFree("free frames 5-7", pool->deallocate_frame(5*frbytes, 3));
+	reportFree("free frames 5-7", pool->deallocate_frame(5*frbytes, 3));
+
+	int remaining = pool->freeframes();
+	for(int i=0; i<=remaining; i++)
+		report("allocate 1", pool->allocate_frame(1));
+}
@@ -0,0 +1,69 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+//
+
+#ifndef _OPAL_POOL_TEST_H
+#define _OPAL_POOL_TEST_H
+
+#include <sst/core/component.h>
+#include <sst/core/output.h>
+
+#include "mempool.h"
+
+namespace SST::OpalComponent
+{
+
+/*
+ * Exercises a memory pool during setup and prints the frames it hands out,
+ * used by the testsuite to check the allocation order and contiguous allocations
+ */
+class PoolTest : public SST::Component
+{
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        PoolTest,
+        "Opal",
+        "PoolTest",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Memory pool allocation test",
+        COMPONENT_CATEGORY_UNCATEGORIZED
+        )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"frames", "Number of frames in the pool, at least 16", "16"},
+        {"frame_size", "Frame size in KB", "4"},
+    )
+
+    PoolTest(SST::ComponentId_t id, SST::Params& params);
+    ~PoolTest() { delete pool; }
+
+    void setup() override;
+
+private:
+    PoolTest();  // for serialization only
+    PoolTest(const PoolTest&); // do not implement
+    void operator=(const PoolTest&); // do not implement
+
+    // Prints the result of an allocation as frame numbers
+    void report(const char* op, REQRESPONSE response);
+
+    // Prints whether a free succeeded
+    void reportFree(const char* op, REQRESPONSE response);
+
+    Output output;
+    Pool* pool;
+    uint64_t frbytes;
+};
+
+} // end namespace
+
+#endif
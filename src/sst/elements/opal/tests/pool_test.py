@@ -0,0 +1,8 @@
+import sst
+
+# Allocates and frees frames in a 16 frame Opal memory pool and prints the frames handed out
+pool = sst.Component("pool", "Opal.PoolTest")
+pool.addParams({
+    "frames" : 16,
+    "frame_size" : 4,
+})
@@ -0,0 +1,48 @@
+# -*- coding: utf-8 -*-
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+
+class testcase_Opal_Component(SSTTestCase):
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+#####
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Opal: test_Opal_pool_test skipped if ranks > 1")
+    def test_Opal_pool_test(self):
+        self.Opal_test_template("pool_test")
+
+#####
+
+    def Opal_test_template(self, testcase):
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_Opal_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile)
+
+        # Only the lines printed by the test component are compared, in order
+        with open(outfile) as fp:
+            out_lines = [line.rstrip() for line in fp if line.startswith("PoolTest:")]
+        with open(reffile) as fp:
+            ref_lines = [line.rstrip() for line in fp]
+
+        if out_lines != ref_lines:
+            log_failure("\n".join(out_lines))
+        self.assertEqual(out_lines, ref_lines, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
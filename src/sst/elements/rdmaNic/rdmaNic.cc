@@ -27,7 +27,13 @@ RdmaNic::RdmaNic(ComponentId_t id, Params &params) : Component(id),
 	m_nextCqId(0),
 	m_streamId(1),
 	m_netPktMtuLen( 1024 ),
-    m_dmaLink( nullptr )
+    m_dmaLink( nullptr ),
+    m_numMmioWrites(0),
+    m_numMemResps(0),
+    m_numHostCmds(0),
+    m_numDoorbells(0),
+    m_numDescReads(0),
+    m_numTailWrites(0)
 {
     m_nicId = params.find<int>("nicId", -1);
     assert( m_nicId != -1 );
@@ -77,6 +83,13 @@ RdmaNic::RdmaNic(ComponentId_t id, Params &params) : Component(id),
 
     m_hostInfo.resize( pesPerNode );
     m_nicCmdQueueV.resize( pesPerNode );
+    m_cmdRingV.resize( pesPerNode );
+    m_compQueues.reserve( NUM_COMP_Q );
+
+    m_cmdRingPrefetch = params.find<uint32_t>("cmdRingPrefetch", 8);
+    if ( 0 == m_cmdRingPrefetch ) {
+        out.fatal(CALL_INFO_LONG, -1, "cmdRingPrefetch must be at least 1\n");
+    }
 
     // Clock handler
     std::string clockFreq = params.find<std::string>("clock", "1GHz");
@@ -131,11 +144,13 @@ void RdmaNic::writeResp(StandardMem::WriteResp* req) {
 	if ( ! req->getSuccess() ) {
         out.fatal(CALL_INFO_LONG, -1, " Error: write to address %#" PRIx64 " failed\n",req->pAddr );
 	}
+	++m_numMemResps;
 	m_memReqQ->handleResponse( req );
 }
 
 void RdmaNic::readResp(StandardMem::ReadResp* req) {
     dbg.debug(CALL_INFO_LONG,1,DBG_X_FLAG,"Read addr=%#" PRIx64 "\n",req->pAddr);
+	++m_numMemResps;
 	m_memReqQ->handleResponse( req );
 	if ( ! req->getSuccess() ) {
         out.fatal(CALL_INFO_LONG, -1, " Error: read of address %#" PRIx64 " failed\n",req->pAddr );
@@ -206,6 +221,7 @@ void RdmaNic::mmioWrite(StandardMem::Write* req) {
 
 	int thread = calcThread( req->pAddr );
 	uint64_t offset = calcOffset( req->pAddr );
+	++m_numMmioWrites;
 
     dbg.debug( CALL_INFO_LONG,2,DBG_X_FLAG,"thread=%d Write size=%zu addr=%" PRI_ADDR " offset=%" PRIu64 " data %s\n",
                     thread,req->data.size(), req->pAddr, offset, getDataStr(req->data).c_str() );
@@ -219,6 +235,12 @@ void RdmaNic::mmioWrite(StandardMem::Write* req) {
 		NicCmdEntry* entry = createNewCmd( *this, thread, m_backing->readCmd(thread) );
 		dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"new command from thread %d op=%s\n", thread, entry->name().c_str() );
         m_nicCmdQ.push( entry );
+        ++m_numHostCmds;
+    }
+
+    uint32_t producerIndex;
+    if ( m_backing->takeDoorbell( thread, producerIndex ) ) {
+        ringDoorbell( thread, producerIndex );
     }
 
 	if ( ! req->posted ) {
@@ -232,6 +254,7 @@ bool RdmaNic::clock(Cycle_t cycle) {
     bool unclock = m_link->clock();
 #endif
 
+    processCmdRings();
     processThreadCmdQs();
 
     m_memReqQ->process();
@@ -253,14 +276,17 @@ void RdmaNic::processThreadCmdQs( ) {
 		m_activeNicCmd = m_nicCmdQ.front();
 		m_nicCmdQ.pop();
 
-		NicCmdQueueInfo& info = m_nicCmdQueueV[m_activeNicCmd->getThread()];
+		// the command ring returns its slots in batches, see processCmdRings()
+		if ( ! m_activeNicCmd->fromRing() ) {
+			NicCmdQueueInfo& info = m_nicCmdQueueV[m_activeNicCmd->getThread()];
 
-		dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"thread %d cmd available tail=%d %s\n",m_activeNicCmd->getThread(),info.localTailIndex, m_activeNicCmd->name().c_str() );
+			dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"thread %d cmd available tail=%d %s\n",m_activeNicCmd->getThread(),info.localTailIndex, m_activeNicCmd->name().c_str() );
 
-        ++info.localTailIndex;
-        info.localTailIndex %= m_backing->getCmdQSize();
-        dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"write tail=%d at %#" PRIx64 "\n",info.localTailIndex, info.tailAddr );
-        m_memReqQ->write( m_tailWriteQnum, info.tailAddr, 4, info.localTailIndex );
+        	++info.localTailIndex;
+        	info.localTailIndex %= m_backing->getCmdQSize();
+        	dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"write tail=%d at %#" PRIx64 "\n",info.localTailIndex, info.tailAddr );
+        	m_memReqQ->write( m_tailWriteQnum, info.tailAddr, 4, info.localTailIndex );
+		}
     }
 	if ( m_activeNicCmd ) {
 		if ( m_activeNicCmd->process() ) {
@@ -283,7 +309,11 @@ void RdmaNic::sendRespToHost( Addr_t addr, NicResp& resp, int thread )
 
 void RdmaNic::writeCompletionToHost(int thread, int cqId, RdmaCompletion& comp )
 {
-    CompletionQueue& q = *m_compQueueMap[cqId];
+    CompletionQueue* cq = findCompQueue( cqId );
+    if ( nullptr == cq ) {
+        out.fatal(CALL_INFO_LONG, -1, "Error: completion for unknown cqId=%d\n", cqId );
+    }
+    CompletionQueue& q = *cq;
 
     int tailIndex = readCompQueueTailIndex(thread,cqId);
     dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"cqId=%d headIndex=%d tailIndex=%d queueSize=%d headPtr=%#" PRIx64 " dataPtr=%#" PRIx64 "\n",
@@ -305,6 +335,93 @@ void RdmaNic::writeCompletionToHost(int thread, int cqId, RdmaCompletion& comp )
 	m_memReqQ->write( m_respQueueMemChannel, q.cmd().data.createCQ.headPtr, sizeof(q.headIndex()), q.headIndex() );
 }
 
+int RdmaNic::createCmdRing( int thread, Addr_t ringAddr, Addr_t tailPtr, uint32_t num )
+{
+    CmdRing& ring = m_cmdRingV[thread];
+    if ( ring.num || num < 2 ) {
+        dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"thread %d can't create command ring, num=%d existing=%d\n", thread, num, ring.num );
+        return -1;
+    }
+
+    ring.ringAddr = ringAddr;
+    ring.tailPtr = tailPtr;
+    ring.num = num;
+    ring.staged.resize( num );
+    ring.ready.assign( num, 0 );
+    ring.callback = new MemRequest::Callback(
+        std::bind( &RdmaNic::cmdRingReadResp, this, thread, std::placeholders::_1, std::placeholders::_2 ) );
+    return 0;
+}
+
+void RdmaNic::ringDoorbell( int thread, uint32_t producerIndex )
+{
+    CmdRing& ring = m_cmdRingV[thread];
+    dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"thread %d doorbell producer=%d fetch=%d\n", thread, producerIndex, ring.fetchIndex );
+
+    if ( 0 == ring.num ) {
+        out.fatal(CALL_INFO_LONG, -1, "Error: thread %d rang the doorbell before creating a command ring\n", thread );
+    }
+    if ( producerIndex >= ring.num ) {
+        out.fatal(CALL_INFO_LONG, -1, "Error: thread %d doorbell index %d is outside of its command ring (%d)\n", thread, producerIndex, ring.num );
+    }
+    ring.producerIndex = producerIndex;
+    ++m_numDoorbells;
+}
+
+void RdmaNic::processCmdRings()
+{
+    for ( int thread = 0; thread < m_cmdRingV.size(); thread++ ) {
+        CmdRing& ring = m_cmdRingV[thread];
+        if ( 0 == ring.num ) {
+            continue;
+        }
+
+        // Each descriptor is one cache line, so each gets its own read; keeping several
+        // in flight hides the memory latency of a batch behind a single doorbell
+        while ( ring.fetchIndex != ring.producerIndex && ring.readsPending < m_cmdRingPrefetch
+                    && ! m_memReqQ->full( m_dmaMemChannel ) ) {
+            Addr_t addr = ring.ringAddr + ring.fetchIndex * sizeof(NicCmd);
+            dbg.debug( CALL_INFO_LONG,2,DBG_X_FLAG,"thread %d fetch descriptor %d addr=%#" PRIx64 "\n", thread, ring.fetchIndex, addr );
+            m_memReqQ->read( m_dmaMemChannel, addr, sizeof(NicCmd), ring.fetchIndex, ring.callback );
+            ++ring.readsPending;
+            ++m_numDescReads;
+            ring.fetchIndex = ( ring.fetchIndex + 1 ) % ring.num;
+        }
+
+        if ( ring.tailDirty && ! m_memReqQ->full( m_tailWriteQnum ) ) {
+            dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"thread %d write ring tail=%d at %#" PRIx64 "\n", thread, ring.consumeIndex, ring.tailPtr );
+            m_memReqQ->write( m_tailWriteQnum, ring.tailPtr, 4, ring.consumeIndex );
+            ring.tailDirty = false;
+            ++m_numTailWrites;
+        }
+    }
+}
+
+void RdmaNic::cmdRingReadResp( int thread, StandardMem::Request* resp, int index )
+{
+    CmdRing& ring = m_cmdRingV[thread];
+    StandardMem::ReadResp* readResp = static_cast<StandardMem::ReadResp*>(resp);
+    assert( readResp->data.size() == sizeof(NicCmd) );
+
+    memcpy( &ring.staged[index], readResp->data.data(), sizeof(NicCmd) );
+    ring.ready[index] = 1;
+    --ring.readsPending;
+    delete resp;
+
+    // reads can complete out of order, commands enter the queue in ring order
+    while ( ring.ready[ring.consumeIndex] ) {
+        ring.ready[ring.consumeIndex] = 0;
+        NicCmdEntry* entry = createNewCmd( *this, thread, &ring.staged[ring.consumeIndex] );
+        dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"new command from thread %d ring index %d op=%s\n", thread, ring.consumeIndex, entry->name().c_str() );
+        entry->setFromRing();
+        m_nicCmdQ.push( entry );
+        ++m_numHostCmds;
+
+        ring.consumeIndex = ( ring.consumeIndex + 1 ) % ring.num;
+        ring.tailDirty = true;
+    }
+}
+
 void RdmaNic::init(unsigned int phase) {
 	dbg.debug( CALL_INFO_LONG,2,DBG_X_FLAG,"phase=%d\n",phase);
 
@@ -326,6 +443,10 @@ void RdmaNic::setup(void) {
 
 void RdmaNic::finish(void) {
 
+    out.verbose(CALL_INFO, 2, 0, "node%d: host commands %" PRIu64 ", MMIO writes %" PRIu64 ", memory responses %" PRIu64
+        ", doorbells %" PRIu64 ", descriptor reads %" PRIu64 ", ring tail writes %" PRIu64 "\n",
+        m_nicId, m_numHostCmds, m_numMmioWrites, m_numMemResps, m_numDoorbells, m_numDescReads, m_numTailWrites );
+
 	if ( m_dmaLink ) {
     	m_dmaLink->finish();
 	}
@@ -64,6 +64,23 @@ class RdmaNic : public SST::Component {
         { "hostToNicLatency",  "",   "request", 1 }
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        { "nicId",           "Node id of this NIC", "-1" },
+        { "numNodes",        "Number of nodes in the system", "0" },
+        { "pesPerNode",      "Number of host threads using this NIC", "0" },
+        { "baseAddr",        "Base address of the NIC MMIO region", "0x100000000" },
+        { "cmdQSize",        "Number of entries in the MMIO command queue of each thread", "64" },
+        { "clock",           "NIC clock frequency", "1GHz" },
+        { "useDmaCache",     "Use the 'dma' port for DMA instead of the 'mmio' port", "false" },
+        { "maxMemReqs",      "Maximum number of outstanding memory requests", "128" },
+        { "cmdRingPrefetch", "Number of command ring descriptors the NIC reads ahead after a doorbell", "8" },
+        { "barrierDegree",   "Fan out of the barrier tree", "4" },
+        { "barrierVC",       "Virtual channel used for barrier messages", "0" },
+        { "verbose",         "Output verbosity, 2 prints a per NIC message rate summary at the end", "1" },
+        { "debug_level",     "Debug verbosity", "0" },
+        { "debug_mask",      "Debug mask", "0" }
+    )
+
     SST_ELI_DOCUMENT_PORTS({ "dma", "Connects the NIC to a cache for DMA", {} },
                            { "mmio", "Connects the NIC to MH", {} },
                            { "rtrLink", "Connects the NIC to the network", {} })
@@ -163,10 +180,11 @@ class RdmaNic : public SST::Component {
         size_t getCompInfoOffset()  { return round_up( getCmdQueueMemSize(), 4096 ); }
         size_t getCompInfoMemSize() { return sizeof(COMP_INDEX) * compQSize; }
 
+        // command ring doorbell, on its own page after the completion queue info
+        size_t getDoorbellOffset()  { return getCompInfoOffset() + round_up( getCompInfoMemSize(), 4096 ); }
+
         size_t getPeMemorySize() {
-            size_t tmp = getCompInfoOffset();
-            tmp += round_up( getCompInfoMemSize(), 4096);
-            return tmp;
+            return getDoorbellOffset() + 4096;
         }
 
         bool write( uint64_t offset, unsigned char* data, size_t length ) {
@@ -202,9 +220,26 @@ class RdmaNic : public SST::Component {
                 retval = true;
             }
 
+            if ( offset >= getDoorbellOffset() && offset + length <= getDoorbellOffset() + sizeof( pe.doorbell ) ) {
+                memcpy( (unsigned char*) &pe.doorbell + ( offset - getDoorbellOffset() ), data, length );
+                pe.doorbellRung = true;
+                retval = true;
+            }
+
             return retval;
         }
 
+        // returns true, and the ring producer index, if the thread wrote its doorbell since the last call
+        bool takeDoorbell( int thread, uint32_t& index ) {
+            auto& pe = peBacking[thread];
+            if ( ! pe.doorbellRung ) {
+                return false;
+            }
+            pe.doorbellRung = false;
+            index = pe.doorbell;
+            return true;
+        }
+
         bool isCmdReady( int thread ) {
             return peBacking[thread].bytesWritten == sizeof(CMD);
         }
@@ -237,7 +272,7 @@ class RdmaNic : public SST::Component {
         }
 
         struct PE_backing {
-            PE_backing( int compQSize) : compQueuesTailIndex( compQSize, 0), bytesWritten(0), cmdIndex(0) {}
+            PE_backing( int compQSize) : compQueuesTailIndex( compQSize, 0), bytesWritten(0), cmdIndex(0), doorbell(0), doorbellRung(false) {}
 
             CMD  cmd;
             int  bytesWritten;
@@ -246,6 +281,9 @@ class RdmaNic : public SST::Component {
 	        std::vector< COMP_INDEX > compQueuesTailIndex;
 
             int cmdIndex;
+
+            uint32_t doorbell;
+            bool     doorbellRung;
         };
 
         std::vector< PE_backing > peBacking;
@@ -263,6 +301,45 @@ class RdmaNic : public SST::Component {
 
     Backing< NicCmd, QueueIndex >* m_backing;
 
+    // A thread's command ring in host memory. Descriptors between fetchIndex and the last
+    // doorbell are read with DMA, up to m_cmdRingPrefetch at a time, and handed to m_nicCmdQ
+    // in ring order. The consumer index is written back to the host once per batch.
+    struct CmdRing {
+        CmdRing() : ringAddr(0), tailPtr(0), num(0), producerIndex(0), fetchIndex(0), consumeIndex(0),
+            readsPending(0), tailDirty(false), callback(nullptr) {}
+
+        Addr_t   ringAddr;
+        Addr_t   tailPtr;
+        uint32_t num;
+        uint32_t producerIndex;
+        uint32_t fetchIndex;
+        uint32_t consumeIndex;
+        uint32_t readsPending;
+        bool     tailDirty;
+        std::vector<NicCmd>  staged;  // descriptors read back, by ring index
+        std::vector<uint8_t> ready;
+        MemRequest::Callback* callback;
+    };
+    std::vector<CmdRing> m_cmdRingV;
+    uint32_t m_cmdRingPrefetch;
+
+    int createCmdRing( int thread, Addr_t ringAddr, Addr_t tailPtr, uint32_t num );
+    void ringDoorbell( int thread, uint32_t producerIndex );
+    void processCmdRings();
+    void cmdRingReadResp( int thread, StandardMem::Request* resp, int index );
+
+    Addr_t calcDoorbellAddress( int thread ) {
+        return m_backing->getPeMemorySize() * thread + m_backing->getDoorbellOffset();
+    }
+
+    // counts reported at the end of simulation with verbose >= 2
+    uint64_t m_numMmioWrites;
+    uint64_t m_numMemResps;
+    uint64_t m_numHostCmds;
+    uint64_t m_numDoorbells;
+    uint64_t m_numDescReads;
+    uint64_t m_numTailWrites;
+
     struct HostInfo {
 		HostInfo() : offset(0) {}
 		HostQueueInfo   hostInfo;
@@ -349,7 +426,15 @@ class RdmaNic : public SST::Component {
 	// this is used to preserve order
 	std::queue< NicCmdEntry* > m_nicCmdQ;
 
-	std::map< int,CompletionQueue*> m_compQueueMap;
+	// indexed by cqId, nullptr if the queue does not exist
+	std::vector<CompletionQueue*> m_compQueues;
+
+	CompletionQueue* findCompQueue( int cqId ) {
+		if ( cqId < 0 || cqId >= (int) m_compQueues.size() ) {
+			return nullptr;
+		}
+		return m_compQueues[cqId];
+	}
 
 	int m_nextCqId;
 
@@ -381,6 +466,7 @@ class RdmaNic : public SST::Component {
 		case RdmaMemWrite: return "RdmaMemWrite";
 		case RdmaMemRead: return "RdmaMemRead";
 		case RdmaBarrier: return "RdmaBarrier";
+		case RdmaCreateCmdRing: return "RdmaCreateCmdRing";
 		default: return "Unknown RDMA command";
 		}
 	}
@@ -411,6 +497,8 @@ class RdmaNic : public SST::Component {
 			return new RdmaMemReadCmd( nic, thread, cmd );
 	  	case RdmaBarrier:
 			return new RdmaBarrierCmd( nic, thread, cmd );
+	  	case RdmaCreateCmdRing:
+			return new RdmaCreateCmdRingCmd( nic, thread, cmd );
         default:
 		    dbg.output(CALL_INFO_LONG,"Error: thread=%d %d\n",thread,cmd->type);
 		    assert(0);
@@ -16,7 +16,7 @@
 class NicCmdEntry {
   public:
     NicCmdEntry( RdmaNic& nic, int thread, NicCmd* tmp ) :
-        m_nic(nic), m_thread(thread), m_cmd( new NicCmd ), m_respAddr(tmp->respAddr)
+        m_nic(nic), m_thread(thread), m_cmd( new NicCmd ), m_respAddr(tmp->respAddr), m_fromRing(false)
     {
         bzero( &m_resp, sizeof( m_resp ) );
         m_resp.retval = 0;
@@ -35,6 +35,10 @@ class NicCmdEntry {
     virtual bool isRecv() { return false; }
     virtual std::string name() = 0;
     int getThread() { return m_thread; }
+
+    // commands fetched from a command ring do not occupy a slot in the MMIO command queue
+    void setFromRing() { m_fromRing = true; }
+    bool fromRing() { return m_fromRing; }
   protected:
 
     Addr_t m_respAddr;
@@ -42,6 +46,7 @@ class NicCmdEntry {
     NicCmd* m_cmd;
     int m_thread;
     RdmaNic& m_nic;
+    bool m_fromRing;
  };
 
 class RdmaCreateCQ_Cmd : public NicCmdEntry {
@@ -49,7 +54,10 @@ class RdmaCreateCQ_Cmd : public NicCmdEntry {
     RdmaCreateCQ_Cmd( RdmaNic& nic, int thread, NicCmd* cmd ) : NicCmdEntry(nic,thread,cmd)
 	{
     	int cqId = m_nic.m_nextCqId++;
-    	m_nic.m_compQueueMap[ cqId ] = new CompletionQueue( m_cmd );
+    	if ( cqId >= (int) m_nic.m_compQueues.size() ) {
+    	    m_nic.m_compQueues.resize( cqId + 1, nullptr );
+    	}
+    	m_nic.m_compQueues[ cqId ] = new CompletionQueue( m_cmd );
     	m_resp.retval = cqId;
     	m_resp.data.createCQ.tailIndexAddr = m_nic.calcCompQueueTailAddress( m_thread, cqId );
     	m_nic.dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"cqId=%d headPtr=%" PRIx64 " datPtr=%" PRIx64 " num=%d\n",
@@ -71,9 +79,10 @@ class RdmaDestroyCQ_Cmd : public NicCmdEntry {
 
         m_resp.retval = -1;
 
-        auto iter = m_nic.m_compQueueMap.find( m_cmd->data.destroyCQ.cqId );
-        if ( iter != m_nic.m_compQueueMap.end() ) {
-    	    delete m_nic.m_compQueueMap[ m_cmd->data.destroyCQ.cqId ];
+        CompletionQueue* cq = m_nic.findCompQueue( m_cmd->data.destroyCQ.cqId );
+        if ( cq ) {
+    	    delete cq;
+    	    m_nic.m_compQueues[ m_cmd->data.destroyCQ.cqId ] = nullptr;
             m_resp.retval = 0;
         }
 	}
@@ -91,8 +100,7 @@ class RdmaCreateRQ_Cmd : public NicCmdEntry {
 
         m_resp.retval = -1;
 
-        auto iter = m_nic.m_compQueueMap.find( m_cmd->data.createRQ.cqId );
-        if ( iter != m_nic.m_compQueueMap.end() ) {
+        if ( m_nic.findCompQueue( m_cmd->data.createRQ.cqId ) ) {
     	    m_resp.retval = m_nic.m_recvEngine->createRQ(m_cmd->data.createRQ.cqId, m_cmd->data.createRQ.rqKey );
         }
 	}
@@ -120,6 +128,20 @@ class RdmaFiniCmd : public NicCmdEntry {
     virtual std::string name() { return "Fini"; }
 };
 
+class RdmaCreateCmdRingCmd : public NicCmdEntry {
+  public:
+    RdmaCreateCmdRingCmd( RdmaNic& nic, int thread, NicCmd* cmd ): NicCmdEntry(nic,thread,cmd)
+	{
+    	m_nic.dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"ringAddr=%#" PRIx64 " tailPtr=%#" PRIx64 " num=%d\n",
+            m_cmd->data.createCmdRing.ringAddr, m_cmd->data.createCmdRing.tailPtr, m_cmd->data.createCmdRing.num );
+
+    	m_resp.retval = m_nic.createCmdRing( m_thread, m_cmd->data.createCmdRing.ringAddr,
+            m_cmd->data.createCmdRing.tailPtr, m_cmd->data.createCmdRing.num );
+    	m_resp.data.createCmdRing.doorbellAddr = m_nic.calcDoorbellAddress( m_thread );
+	}
+    virtual std::string name() { return "CreateCmdRing"; }
+};
+
 class RdmaBarrierCmd : public NicCmdEntry {
   public:
     RdmaBarrierCmd( RdmaNic& nic, int thread, NicCmd* cmd ): NicCmdEntry(nic,thread,cmd)
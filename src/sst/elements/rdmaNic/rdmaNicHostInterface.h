@@ -16,7 +16,8 @@
 typedef Addr_t Context;
 typedef int QueueIndex;
 typedef enum { RdmaDone=0, RdmaSend=1, RdmaRecv, RdmaFini, RdmaCreateCQ, RdmaDestroyCQ, RdmaCreateRQ,
-                    RdmaDestroyRQ, RdmaMemRgnReg, RdmaMemRgnUnreg, RdmaMemWrite, RdmaMemRead, RdmaBarrier } RdmaCmd;
+                    RdmaDestroyRQ, RdmaMemRgnReg, RdmaMemRgnUnreg, RdmaMemWrite, RdmaMemRead, RdmaBarrier,
+                    RdmaCreateCmdRing } RdmaCmd;
 
 typedef int MemRgnKey;
 typedef int RecvQueueKey;
@@ -86,6 +87,13 @@ typedef struct __attribute__((aligned(64))) {
         struct {
 			CompQueueId cqId;
 		} destroyCQ;
+        // commands placed in a ring in host memory and announced with a doorbell write,
+        // the NIC fetches them with DMA and writes its consumer index to tailPtr
+        struct {
+			Addr_t ringAddr;
+			Addr_t tailPtr;
+			uint32_t num;
+		} createCmdRing;
     } data;
 } NicCmd;
 
@@ -118,6 +126,10 @@ typedef struct __attribute__((aligned(64))) {
 		struct {
 			Addr_t tailIndexAddr;
 		} createCQ;
+		struct {
+			// relative to the start of the NIC address space, the host writes the ring producer index here
+			Addr_t doorbellAddr;
+		} createCmdRing;
 	} data;
 	// this has to be last as it is the flag to indicate the
 	// NIC has completed the write, the NIC calculates  the offset
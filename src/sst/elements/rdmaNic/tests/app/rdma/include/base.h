@@ -27,5 +27,7 @@ int base_n_pes();
 int base_my_pe();
 void base_make_progress();
 Addr_t getCompQueueInfoAddress();
+Addr_t getNicAddress( Addr_t offset );
+void writeDoorbell( Addr_t doorbell, uint32_t index );
 
 #endif
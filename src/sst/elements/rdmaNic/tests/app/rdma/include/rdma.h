@@ -68,6 +68,17 @@ int rdma_memory_read( MemRgnKey key, Node, Pid, size_t offset, void* data, size_
 // barrier for all nodes
 int rdma_barrier();
 
+// switch to a command ring with num entries, commands are written to host memory and the NIC is
+// told about a batch of them with one doorbell write instead of an MMIO write per command
+int rdma_cmd_ring_init( int num );
+
+// same as rdma_memory_write() but the command is placed in the command ring and not waited on,
+// it is handed to the NIC by rdma_cmd_ring_flush() or when the ring fills
+int rdma_memory_write_enqueue( MemRgnKey key, Node, Pid, size_t offset, void* data, size_t length, CompQueueId id, Context context );
+
+// ring the doorbell for all commands enqueued since the last flush
+void rdma_cmd_ring_flush();
+
 #ifdef __cplusplus
 }
 #endif
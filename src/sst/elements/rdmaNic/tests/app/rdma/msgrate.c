@@ -0,0 +1,89 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Message rate: node 0 issues small RDMA writes to node 1 through the command ring,
+// WINDOW at a time with a single doorbell per window
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <rdma.h>
+#include <time.h>
+
+#define NUM_MSGS 256
+#define WINDOW 16
+#define MSG_SIZE 8
+#define RING_SIZE 64
+
+int main( int argc, char* argv[] ) {
+
+	rdma_init();
+
+	int myNode = rdma_getMyNode();
+	int numNodes = rdma_getNumNodes();
+
+	printf("myNode=%d numNodes=%d\n",myNode,numNodes);
+
+	size_t length = NUM_MSGS * MSG_SIZE;
+	uint8_t* buf = malloc( length );
+	for ( int i = 0; i < length; i++ ) {
+		buf[i] = i;
+	}
+
+	int cq = rdma_create_cq( );
+
+	MemRgnKey key = 0xf00d;
+	if ( myNode == 1 ) {
+		rdma_memory_reg( key, buf, length );
+	}
+
+	rdma_barrier();
+
+	if ( myNode == 0 ) {
+		if ( rdma_cmd_ring_init( RING_SIZE ) ) {
+			printf("rdma_cmd_ring_init() failed\n");
+			exit(-1);
+		}
+
+		struct timespec start, end;
+		clock_gettime( CLOCK_MONOTONIC, &start );
+
+		for ( int i = 0; i < NUM_MSGS; i += WINDOW ) {
+			for ( int j = i; j < i + WINDOW; j++ ) {
+				rdma_memory_write_enqueue( key, 1, 0, j * MSG_SIZE, buf + j * MSG_SIZE, MSG_SIZE, cq, j );
+			}
+			rdma_cmd_ring_flush();
+
+			for ( int j = 0; j < WINDOW; j++ ) {
+				RdmaCompletion comp;
+				rdma_read_comp( cq, &comp, 1 );
+			}
+		}
+
+		clock_gettime( CLOCK_MONOTONIC, &end );
+
+		double secs = ( end.tv_sec - start.tv_sec ) + ( end.tv_nsec - start.tv_nsec ) / 1.0e9;
+		printf("msgrate: %d msgs of %d bytes in %.9f sec, %.0f msgs/sec\n", NUM_MSGS, MSG_SIZE, secs, NUM_MSGS / secs );
+	}
+
+	rdma_barrier();
+
+	if ( myNode == 1 ) {
+		rdma_memory_unreg( key );
+	}
+
+	free( buf );
+	rdma_fini();
+	printf("returning\n");
+}
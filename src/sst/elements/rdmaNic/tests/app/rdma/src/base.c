@@ -54,6 +54,19 @@ Addr_t getCompQueueInfoAddress() {
     return (Addr_t) s_nicQueueInfo.compQueuesAddress;
 }
 
+// the NIC returns addresses relative to the start of its address space
+Addr_t getNicAddress( Addr_t offset ) {
+    return offset + (Addr_t) s_nicBaseAddr;
+}
+
+void writeDoorbell( Addr_t doorbell, uint32_t index ) {
+
+	dbgPrint("doorbell=%#" PRIxBITS " index=%d\n",doorbell,index);
+	// the ring entries must be visible before the NIC starts reading them
+	__sync_synchronize();
+	*(volatile uint32_t*) doorbell = index;
+}
+
 void base_init( ) {
 
 	dbgPrint("\n");
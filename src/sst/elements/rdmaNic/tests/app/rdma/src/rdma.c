@@ -43,6 +43,18 @@ static int s_curCompIndex = 0;
 static int waitResp( NicResp* );
 static NicResp* getResp(NicCmd* cmd );
 
+typedef struct {
+	NicCmd* cmds;
+	NicResp* resps;
+	volatile uint32_t tailIndex;
+	uint32_t headIndex;
+	uint32_t flushedIndex;
+	Addr_t doorbell;
+	int num;
+} CmdRing;
+
+static CmdRing s_cmdRing;
+
 #define USE_STATIC_CMDS 16
 #if USE_STATIC_CMDS
 
@@ -413,6 +425,97 @@ int rdma_memory_read( MemRgnKey key, Node node, Pid pid, size_t offset, void* de
 	return 0;
 }
 
+int rdma_cmd_ring_init( int num ) {
+
+	assert( NULL == s_cmdRing.cmds );
+	assert( num > 1 );
+
+	// each command must sit in its own cache line, the NIC reads them one line at a time
+	s_cmdRing.cmds = aligned_alloc( 64, num * sizeof(NicCmd) );
+	s_cmdRing.resps = aligned_alloc( 64, num * sizeof(NicResp) );
+	assert( s_cmdRing.cmds && s_cmdRing.resps );
+
+	for ( int i = 0; i < num; i++ ) {
+		s_cmdRing.cmds[i].respAddr = (Addr_t) &s_cmdRing.resps[i];
+		// no command outstanding
+		s_cmdRing.resps[i].retval = 0;
+	}
+	s_cmdRing.tailIndex = 0;
+	s_cmdRing.headIndex = 0;
+	s_cmdRing.flushedIndex = 0;
+	s_cmdRing.num = num;
+
+	NicCmd* cmd = allocCmd();
+
+	cmd->type = RdmaCreateCmdRing;
+	cmd->data.createCmdRing.ringAddr = (Addr_t) s_cmdRing.cmds;
+	cmd->data.createCmdRing.tailPtr = (Addr_t) &s_cmdRing.tailIndex;
+	cmd->data.createCmdRing.num = num;
+
+	writeCmd( cmd );
+
+	NicResp* resp = getResp(cmd);
+	waitResp( resp );
+
+	int retval = resp->retval;
+	s_cmdRing.doorbell = getNicAddress( resp->data.createCmdRing.doorbellAddr );
+	dbgPrint("retval=%d ring=%p doorbell=%#" PRIxBITS "\n",retval,s_cmdRing.cmds,s_cmdRing.doorbell);
+
+	freeCmd(cmd);
+	return retval;
+}
+
+void rdma_cmd_ring_flush() {
+	if ( s_cmdRing.flushedIndex != s_cmdRing.headIndex ) {
+		s_cmdRing.flushedIndex = s_cmdRing.headIndex;
+		writeDoorbell( s_cmdRing.doorbell, s_cmdRing.headIndex );
+	}
+}
+
+static NicCmd* getRingSlot() {
+
+	assert( s_cmdRing.cmds );
+
+	uint32_t next = ( s_cmdRing.headIndex + 1 ) % s_cmdRing.num;
+	if ( next == s_cmdRing.tailIndex ) {
+		// ring is full, hand what we have to the NIC and wait for it to return slots
+		rdma_cmd_ring_flush();
+		while ( next == s_cmdRing.tailIndex );
+	}
+
+	NicCmd* cmd = &s_cmdRing.cmds[s_cmdRing.headIndex];
+
+	// the NIC has read the command but may not have responded yet
+	waitResp( getResp(cmd) );
+	getResp(cmd)->retval = -INT_MAX;
+	return cmd;
+}
+
+static void putRingSlot() {
+	++s_cmdRing.headIndex;
+	s_cmdRing.headIndex %= s_cmdRing.num;
+}
+
+int rdma_memory_write_enqueue( MemRgnKey key, Node node, Pid pid, size_t offset, void* srcBuffer, size_t length, CompQueueId id, Context context )
+{
+	NicCmd* cmd = getRingSlot();
+
+	dbgPrint("key=%#x offset=%" PRIuBITS " length=%zu cqId=%d index=%d\n", key, offset, length, id, s_cmdRing.headIndex );
+
+	cmd->type = RdmaMemWrite;
+	cmd->data.write.key = key;
+	cmd->data.write.offset = offset;
+	cmd->data.write.srcAddr = (Addr_t) srcBuffer;
+	cmd->data.write.len = length;
+	cmd->data.write.cqId = id;
+	cmd->data.write.context = context;
+	cmd->data.write.pe = pid;
+	cmd->data.write.node = node;
+
+	putRingSlot();
+	return 0;
+}
+
 static int waitResp( NicResp* resp ) {
 	dbgPrint("wait for response from NIC, addr %p\n",&resp->retval);
 
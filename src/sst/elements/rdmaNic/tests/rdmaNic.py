@@ -8,6 +8,9 @@ stdMem_debug = 0
 nicCache_debug = 0
 debug_level = 11
 
+# 2 prints a per NIC message rate summary at the end of simulation
+nic_verbose = os.getenv("RDMANIC_VERBOSE", 1)
+
 debug_addr=0x6280
 
 debugPython=False
@@ -49,6 +52,7 @@ class Builder:
             # "addr_range_end" : 0x7fffffff,
             'baseAddr': 0x80000000,
             'cmdQSize' : 64,
+            "verbose" : nic_verbose,
 	})
         nic.addParam( 'nicId', nodeId )
         nic.addParam( 'pesPerNode', 1 )
@@ -1,5 +1,8 @@
 # -*- coding: utf-8 -*-
 
+import re
+import time
+
 from sst_unittest import *
 from sst_unittest_support import *
 from sst_unittest_parameterized import parameterized
@@ -86,6 +89,69 @@ class testcase_rdmaNic(SSTTestCase):
         log_debug("Running RdmaNic test #{0} ({1}): elffile={4} in dir {3}; using sdl={2}".format(testnum, testname, sdlfile, elftestdir, elffile, env, timeout_sec))
         self.rdmaNic_test_template(testnum, testname, sdlfile, elftestdir, elffile, arch, env, timeout_sec)
 
+    def test_rdmaNic_msgrate(self):
+        self._checkSkipConditions()
+
+        test_path = self.get_testsuite_dir()
+        outdir = "{0}/rdmaNic_tests/app/rdma/msgrate".format(self.get_test_output_run_dir())
+        os.makedirs(outdir)
+
+        sdlfile = "{0}/runVanadis.py".format(test_path)
+        outfile = "{0}/test_rdmaNic_msgrate.out".format(outdir)
+        errfile = "{0}/test_rdmaNic_msgrate.err".format(outdir)
+        mpioutfiles = "{0}/test_rdmaNic_msgrate.testfile".format(outdir)
+        node0_os_outfile = "{0}/stdout-0-100".format(test_path)
+
+        os.environ['RDMANIC_EXE'] = "{0}/app/rdma/riscv64/msgrate".format(test_path)
+        os.environ['RDMANIC_VERBOSE'] = "2"
+
+        start = time.time()
+        oscmd = self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path, timeout_sec=120)
+        wall = time.time() - start
+
+        del os.environ['RDMANIC_VERBOSE']
+
+        # The application reports the message rate it saw in simulated time
+        appRate = None
+        counts = []
+        with open(node0_os_outfile, 'r') as fp:
+            for line in fp:
+                match = re.search(r"(msgrate: \d+ msgs of \d+ bytes) in ([\d.]+) sec, ([\d.]+) msgs/sec", line)
+                if match:
+                    counts.append(match.group(1))
+                    appRate = float(match.group(3))
+        self.assertTrue(appRate is not None, "RdmaNic msgrate result not found in {0}".format(node0_os_outfile))
+        self.assertTrue(appRate > 0, "RdmaNic msgrate reported a rate of {0} msgs/sec".format(appRate))
+
+        # Every NIC reports the MMIO writes and memory responses it handled. One doorbell per
+        # window and one descriptor read per message are fixed by msgrate.c, so they are
+        # compared against the reference along with the message count
+        nicEvents = 0
+        nicCmds = 0
+        with open(outfile, 'r') as fp:
+            for line in fp:
+                match = re.search(r"node(\d+): host commands (\d+), MMIO writes (\d+), memory responses (\d+), "
+                                  r"doorbells (\d+), descriptor reads (\d+)", line)
+                if match:
+                    nicCmds += int(match.group(2))
+                    nicEvents += int(match.group(3)) + int(match.group(4))
+                    counts.append("node{0} doorbells {1} descriptor reads {2}".format(match.group(1), match.group(5), match.group(6)))
+        self.assertTrue(nicCmds > 0, "RdmaNic msgrate NIC summary not found in {0}".format(outfile))
+
+        cmpfile = "{0}/test_rdmaNic_msgrate.counts".format(outdir)
+        reffile = "{0}/app/rdma/riscv64/msgrate.counts.gold".format(test_path)
+        with open(cmpfile, 'w') as fp:
+            for line in sorted(counts):
+                fp.write(line + "\n")
+        cmp_result = testing_compare_diff("test_rdmaNic_msgrate", cmpfile, reffile)
+        if (cmp_result == False):
+            diffdata = testing_get_diff_data("test_rdmaNic_msgrate")
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "RdmaNic msgrate counts {0} do not match reference file {1}".format(cmpfile, reffile))
+
+        log_testing_note("rdmaNic msgrate: {0:.0f} simulated msgs/sec, {1} NIC commands, {2:.0f} NIC events/sec wall clock".format(
+            appRate, nicCmds, nicEvents / wall if wall > 0 else 0))
+
 #####
 
     def rdmaNic_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, arch, env, testtimeout=120):
@@ -24,6 +24,8 @@
 #include "lsq/vlsq.h"
 #include "os/vcpuos.h"
 #include "vbranch/vbranchbasic.h"
+#include "vbranch/vbranchperceptron.h"
+#include "vbranch/vbranchtage.h"
 #include "vbranch/vbranchunit.h"
 #include "velf/velfinfo.h"
 #include "vinsloader.h"
@@ -184,6 +186,7 @@ public:
     virtual uint16_t                     countISAFPReg() const                     = 0;
     virtual void                         tick(SST::Output* output, uint64_t cycle) = 0;
     virtual const VanadisDecoderOptions* getDecoderOptions() const                 = 0;
+    virtual uint16_t                     getInstructionWidth() const               = 0;
 
     uint64_t getInstructionPointer() const { return ip; }
 
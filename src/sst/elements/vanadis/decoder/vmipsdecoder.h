@@ -296,6 +296,7 @@ public:
     virtual const VanadisDecoderOptions* getDecoderOptions() const { return options; }
 
     virtual VanadisFPRegisterMode getFPRegisterMode() const { return VANADIS_REGISTER_MODE_FP32; }
+    virtual uint16_t              getInstructionWidth() const { return 4; }
 
     void setStackPointer( SST::Output* output, VanadisISATable* isa_tbl, VanadisRegisterFile* regFile, const uint64_t start_stack_address ) {
         output->verbose(
@@ -549,7 +550,10 @@ public:
 
                                         // Do we have an entry for the branch instruction we just
                                         // issued
-                                        if ( branch_predictor->contains(ip) ) {
+                                        const bool predicted = branch_predictor->contains(ip);
+                                        speculated_ins->setPrediction(branch_predictor->getPrediction(ip));
+
+                                        if ( predicted ) {
                                             const uint64_t predicted_address = branch_predictor->predictAddress(ip);
                                             speculated_ins->setSpeculatedAddress(predicted_address);
 
@@ -80,6 +80,7 @@ public:
     uint16_t                     countISAFPReg() const override { return options->countISAFPRegisters(); }
     const VanadisDecoderOptions* getDecoderOptions() const override { return options; }
     VanadisFPRegisterMode        getFPRegisterMode() const override { return VANADIS_REGISTER_MODE_FP64; }
+    uint16_t                     getInstructionWidth() const override { return 4; }
 
     void setStackPointer( SST::Output* output, VanadisISATable* isa_tbl,
 	VanadisRegisterFile* regFile, const uint64_t start_stack_address ) override {
@@ -167,7 +168,10 @@ public:
                                 VanadisSpeculatedInstruction* next_spec_ins =
                                     dynamic_cast<VanadisSpeculatedInstruction*>(next_ins);
 
-                                if ( branch_predictor->contains(ip) ) {
+                                const bool predicted = branch_predictor->contains(ip);
+                                next_spec_ins->setPrediction(branch_predictor->getPrediction(ip));
+
+                                if ( predicted ) {
                                     // We have an address predicton from the branching unit
                                     const uint64_t predicted_address = branch_predictor->predictAddress(ip);
                                     next_spec_ins->setSpeculatedAddress(predicted_address);
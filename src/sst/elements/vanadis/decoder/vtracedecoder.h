@@ -0,0 +1,281 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_TRACE_DECODER
+#define _H_VANADIS_TRACE_DECODER
+
+#include "decoder/vdecoder.h"
+#include "inst/vtraceinst.h"
+#include "os/vtracecpuos.h"
+#include "vinstrace.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// Replays a committed micro-op stream recorded by the core (instruction_trace_file) instead of
+// decoding the binary. The micro-ops go through the same ROB, issue, functional units, LSQ and
+// branch predictor as decoded ones, they just do no functional work. Instruction fetch is still
+// modeled through the instruction loader so icache and micro-op cache misses stall as they would
+// when decoding.
+//
+// The trace only holds the correct path. When the predictor gets a branch wrong, fetch stops after
+// the branch (and its delay slot) until it retires and the core clears the pipeline, so the
+// mispredict costs the same resolve and refill time but wrong path micro-ops never enter the ROB.
+class VanadisTraceDecoder : public VanadisDecoder
+{
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        VanadisTraceDecoder, "vanadis", "VanadisTraceDecoder",
+        SST_ELI_ELEMENT_VERSION(1, 0, 0),
+        "Replays an instruction trace recorded by a Vanadis core through the pipeline without functional execution.",
+        SST::Vanadis::VanadisDecoder)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "trace_file", "Instruction trace recorded for this hardware thread by the core instruction_trace_file parameter", "" },
+        { "decode_max_ins_per_cycle", "Maximum number of instructions that can be decoded and issued per cycle", "2" })
+
+    VanadisTraceDecoder(ComponentId_t id, Params& params) : VanadisDecoder(id, params)
+    {
+        const std::string trace_path = params.find<std::string>("trace_file", "");
+
+        if ( trace_path.empty() ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s requires a trace_file\n", getName().c_str());
+        }
+
+        if ( nullptr == dynamic_cast<VanadisTraceOSHandler*>(os_handler) ) {
+            getSimulationOutput().fatal(
+                CALL_INFO, -1, "Error: %s requires a vanadis.VanadisTraceOSHandler in its os_handler slot\n",
+                getName().c_str());
+        }
+
+        reader = new VanadisTraceReader(&getSimulationOutput(), trace_path);
+
+        const VanadisTraceHeader& header = reader->getHeader();
+        isa_name.assign(header.isa, strnlen(header.isa, sizeof(header.isa)));
+        options = new VanadisDecoderOptions(
+            header.reg_ignore_writes, header.int_reg_count, header.fp_reg_count, header.syscall_code_reg,
+            (VanadisFPRegisterMode)header.fp_reg_mode);
+        ins_width = header.ins_width;
+
+        if ( 0 == ins_width ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s trace %s has no instruction width\n",
+                getName().c_str(), trace_path.c_str());
+        }
+
+        max_decodes_per_cycle = params.find<uint16_t>("decode_max_ins_per_cycle", 2);
+
+        wait_for_redirect   = false;
+        delay_slot_redirect = false;
+        exit_issued         = false;
+    }
+
+    ~VanadisTraceDecoder()
+    {
+        delete reader;
+        delete options;
+    }
+
+    const char*                  getISAName() const override { return isa_name.c_str(); }
+    uint16_t                     countISAIntReg() const override { return options->countISAIntRegisters(); }
+    uint16_t                     countISAFPReg() const override { return options->countISAFPRegisters(); }
+    const VanadisDecoderOptions* getDecoderOptions() const override { return options; }
+    VanadisFPRegisterMode        getFPRegisterMode() const override { return options->getFPRegisterMode(); }
+    uint16_t                     getInstructionWidth() const override { return ins_width; }
+
+    // The register values are not used when replaying
+    void setStackPointer( SST::Output* output, VanadisISATable* isa_tbl, VanadisRegisterFile* regFile, const uint64_t value ) override {}
+    void setArg1Register( SST::Output* output, VanadisISATable* isa_tbl, VanadisRegisterFile* regFile, const uint64_t value ) override {}
+    void setReturnRegister( SST::Output* output, VanadisISATable* isa_tbl, VanadisRegisterFile* regFile, const uint64_t value ) override {}
+
+    void tick(SST::Output* output, uint64_t cycle) override
+    {
+        cycle_count = cycle;
+
+        for ( uint16_t i = 0; i < max_decodes_per_cycle; ++i ) {
+            if ( wait_for_redirect || exit_issued || thread_rob->full() ) {
+                break;
+            }
+
+            if ( group.empty() && !readGroup() ) {
+                // the trace ended without the syscall that ended the thread, e.g. the recording hit max_cycle
+                output->verbose(CALL_INFO, 16, 0, "---> end of trace for thr: %" PRIu32 ", exit thread\n", hw_thr);
+                thread_rob->push(new VanadisTraceSysCallInstruction(ip, hw_thr, options, true));
+                exit_issued = true;
+                break;
+            }
+
+            const uint64_t ins_addr = group.front().ins_addr;
+
+            if ( !ins_loader->hasBundleAt(ins_addr) ) {
+                if ( ins_loader->hasPredecodeAt(ins_addr, ins_width) ) {
+                    // the micro-ops come from the trace, the empty bundle only marks the instruction
+                    // as decoded so it is issued next cycle like a decoded one would be
+                    stat_predecode_hit->addData(1);
+                    ins_loader->cacheDecodedBundle(new VanadisInstructionBundle(ins_addr));
+                }
+                else {
+                    ins_loader->requestLoadAt(output, ins_addr, ins_width);
+                    stat_ins_bytes_loaded->addData(ins_width);
+                    stat_predecode_miss->addData(1);
+                }
+                break;
+            }
+
+            if ( group.size() >= (thread_rob->capacity() - thread_rob->size()) ) {
+                stat_uop_delayed_rob_full->addData(1);
+                break;
+            }
+
+            stat_uop_hit->addData(1);
+            issueGroup(output);
+        }
+    }
+
+protected:
+    void clearDecoderAfterMisspeculate(SST::Output* output) override
+    {
+        output->verbose(
+            CALL_INFO, 16, 0, "[trace-decoder] -> pipeline cleared, resume at 0x%" PRI_ADDR " (waiting: %s)\n", ip,
+            wait_for_redirect ? "yes" : "no");
+
+        wait_for_redirect   = false;
+        delay_slot_redirect = false;
+    }
+
+    // reads the micro-ops of the next instruction, false at the end of the trace
+    bool readGroup()
+    {
+        const VanadisTraceRecord* rec = reader->peek();
+
+        if ( nullptr == rec ) {
+            return false;
+        }
+
+        const uint64_t ins_addr = rec->ins_addr;
+
+        do {
+            group.push_back(*rec);
+            reader->pop();
+
+            // a branch ends its instruction, a following record at the same address is the next
+            // time round a loop
+            if ( INST_BRANCH == group.back().func_type ) {
+                break;
+            }
+
+            rec = reader->peek();
+        } while ( nullptr != rec && rec->ins_addr == ins_addr );
+
+        return true;
+    }
+
+    void issueGroup(SST::Output* output)
+    {
+        // the group is the delay slot of a mispredicted branch, stop once it is in the ROB
+        const bool redirect_after_group = delay_slot_redirect;
+        delay_slot_redirect             = false;
+
+        for ( const VanadisTraceRecord& rec : group ) {
+            VanadisInstruction* next_ins = createInstruction(rec);
+
+            if ( INST_BRANCH == rec.func_type ) {
+                VanadisTraceBranchInstruction* branch_ins = static_cast<VanadisTraceBranchInstruction*>(next_ins);
+
+                const uint64_t predicted_address = branch_predictor->contains(rec.ins_addr)
+                                                       ? branch_predictor->predictAddress(rec.ins_addr)
+                                                       : branch_ins->getNotTakenAddress();
+                branch_ins->setSpeculatedAddress(predicted_address);
+                branch_ins->setPrediction(branch_predictor->getPrediction(rec.ins_addr));
+
+                if ( predicted_address != rec.next_addr ) {
+                    output->verbose(
+                        CALL_INFO, 16, 0,
+                        "----> branch 0x%" PRI_ADDR " predicted 0x%" PRI_ADDR " resolves to 0x%" PRI_ADDR
+                        ", stop fetch until it retires\n",
+                        rec.ins_addr, predicted_address, rec.next_addr);
+
+                    if ( VANADIS_NO_DELAY_SLOT == branch_ins->getDelaySlotType() ) {
+                        wait_for_redirect = true;
+                    }
+                    else {
+                        delay_slot_redirect = true;
+                    }
+                }
+            }
+
+            thread_rob->push(next_ins);
+        }
+
+        group.clear();
+
+        if ( redirect_after_group ) {
+            wait_for_redirect = true;
+        }
+
+        const VanadisTraceRecord* rec = reader->peek();
+        if ( nullptr != rec ) {
+            ip = rec->ins_addr;
+        }
+    }
+
+    VanadisInstruction* createInstruction(const VanadisTraceRecord& rec)
+    {
+        switch ( rec.func_type ) {
+        case INST_LOAD:
+            return new VanadisTraceLoadInstruction(rec, hw_thr, options);
+        case INST_STORE:
+            if ( MEM_TRANSACTION_LLSC_STORE == rec.sub_type ) {
+                return new VanadisTraceStoreConditionalInstruction(rec, hw_thr, options);
+            }
+            return new VanadisTraceStoreInstruction(rec, hw_thr, options);
+        case INST_BRANCH:
+            return new VanadisTraceBranchInstruction(rec, hw_thr, options);
+        case INST_FENCE:
+            return new VanadisFenceInstruction(rec.ins_addr, hw_thr, options, (VanadisFenceType)rec.sub_type);
+        case INST_SYSCALL:
+            // syscalls are recorded when they are handed to the OS, so the last record of the
+            // trace is the syscall that ended the thread
+            return new VanadisTraceSysCallInstruction(rec, hw_thr, options, nullptr == reader->peek());
+        case INST_ROCC0:
+        case INST_ROCC1:
+        case INST_ROCC2:
+        case INST_ROCC3:
+            // the co-processors need the ISA instruction, replay their micro-ops on the integer units
+            return new VanadisTraceInstruction(rec, hw_thr, options, INST_INT_ARITH);
+        default:
+            return new VanadisTraceInstruction(rec, hw_thr, options, (VanadisFunctionalUnitType)rec.func_type);
+        }
+    }
+
+    VanadisTraceReader*             reader;
+    VanadisDecoderOptions*          options;
+    std::string                     isa_name;
+    uint16_t                        ins_width;
+    uint16_t                        max_decodes_per_cycle;
+    std::vector<VanadisTraceRecord> group;
+
+    bool wait_for_redirect;
+    bool delay_slot_redirect;
+    bool exit_issued;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
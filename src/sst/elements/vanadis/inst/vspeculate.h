@@ -24,6 +24,13 @@
 namespace SST {
 namespace Vanadis {
 
+// What a branch unit predicted a branch with, kept with the branch and handed back to the unit
+// when it retires. Units that only cache targets leave it empty.
+struct VanadisBranchPrediction {
+    uint64_t history; // global history when the branch was predicted
+    bool     taken;   // predicted direction
+};
+
 class VanadisSpeculatedInstruction : public virtual VanadisInstruction
 {
 
@@ -46,6 +53,7 @@ public:
 
         // speculatedAddress = (addr + 4);
         takenAddress = UINT64_MAX;
+        prediction   = { 0, false };
     }
 
     virtual uint64_t getSpeculatedAddress() const { return speculatedAddress; }
@@ -59,6 +67,12 @@ public:
     virtual VanadisDelaySlotRequirement getDelaySlotType() const { return delayType; }
     uint64_t                            getInstructionWidth() const { return ins_width; }
 
+    const VanadisBranchPrediction& getPrediction() const { return prediction; }
+    void                           setPrediction(const VanadisBranchPrediction& pred) { prediction = pred; }
+
+    // fall through address, including the delay slot if there is one
+    uint64_t getNotTakenAddress() { return calculateStandardNotTakenAddress(); }
+
 protected:
     uint64_t calculateStandardNotTakenAddress()
     {
@@ -81,6 +95,7 @@ protected:
     uint64_t                    speculatedAddress;
     uint64_t                    takenAddress;
     uint64_t                    ins_width;
+    VanadisBranchPrediction     prediction;
 };
 
 } // namespace Vanadis
@@ -0,0 +1,248 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_TRACE_INST
+#define _H_VANADIS_TRACE_INST
+
+#include "inst/vinstall.h"
+#include "vinstrace.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace Vanadis {
+
+// Micro-ops created from a VanadisTraceRecord by the VanadisTraceDecoder. They carry the recorded
+// registers so the pipeline sees the same dependencies, but do no functional work: memory
+// operations use the recorded address and branches resolve to the recorded target. Where the class
+// a micro-op is replayed as expects a register the record does not have, the register array is
+// sized up and the extra entries are left as register 0.
+
+inline void
+copyTraceRegisters(const uint8_t* rec_regs, const uint8_t rec_count, uint16_t* regs, const uint16_t count)
+{
+    for ( uint16_t i = 0; i < std::min<uint16_t>(rec_count, count); ++i ) {
+        regs[i] = rec_regs[i];
+    }
+}
+
+#define VANADIS_TRACE_COPY_REGISTERS(rec)                                                      \
+    copyTraceRegisters(rec.int_in, rec.int_in_count, isa_int_regs_in, count_isa_int_reg_in);     \
+    copyTraceRegisters(rec.int_out, rec.int_out_count, isa_int_regs_out, count_isa_int_reg_out); \
+    copyTraceRegisters(rec.fp_in, rec.fp_in_count, isa_fp_regs_in, count_isa_fp_reg_in);         \
+    copyTraceRegisters(rec.fp_out, rec.fp_out_count, isa_fp_regs_out, count_isa_fp_reg_out)
+
+class VanadisTraceInstruction : public virtual VanadisInstruction
+{
+public:
+    VanadisTraceInstruction(const VanadisTraceRecord& rec, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts,
+        const VanadisFunctionalUnitType func_type) :
+        VanadisInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.int_in_count, rec.int_out_count, rec.int_in_count, rec.int_out_count,
+            rec.fp_in_count, rec.fp_out_count, rec.fp_in_count, rec.fp_out_count),
+        funcType(func_type)
+    {
+        VANADIS_TRACE_COPY_REGISTERS(rec);
+    }
+
+    VanadisTraceInstruction* clone() override { return new VanadisTraceInstruction(*this); }
+
+    VanadisFunctionalUnitType getInstFuncType() const override { return funcType; }
+
+    const char* getInstCode() const override { return "TRACE"; }
+
+    void printToBuffer(char* buffer, size_t buffer_size) override
+    {
+        snprintf(buffer, buffer_size, "TRACE %s", funcTypeToString(funcType));
+    }
+
+    void scalarExecute(SST::Output* output, VanadisRegisterFile* regFile) override { markExecuted(); }
+
+protected:
+    const VanadisFunctionalUnitType funcType;
+};
+
+class VanadisTraceLoadInstruction : public virtual VanadisLoadInstruction
+{
+public:
+    VanadisTraceLoadInstruction(const VanadisTraceRecord& rec, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts) :
+        VanadisInstruction(
+            rec.ins_addr, hw_thr, isa_opts,
+            std::max<uint16_t>(rec.int_in_count, 1), std::max<uint16_t>(rec.int_out_count, rec.fp_out_count > 0 ? 0 : 1),
+            std::max<uint16_t>(rec.int_in_count, 1), std::max<uint16_t>(rec.int_out_count, rec.fp_out_count > 0 ? 0 : 1),
+            rec.fp_in_count, rec.fp_out_count, rec.fp_in_count, rec.fp_out_count),
+        VanadisLoadInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.int_in[0], 0, (rec.fp_out_count > 0) ? rec.fp_out[0] : rec.int_out[0],
+            rec.mem_width, false, (VanadisMemoryTransaction)rec.sub_type,
+            (rec.fp_out_count > 0) ? LOAD_FP_REGISTER : LOAD_INT_REGISTER),
+        loadAddress(rec.mem_addr)
+    {
+        VANADIS_TRACE_COPY_REGISTERS(rec);
+    }
+
+    VanadisTraceLoadInstruction* clone() override { return new VanadisTraceLoadInstruction(*this); }
+
+    void computeLoadAddress(VanadisRegisterFile* reg, uint64_t* out_addr, uint16_t* width) override
+    {
+        (*out_addr) = loadAddress;
+        (*width)    = load_width;
+    }
+
+    void computeLoadAddress(SST::Output* output, VanadisRegisterFile* regFile, uint64_t* out_addr, uint16_t* width) override
+    {
+        computeLoadAddress(regFile, out_addr, width);
+    }
+
+protected:
+    const uint64_t loadAddress;
+};
+
+class VanadisTraceStoreInstruction : public virtual VanadisStoreInstruction
+{
+public:
+    VanadisTraceStoreInstruction(const VanadisTraceRecord& rec, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts) :
+        VanadisInstruction(
+            rec.ins_addr, hw_thr, isa_opts,
+            std::max<uint16_t>(rec.int_in_count, rec.fp_in_count > 0 ? 1 : 2), rec.int_out_count,
+            std::max<uint16_t>(rec.int_in_count, rec.fp_in_count > 0 ? 1 : 2), rec.int_out_count,
+            rec.fp_in_count, rec.fp_out_count, rec.fp_in_count, rec.fp_out_count),
+        VanadisStoreInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.int_in[0], 0, (rec.fp_in_count > 0) ? rec.fp_in[0] : rec.int_in[1],
+            rec.mem_width, (VanadisMemoryTransaction)rec.sub_type, (rec.fp_in_count > 0) ? STORE_FP_REGISTER : STORE_INT_REGISTER),
+        storeAddress(rec.mem_addr)
+    {
+        VANADIS_TRACE_COPY_REGISTERS(rec);
+    }
+
+    VanadisTraceStoreInstruction* clone() override { return new VanadisTraceStoreInstruction(*this); }
+
+    void computeStoreAddress(SST::Output* output, VanadisRegisterFile* reg, uint64_t* store_addr, uint16_t* op_width) override
+    {
+        (*store_addr) = storeAddress;
+        (*op_width)   = store_width;
+    }
+
+protected:
+    const uint64_t storeAddress;
+};
+
+class VanadisTraceStoreConditionalInstruction : public virtual VanadisStoreConditionalInstruction
+{
+public:
+    VanadisTraceStoreConditionalInstruction(
+        const VanadisTraceRecord& rec, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts) :
+        VanadisInstruction(
+            rec.ins_addr, hw_thr, isa_opts,
+            std::max<uint16_t>(rec.int_in_count, rec.fp_in_count > 0 ? 1 : 2), std::max<uint16_t>(rec.int_out_count, 1),
+            std::max<uint16_t>(rec.int_in_count, rec.fp_in_count > 0 ? 1 : 2), std::max<uint16_t>(rec.int_out_count, 1),
+            rec.fp_in_count, std::max<uint16_t>(rec.fp_out_count, rec.fp_in_count > 0 ? 1 : 0),
+            rec.fp_in_count, std::max<uint16_t>(rec.fp_out_count, rec.fp_in_count > 0 ? 1 : 0)),
+        VanadisStoreInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.int_in[0], 0, (rec.fp_in_count > 0) ? rec.fp_in[0] : rec.int_in[1],
+            rec.mem_width, MEM_TRANSACTION_LLSC_STORE, (rec.fp_in_count > 0) ? STORE_FP_REGISTER : STORE_INT_REGISTER),
+        VanadisStoreConditionalInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.int_in[0], 0, (rec.fp_in_count > 0) ? rec.fp_in[0] : rec.int_in[1],
+            rec.int_out[0], rec.mem_width, (rec.fp_in_count > 0) ? STORE_FP_REGISTER : STORE_INT_REGISTER),
+        storeAddress(rec.mem_addr)
+    {
+        VANADIS_TRACE_COPY_REGISTERS(rec);
+    }
+
+    VanadisTraceStoreConditionalInstruction* clone() override { return new VanadisTraceStoreConditionalInstruction(*this); }
+
+    void computeStoreAddress(SST::Output* output, VanadisRegisterFile* reg, uint64_t* store_addr, uint16_t* op_width) override
+    {
+        (*store_addr) = storeAddress;
+        (*op_width)   = store_width;
+    }
+
+protected:
+    const uint64_t storeAddress;
+};
+
+class VanadisTraceBranchInstruction : public virtual VanadisSpeculatedInstruction
+{
+public:
+    VanadisTraceBranchInstruction(const VanadisTraceRecord& rec, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts) :
+        VanadisInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.int_in_count, rec.int_out_count, rec.int_in_count, rec.int_out_count,
+            rec.fp_in_count, rec.fp_out_count, rec.fp_in_count, rec.fp_out_count),
+        VanadisSpeculatedInstruction(
+            rec.ins_addr, hw_thr, isa_opts, rec.ins_width, rec.int_in_count, rec.int_out_count, rec.int_in_count,
+            rec.int_out_count, rec.fp_in_count, rec.fp_out_count, rec.fp_in_count, rec.fp_out_count,
+            (VanadisDelaySlotRequirement)rec.sub_type),
+        resolvedAddress(rec.next_addr)
+    {
+        VANADIS_TRACE_COPY_REGISTERS(rec);
+    }
+
+    VanadisTraceBranchInstruction* clone() override { return new VanadisTraceBranchInstruction(*this); }
+
+    const char* getInstCode() const override { return "TRACE_BRANCH"; }
+
+    uint64_t getResolvedAddress() const { return resolvedAddress; }
+
+    void scalarExecute(SST::Output* output, VanadisRegisterFile* regFile) override
+    {
+        takenAddress = resolvedAddress;
+        markExecuted();
+    }
+
+protected:
+    const uint64_t resolvedAddress;
+};
+
+class VanadisTraceSysCallInstruction : public virtual VanadisSysCallInstruction
+{
+public:
+    VanadisTraceSysCallInstruction(
+        const uint64_t addr, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts, const bool exit) :
+        VanadisInstruction(
+            addr, hw_thr, isa_opts, isa_opts->countISAIntRegisters(), isa_opts->countISAIntRegisters(),
+            isa_opts->countISAIntRegisters(), isa_opts->countISAIntRegisters(), isa_opts->countISAFPRegisters(),
+            isa_opts->countISAFPRegisters(), isa_opts->countISAFPRegisters(), isa_opts->countISAFPRegisters()),
+        VanadisSysCallInstruction(addr, hw_thr, isa_opts),
+        record(),
+        isExit(exit)
+    {}
+
+    VanadisTraceSysCallInstruction(
+        const VanadisTraceRecord& rec, const uint32_t hw_thr, const VanadisDecoderOptions* isa_opts, const bool exit) :
+        VanadisInstruction(
+            rec.ins_addr, hw_thr, isa_opts, isa_opts->countISAIntRegisters(), isa_opts->countISAIntRegisters(),
+            isa_opts->countISAIntRegisters(), isa_opts->countISAIntRegisters(), isa_opts->countISAFPRegisters(),
+            isa_opts->countISAFPRegisters(), isa_opts->countISAFPRegisters(), isa_opts->countISAFPRegisters()),
+        VanadisSysCallInstruction(rec.ins_addr, hw_thr, isa_opts),
+        record(rec),
+        isExit(exit)
+    {}
+
+    VanadisTraceSysCallInstruction* clone() override { return new VanadisTraceSysCallInstruction(*this); }
+
+    // the last syscall of the trace, the thread exits when it is handled
+    bool exitsThread() const { return isExit; }
+
+    // the OS call recorded for a brk, mmap or munmap
+    const VanadisTraceRecord& getRecord() const { return record; }
+
+protected:
+    const VanadisTraceRecord record;
+    const bool               isExit;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <vector>
 #include <queue>
+#include <unordered_map>
 
 using namespace SST::Interfaces;
 
@@ -95,6 +96,9 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             stores_pending_index = 0;
             stores_pending_size = 0;
 
+            store_granules.resize(hw_threads);
+            loads_pending_count.resize(hw_threads, 0);
+
             stat_loads_issued = registerStatistic<uint64_t>("loads_issued", "1");
             stat_stores_issued = registerStatistic<uint64_t>("stores_issued", "1");
             stat_fences_issued = registerStatistic<uint64_t>("fences_issued", "1");
@@ -165,13 +169,16 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
             }
 
-            for(auto load_itr = loads_pending.begin(); load_itr != loads_pending.end(); ) {
-                if( (*load_itr)->getHWThread() == thread ) {
-                    delete (*load_itr);
-                    load_itr = loads_pending.erase(load_itr);
-                } else {
-                    ++load_itr;
+            if(loads_pending_count[thread] > 0) {
+                for(auto load_itr = loads_pending.begin(); load_itr != loads_pending.end(); ) {
+                    if( (*load_itr)->getHWThread() == thread ) {
+                        delete (*load_itr);
+                        load_itr = loads_pending.erase(load_itr);
+                    } else {
+                        ++load_itr;
+                    }
                 }
+                loads_pending_count[thread] = 0;
             }
 
             stores_pending_size -= stores_pending[thread].size();
@@ -179,6 +186,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                 delete (*store_itr);
                 store_itr = stores_pending[thread].erase(store_itr);
             }
+            store_granules[thread].clear();
         }
 
         // must be implemented to allow the memory system to initialize itself during
@@ -420,7 +428,8 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
                         if(target_reg != load_ins->getISAOptions()->getRegisterIgnoreWrites()) {
                             reg_width = lsq->registerFiles->at(target_thread)->getIntRegWidth();
-                            std::vector<uint8_t> register_value(reg_width);
+                            std::vector<uint8_t>& register_value = lsq->register_buffer;
+                            register_value.resize(reg_width);
                             // copy entire register here
                             lsq->registerFiles->at(target_thread)->copyFromIntRegister(target_reg, 0, &register_value[0], reg_width);
 
@@ -462,7 +471,8 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
 
                         reg_width = lsq->registerFiles->at(target_thread)->getFPRegWidth();
-                        std::vector<uint8_t> register_value(reg_width);
+                        std::vector<uint8_t>& register_value = lsq->register_buffer;
+                        register_value.resize(reg_width);
 
                         // copy entire register here
                         lsq->registerFiles->at(target_thread)->copyFromFPRegister(target_reg, 0, &register_value[0], reg_width);
@@ -501,6 +511,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                         load_ins->markExecuted();
                         lsq->stat_loads_executed->addData(1);
                         lsq->loads_pending.erase(load_itr);
+                        lsq->loads_pending_count[load_entry->getHWThread()]--;
                         delete load_entry;
                     } else {
                         if(out->getVerboseLevel() >= 9) {
@@ -553,6 +564,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                                 processLLSC(ev,store_ins,store_entry);
 
                                 store_ins->markExecuted();
+                                lsq->unindexStore(thr, store_entry);
                                 lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
                                 lsq->stores_pending_size--;
                                 delete store_entry;
@@ -561,6 +573,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                             case MEM_TRANSACTION_LOCK:
                             {
                                 store_ins->markExecuted();
+                                lsq->unindexStore(thr, store_entry);
                                 lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
                                 lsq->stores_pending_size--;
                                 delete store_entry;
@@ -632,6 +645,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     // this was a standard store (not LLSC/LOCK) and we issued into system successfully
                     if(LIKELY(issue_result))
                     {
+                        unindexStore(thr, current_store);
                         stores_pending[thr].pop_front();
                         stores_pending_size--;
 
@@ -711,7 +725,9 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
             }
 
             // if the store is not a split operation, then copy payload we are good to go, if it is split
-            // handle this case later after we do a load of address and width calculation
+            // handle this case later after we do a load of address and width calculation. The payload
+            // is moved into the request, the sizes are passed separately because the argument
+            // evaluation order is unspecified
             if(LIKELY(! needs_split)) {
                     getStoreTarget(store_entry,store_ins, &target_thread, &target_reg);
                     registerFiles->at(target_thread)->copyFromRegister(target_reg, store_ins->getRegisterOffset(), &payload[0], store_width,
@@ -744,7 +760,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     registerFiles->at(target_thread)->copyFromRegister(target_reg, store_ins->getRegisterOffset(), &payload[0], store_width_left,
                     store_ins->getValueRegisterType() == STORE_FP_REGISTER);
 
-                    store_req = new StandardMem::Write(store_address & address_mask, payload.size(), payload,
+                    store_req = new StandardMem::Write(store_address & address_mask, store_width_left, std::move(payload),
                         false, 0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread());
 
                     std_stores_in_flight.insert(store_req->getID());
@@ -759,7 +775,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     registerFiles->at(target_thread)->copyFromRegister(target_reg, store_ins->getRegisterOffset()+store_width_left, &payload[0], store_width_right,
                     store_ins->getValueRegisterType() == STORE_FP_REGISTER);
 
-                    store_req = new StandardMem::Write(store_address_right & address_mask, payload.size(), payload,
+                    store_req = new StandardMem::Write(store_address_right & address_mask, store_width_right, std::move(payload),
                         false, 0, store_address_right, store_ins->getInstructionAddress(), store_ins->getHWThread());
                     memInterface->send(store_req);
                     std_stores_in_flight.insert(store_req->getID());
@@ -779,7 +795,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                         output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "}\n");
                     }
 
-                    store_req = new StandardMem::Write(store_address & address_mask, payload.size(), payload,
+                    store_req = new StandardMem::Write(store_address & address_mask, store_width, std::move(payload),
                         false, 0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread());
                     std_stores_in_flight.insert(store_req->getID());
                     memInterface->send(store_req);
@@ -799,7 +815,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: LLSC-store store-at: 0x%" PRI_ADDR " width: %" PRIu64 "\n",
                         store_address, store_width);
 
-                    store_req = new StandardMem::StoreConditional(store_address & address_mask, payload.size(), payload,
+                    store_req = new StandardMem::StoreConditional(store_address & address_mask, store_width, std::move(payload),
                                 0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread() );
                 }
             } break;
@@ -811,7 +827,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: LOCK-store store-at: 0x%" PRI_ADDR " width: %" PRIu64 "\n",
                         store_address, store_width);
 
-                    store_req = new StandardMem::WriteUnlock(store_address & address_mask, payload.size(), payload,
+                    store_req = new StandardMem::WriteUnlock(store_address & address_mask, store_width, std::move(payload),
                                 0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread());
                 }
             } break;
@@ -958,6 +974,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                     load_ins->getInstructionAddress(), load_ins->getHWThread(), load_entry->countRequests());
 
                 loads_pending.push_back(load_entry);
+                loads_pending_count[load_entry->getHWThread()]++;
             }
         }
 
@@ -1005,6 +1022,7 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
                 output->verbose(CALL_INFO, 16, VANADIS_DBG_LSQ_LOAD_FLG, " (ScalarLSQ) -> queue front is store: ins: 0x%" PRI_ADDR " / thr: %" PRIu32 " has issued so will process...\n",
                         new_pending_store->getStoreInstruction()->getInstructionAddress(), new_pending_store->getStoreInstruction()->getHWThread());
                 stores_pending[store_ins->getHWThread()].push_back(new_pending_store);
+                indexStore(store_ins->getHWThread(), new_pending_store);
                 stores_pending_size++;
             }
             return true;
@@ -1290,22 +1308,65 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
 
         bool pendingLoads(const uint32_t thr)
         {
-            bool matchID = false;
+            return loads_pending_count[thr] > 0;
+        }
 
-            for(auto load_itr = loads_pending.begin(); load_itr != loads_pending.end(); load_itr++) {
-                if((*load_itr)->getHWThread() == thr) {
-                    matchID = true;
-                    break;
-                }
+        // The pending stores of each thread are indexed by the 8 byte granules they touch so a load
+        // only has to look at the stores when it shares a granule with one of them. A zero width
+        // operation is treated as touching the granule of its address, which is all the overlap
+        // check below can match for it.
+        enum { StoreGranuleShift = 3 };
+
+        uint64_t firstGranule(const uint64_t address) const { return address >> StoreGranuleShift; }
+        uint64_t lastGranule(const uint64_t address, const uint64_t width) const {
+            return ( address + ( width ? width - 1 : 0 ) ) >> StoreGranuleShift;
+        }
+
+        void indexStore(const uint32_t thread, const VanadisBasicStorePendingEntry* entry)
+        {
+            const uint64_t last = lastGranule(entry->getStoreAddress(), entry->getStoreWidth());
+            for(uint64_t granule = firstGranule(entry->getStoreAddress()); granule <= last; ++granule) {
+                store_granules[thread][granule]++;
             }
+        }
 
-            return matchID;
+        void unindexStore(const uint32_t thread, const VanadisBasicStorePendingEntry* entry)
+        {
+            const uint64_t last = lastGranule(entry->getStoreAddress(), entry->getStoreWidth());
+            for(uint64_t granule = firstGranule(entry->getStoreAddress()); granule <= last; ++granule) {
+                auto iter = store_granules[thread].find(granule);
+                assert(iter != store_granules[thread].end());
+                if(0 == --iter->second) {
+                    store_granules[thread].erase(iter);
+                }
+            }
         }
 
+        // A load that overlaps a pending store waits for the store to issue, even when the store
+        // covers it. Stores here have not retired and only read their value register in issueStore(),
+        // and loads only complete through the memory response handler, so forwarding would need the
+        // store payload captured when the store is queued and a second load completion path.
         bool checkStoreConflict(const uint32_t thread, const uint64_t address, const uint64_t width)
         {
             bool conflicts = false;
 
+            if(store_granules[thread].empty()) {
+                return false;
+            }
+
+            bool shares_granule = false;
+            const uint64_t last = lastGranule(address, width);
+            for(uint64_t granule = firstGranule(address); granule <= last; ++granule) {
+                if(store_granules[thread].count(granule)) {
+                    shares_granule = true;
+                    break;
+                }
+            }
+
+            if(LIKELY(!shares_granule)) {
+                return false;
+            }
+
             for(auto store_itr = stores_pending[thread].begin(); store_itr != stores_pending[thread].end(); store_itr++) {
                 VanadisBasicStorePendingEntry* current_entry = (*store_itr);
 
@@ -1323,6 +1384,9 @@ class VanadisBasicLoadStoreQueue : public SST::Vanadis::VanadisLoadStoreQueue
         std::vector< std::deque<VanadisBasicLoadStoreEntry*> > op_q;
         std::vector< std::deque<VanadisBasicStorePendingEntry*> > stores_pending;
         std::deque<VanadisBasicLoadPendingEntry*> loads_pending;
+        std::vector<size_t> loads_pending_count; // per hw thread
+        std::vector< std::unordered_map<uint64_t, uint32_t> > store_granules; // per hw thread, granule -> number of pending stores
+        std::vector<uint8_t> register_buffer; // scratch register image for load responses
         std::set<StandardMem::Request::id_t> std_stores_in_flight;
         int op_q_index; // Next hw_thread to check in op_q queues
         int stores_pending_index; // Next hw thread to check in stores_pending q's
@@ -14,6 +14,7 @@
 // distribution.
 
 #include <map>
+#include <cassert>
 
 
 #include <sst/core/interfaces/stdMem.h>
@@ -34,6 +35,45 @@ enum class VanadisBasicLoadStoreEntryOp {
     FENCE
 };
 
+// The memory requests of an LSQ entry, at most two because an operation that straddles a
+// cache line is split in two. Kept inline so an entry does not need a heap allocation.
+class VanadisBasicRequestList {
+public:
+    VanadisBasicRequestList() : count(0) {}
+
+    size_t size() const { return count; }
+
+    void add(StandardMem::Request::id_t req) {
+        assert(count < MaxRequests);
+        reqs[count++] = req;
+    }
+
+    int find(StandardMem::Request::id_t req) const {
+        for(int i = 0; i < count; ++i) {
+            if(reqs[i] == req) {
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    // keeps the order of the remaining requests
+    void remove(StandardMem::Request::id_t req) {
+        int index = find(req);
+        if(index >= 0) {
+            for(int i = index + 1; i < count; ++i) {
+                reqs[i - 1] = reqs[i];
+            }
+            --count;
+        }
+    }
+
+private:
+    enum { MaxRequests = 2 };
+    StandardMem::Request::id_t reqs[MaxRequests];
+    int count;
+};
+
 class VanadisBasicLoadStoreEntry {
 public:
     VanadisBasicLoadStoreEntry(VanadisInstruction* the_ins) : ins(the_ins) {sw_thr=65536;}
@@ -103,10 +143,6 @@ class VanadisBasicStorePendingEntry : public VanadisBasicStoreEntry {
             VanadisBasicStoreEntry(store_ins), storeAddress(addr), storeWidth(width),
             valueRegister(valReg), valueRegisterType(valRegType), dispatched(false) {}
 
-        ~VanadisBasicStorePendingEntry() {
-            requests.clear();
-        }
-
         bool     isDispatched() const { return dispatched; }
         void     markDispatched() { dispatched = true; }
 
@@ -115,29 +151,9 @@ class VanadisBasicStorePendingEntry : public VanadisBasicStoreEntry {
         uint16_t getValueRegister() const { return valueRegister; }
 
         size_t   countRequests() const { return requests.size(); }
-        void     addRequest(StandardMem::Request::id_t req) { requests.push_back(req); }
-        void     removeRequest(StandardMem::Request::id_t req) {
-            for(auto req_itr = requests.begin(); req_itr != requests.end(); ) {
-                if( (*req_itr) == req ) {
-                    requests.erase(req_itr);
-                    break;
-                } else {
-                    req_itr++;
-                }
-            }
-        }
-        bool     containsRequest(StandardMem::Request::id_t req) {
-            bool found = false;
-
-            for(auto req_itr = requests.begin(); req_itr != requests.end(); req_itr++) {
-                if((*req_itr) == req) {
-                    found = true;
-                    break;
-                }
-            }
-
-            return found;
-        }
+        void     addRequest(StandardMem::Request::id_t req) { requests.add(req); }
+        void     removeRequest(StandardMem::Request::id_t req) { requests.remove(req); }
+        bool     containsRequest(StandardMem::Request::id_t req) const { return requests.find(req) >= 0; }
 
         bool    storeAddressOverlaps(const uint64_t loadAddress, const uint64_t loadWidth) const {
             bool overlaps = false;
@@ -192,7 +208,7 @@ class VanadisBasicStorePendingEntry : public VanadisBasicStoreEntry {
         }
 
     protected:
-        std::vector<StandardMem::Request::id_t> requests;
+        VanadisBasicRequestList requests;
         const uint64_t storeAddress;
         const uint64_t storeWidth;
         const uint16_t valueRegister;
@@ -220,41 +236,21 @@ class VanadisBasicLoadPendingEntry : public VanadisBasicLoadEntry {
         VanadisBasicLoadPendingEntry(VanadisLoadInstruction* load_ins, uint64_t address, uint64_t width) :
             VanadisBasicLoadEntry(load_ins), load_address(address), load_width(width) {}
 
-        ~VanadisBasicLoadPendingEntry() {
-            requests.clear();
-        }
-
         void addRequest(StandardMem::Request::id_t req) {
-            requests.push_back(req);
+            requests.add(req);
         }
 
         void addRequest(StandardMem::Request::id_t req, uint32_t sw_thr) {
-            requests.push_back(req);
+            requests.add(req);
             setSWThr(sw_thr);
         }
 
-        bool containsRequest(StandardMem::Request::id_t req) {
-            bool found = false;
-
-            for(auto req_itr = requests.begin(); req_itr != requests.end(); req_itr++) {
-                if( req == (*req_itr) ) {
-                    found = true;
-                    break;
-                }
-            }
-
-            return found;
+        bool containsRequest(StandardMem::Request::id_t req) const {
+            return requests.find(req) >= 0;
         }
 
-
-
         void removeRequest(StandardMem::Request::id_t req) {
-            for(auto req_itr = requests.begin(); req_itr != requests.end(); req_itr++) {
-                if((*req_itr) == req) {
-                    requests.erase(req_itr);
-                    return;
-                }
-            }
+            requests.remove(req);
         }
 
         uint64_t getLoadAddress() const {
@@ -273,19 +269,10 @@ class VanadisBasicLoadPendingEntry : public VanadisBasicLoadEntry {
         // in split-cache line loads we need to restore data into the register
         // in the correct order
         int identifySequence(StandardMem::Request::id_t req) const {
-            int index = -1;
-
-            for(int i = 0; i < requests.size(); ++i) {
-                if(requests[i] == req) {
-                    index = i;
-                    break;
-                }
-            }
-
-            return index;
+            return requests.find(req);
         }
     protected:
-        std::vector<StandardMem::Request::id_t> requests;
+        VanadisBasicRequestList requests;
         // std::vector<uint32_t> request_swthr;
         // std::map<uint32_t, StandardMem::Request::id_t> requests;
 
@@ -57,7 +57,10 @@ struct FreeList {
     bool alloc( uint64_t addr, size_t len ) {
         FreeListDbg("[%#" PRIx64 "-%#" PRIx64 " len=%zu]\n",addr,addr+len, len);
         int ret = false;
-        for ( const auto kv: m_freeList) {
+        // the entries don't overlap, only the one with the highest start at or below addr can hold the range
+        auto iter = m_freeList.upper_bound( addr );
+        if ( iter != m_freeList.begin() ) {
+            const auto kv = *std::prev( iter );
             auto entry = kv.second;
             assert( kv.first == kv.second->start );
             FreeListDbg("checking freeEntry [%#" PRIx64 "-%#" PRIx64 "]\n",entry->start, entry->end);
@@ -87,7 +90,6 @@ struct FreeList {
                     // new free entry starts at the end of the removed region and ends at end of the original free entry
                     m_freeList[addr+len] = new FreeEntry( addr+len, end );
                 }
-                break;
             }
         }
 
@@ -0,0 +1,124 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_NODE_OS_INCLUDE_PAGE_MAP
+#define _H_VANADIS_NODE_OS_INCLUDE_PAGE_MAP
+
+#include <vector>
+#include <string.h>
+#include "os/include/page.h"
+
+namespace SST {
+namespace Vanadis {
+
+namespace OS {
+
+// vpn to Page map for a memory region. The vpn is split into a leaf index and a slot in
+// the leaf, a lookup is two array indexes. Leaves are allocated on first use and the
+// top level only spans the leaves between the lowest and highest vpn that have been mapped.
+class PageMap {
+    enum { LeafBits = 9, LeafSize = 1 << LeafBits, LeafMask = LeafSize - 1 };
+
+    struct Leaf {
+        Leaf() : numPages(0) { memset( pages, 0, sizeof(pages) ); }
+        Page* pages[LeafSize];
+        unsigned numPages;
+    };
+
+  public:
+    PageMap() : m_firstLeaf(0), m_size(0) {}
+
+    PageMap( const PageMap& obj ) : m_firstLeaf( obj.m_firstLeaf ), m_size( obj.m_size ), m_leaves( obj.m_leaves.size(), nullptr ) {
+        for ( size_t i = 0; i < obj.m_leaves.size(); i++ ) {
+            if ( obj.m_leaves[i] ) {
+                m_leaves[i] = new Leaf( *obj.m_leaves[i] );
+            }
+        }
+    }
+
+    PageMap& operator=( const PageMap& ) = delete;
+
+    ~PageMap() {
+        for ( auto leaf : m_leaves ) {
+            delete leaf;
+        }
+    }
+
+    Page* find( unsigned vpn ) const {
+        unsigned index = vpn >> LeafBits;
+        if ( index < m_firstLeaf || index - m_firstLeaf >= m_leaves.size() ) {
+            return nullptr;
+        }
+        Leaf* leaf = m_leaves[ index - m_firstLeaf ];
+        return leaf ? leaf->pages[ vpn & LeafMask ] : nullptr;
+    }
+
+    // returns the page that was replaced, nullptr if the vpn was not mapped
+    Page* insert( unsigned vpn, Page* page ) {
+        Leaf* leaf = getLeaf( vpn >> LeafBits );
+        Page* old = leaf->pages[ vpn & LeafMask ];
+        leaf->pages[ vpn & LeafMask ] = page;
+        if ( nullptr == old ) {
+            ++leaf->numPages;
+            ++m_size;
+        }
+        return old;
+    }
+
+    size_t size() const { return m_size; }
+
+    // calls func( vpn, page ) for every mapped vpn in ascending vpn order
+    template< class Func >
+    void forEach( Func func ) const {
+        for ( size_t i = 0; i < m_leaves.size(); i++ ) {
+            Leaf* leaf = m_leaves[i];
+            if ( nullptr == leaf || 0 == leaf->numPages ) continue;
+            unsigned base = ( m_firstLeaf + i ) << LeafBits;
+            for ( unsigned j = 0; j < LeafSize; j++ ) {
+                if ( leaf->pages[j] ) {
+                    func( base + j, leaf->pages[j] );
+                }
+            }
+        }
+    }
+
+  private:
+    Leaf* getLeaf( unsigned index ) {
+        if ( m_leaves.empty() ) {
+            m_firstLeaf = index;
+        } else if ( index < m_firstLeaf ) {
+            m_leaves.insert( m_leaves.begin(), m_firstLeaf - index, nullptr );
+            m_firstLeaf = index;
+        }
+        size_t pos = index - m_firstLeaf;
+        if ( pos >= m_leaves.size() ) {
+            m_leaves.resize( pos + 1, nullptr );
+        }
+        if ( nullptr == m_leaves[pos] ) {
+            m_leaves[pos] = new Leaf;
+        }
+        return m_leaves[pos];
+    }
+
+    unsigned            m_firstLeaf;
+    size_t              m_size;
+    std::vector<Leaf*>  m_leaves;
+};
+
+}
+}
+}
+
+#endif
@@ -241,7 +241,7 @@ class ProcessInfo {
         }
     }
 
-    void checkpoint( SST::Output* output, std::string checkpointDir ) {
+    void checkpoint( SST::Output* output, std::string checkpointDir, bool compress = false ) {
         std::stringstream filename;
         filename << checkpointDir << "/process-"  << getpid();
 
@@ -260,7 +260,7 @@ class ProcessInfo {
         fprintf(fp,"m_hwThread: %d\n",m_hwThread);
         fprintf(fp,"m_tidAddress: %#" PRIx64 "\n",m_tidAddress);
 
-        m_virtMemMap->checkpoint(fp);
+        m_virtMemMap->checkpoint(fp,compress);
         m_fileTable->checkpoint(fp);
 
         #if 0
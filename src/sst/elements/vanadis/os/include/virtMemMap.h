@@ -23,7 +23,9 @@
 #include "velf/velfinfo.h"
 #include "os/include/freeList.h"
 #include "os/include/page.h"
+#include "os/include/pageMap.h"
 #include "os/include/device.h"
+#include "sst/elements/mmu/ckptBlock.h"
 
 #if 0
 #define VirtMemDbg( format, ... ) printf( "VirtMemMap::%s() " format, __func__, ##__VA_ARGS__ )
@@ -73,21 +75,11 @@ public:
         } else if ( 0 == strcmp( str, "data" ) ) {
             assert ( 1 == fscanf(fp,"dataStartAddr: %" PRIx64 "\n",&dataStartAddr) );
             output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"dataStartAddr: %#" PRIx64 "\n",dataStartAddr );
-            size_t size;
-            assert( 1 == fscanf(fp,"size: %zu\n", &size ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"size: %zu\n", size );
-            data.resize(size);
-            std::stringstream ss;
-            ss << std::hex;
-            for ( auto i = 0; i < size; i++ ) {
-                uint64_t value;
-                assert( 1 == fscanf(fp,"%" PRIx64 ",", &value) );
-                data[i] = value;
-                ss << "0x" << value << ",";
-            }
-            (void) !fscanf(fp,"\n" );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%s\n",ss.str().c_str());
-
+            size_t size = SST::MMU_Lib::readCkptBlock( fp, "data", data );
+            assert( size == data.size() );
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"data: %zu bytes\n", data.size() );
+            int ret = fgetc( fp );
+            assert( '\n' == ret );
         } else {
             assert(0);
         }
@@ -100,7 +92,7 @@ public:
         free(tmp);
     }
 
-    void checkpoint( FILE* fp ) {
+    void checkpoint( FILE* fp, bool compress ) {
         fprintf(fp,"#MemoryBacking start\n");
         if ( elfInfo ) {
             fprintf(fp,"backing: elf\n");
@@ -108,11 +100,7 @@ public:
         } else if ( data.size() ) {
             fprintf(fp,"backing: data\n");
             fprintf(fp,"dataStartAddr: %#" PRIx64 "\n",dataStartAddr);
-            auto ptr = (uint64_t*) data.data();
-            fprintf(fp,"size: %zu\n", data.size()/sizeof(uint64_t) );
-            for ( auto i = 0; i < data.size()/sizeof(uint64_t); i++ ) {
-                fprintf(fp,"%#" PRIx64 ",",ptr[i]);
-            }
+            SST::MMU_Lib::writeCkptBlock( fp, "data", data.size(), data, compress );
             fprintf(fp,"\n");
         } else {
             assert(0);
@@ -130,33 +118,30 @@ struct MemoryRegion {
     }
 
     ~MemoryRegion() {
-        for ( auto kv: m_virtToPhysMap) {
-            auto page = kv.second;
-            // don't delete text pages because they are in the page cache
-            if ( name.compare("text" ) ) {
+        // don't delete text pages because they are in the page cache
+        if ( name.compare("text" ) ) {
+            m_virtToPhysMap.forEach( []( unsigned vpn, OS::Page* page ) {
                 if ( 0 == page->decRefCnt() ) {
                     delete page;
                 }
-            }
+            });
         }
     }
     void incPageRefCnt() {
-        for ( auto kv: m_virtToPhysMap) {
-            kv.second->incRefCnt();
-        }
+        m_virtToPhysMap.forEach( []( unsigned vpn, OS::Page* page ) {
+            page->incRefCnt();
+        });
     }
 
     void mapVirtToPhys( unsigned vpn, OS::Page* page ) {
-        OS::Page* ret = nullptr;
         MemoryRegionDbg("vpn=%d ppn=%d refCnt=%d\n", vpn, page->getPPN(),page->getRefCnt());
-        if( m_virtToPhysMap.find(vpn) != m_virtToPhysMap.end() ) {
-            auto* tmp = m_virtToPhysMap[vpn];
+        auto* tmp = m_virtToPhysMap.insert( vpn, page );
+        if ( tmp ) {
             MemoryRegionDbg("decRef ppn=%d refCnt=%d\n", tmp->getPPN(),tmp->getRefCnt()-1);
             if ( 0 == tmp->decRefCnt() ) {
                 delete tmp;
             }
         }
-        m_virtToPhysMap[ vpn ] = page;
     }
     uint64_t end() { return addr + length; }
 
@@ -181,7 +166,7 @@ struct MemoryRegion {
         return data;
     }
 
-    void checkpoint( FILE* fp ) {
+    void checkpoint( FILE* fp, bool compress ) {
         fprintf(fp,"#MemoryRegion start\n");
         fprintf(fp,"name: %s\n",name.c_str());
         fprintf(fp,"addr: %#" PRIx64 "\n",addr);
@@ -189,16 +174,21 @@ struct MemoryRegion {
         fprintf(fp,"perms: %#" PRIx32 "\n",perms);
         if ( backing ) {
             fprintf(fp,"backing: yes\n");
-            backing->checkpoint( fp );
+            backing->checkpoint( fp, compress );
         } else {
             fprintf(fp,"backing: no\n");
         }
 
-        fprintf(fp,"m_virtToPhysMap.size() %zu\n",m_virtToPhysMap.size());
-        for ( auto & x : m_virtToPhysMap ) {
-            fprintf(fp,"vpn: %d, %s\n", x.first, x.second->checkpoint().c_str() );
-        }
-        fprintf(fp,"#MemoryRegion end\n");
+        // only the pages that have been touched are in the map
+        SST::MMU_Lib::CkptPacker pages;
+        pages.reserve( m_virtToPhysMap.size() * 3 * sizeof(uint32_t) );
+        m_virtToPhysMap.forEach( [&]( unsigned vpn, OS::Page* page ) {
+            pages.pack<uint32_t>( vpn );
+            pages.pack<uint32_t>( page->getPPN() );
+            pages.pack<uint32_t>( page->getRefCnt() );
+        });
+        SST::MMU_Lib::writeCkptBlock( fp, "m_virtToPhysMap", m_virtToPhysMap.size(), pages, compress );
+        fprintf(fp,"\n#MemoryRegion end\n");
     }
 
     MemoryRegion( SST::Output* output, FILE* fp, PhysMemManager* memManager, VanadisELFInfo* elfInfo ) : backing(nullptr) {
@@ -229,16 +219,21 @@ struct MemoryRegion {
             backing = new MemoryBacking( output, fp, elfInfo );
         }
 
-        size_t size;
-        assert( 1 == fscanf(fp,"m_virtToPhysMap.size() %zu\n",&size) );
+        std::vector<uint8_t> bytes;
+        size_t size = SST::MMU_Lib::readCkptBlock( fp, "m_virtToPhysMap", bytes );
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_virtToPhysMap.size() %zu\n",size);
 
-        for ( auto i = 0; i < size; i++ ) {
-            int vpn,ppn,refCnt;
-            assert( 3 == fscanf(fp,"vpn: %d, ppn: %d, refCnt: %d\n", &vpn, &ppn, &refCnt ) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"vpn: %d, ppn: %d, refCnt: %d\n", vpn, ppn, refCnt );
-            m_virtToPhysMap[vpn] = new OS::Page( memManager, ppn, refCnt );
+        SST::MMU_Lib::CkptUnpacker pages( bytes );
+        for ( size_t i = 0; i < size; i++ ) {
+            uint32_t vpn = pages.unpack<uint32_t>();
+            uint32_t ppn = pages.unpack<uint32_t>();
+            uint32_t refCnt = pages.unpack<uint32_t>();
+            output->verbose(CALL_INFO, 1, VANADIS_DBG_CHECKPOINT,"vpn: %d, ppn: %d, refCnt: %d\n", vpn, ppn, refCnt );
+            m_virtToPhysMap.insert( vpn, new OS::Page( memManager, ppn, refCnt ) );
         }
+        assert( pages.done() );
+        int ret = fgetc( fp );
+        assert( '\n' == ret );
 
         tmp = nullptr;
         num = 0;
@@ -250,24 +245,24 @@ struct MemoryRegion {
 
     MemoryBacking* backing;
     OS::Page* getPage( int vpn ) {
-        auto iter = m_virtToPhysMap.find( vpn );
-        assert( iter != m_virtToPhysMap.end() );
-        return iter->second;
+        auto page = m_virtToPhysMap.find( vpn );
+        assert( page );
+        return page;
     }
 
   private:
-    std::map<unsigned, OS::Page* > m_virtToPhysMap;
+    OS::PageMap m_virtToPhysMap;
 };
 
 
 class VirtMemMap {
 
 public:
-    VirtMemMap() : m_refCnt(1) {
+    VirtMemMap() : m_refCnt(1), m_lastRegion(nullptr) {
         m_freeList = new FreeList( 0x1000, 0x80000000);
     }
 
-    VirtMemMap( const VirtMemMap& obj ) : m_refCnt(1) {
+    VirtMemMap( const VirtMemMap& obj ) : m_refCnt(1), m_lastRegion(nullptr) {
         for ( const auto& kv: obj.m_regionMap) {
             m_regionMap[kv.first] = new MemoryRegion( *kv.second );
             if ( kv.second == obj.m_heapRegion ) {
@@ -312,20 +307,30 @@ public:
         m_freeList->free( region->addr, region->length );
 
         m_regionMap.erase( region->addr );
+        if ( region == m_lastRegion ) {
+            m_lastRegion = nullptr;
+        }
 
         delete region;
     }
 
+    // Regions don't overlap so the only candidate is the region with the highest start
+    // address at or below addr. Faults tend to hit the same region so check the last one first.
     MemoryRegion* findRegion( uint64_t addr ) {
         VirtMemDbg("addr=%#" PRIx64 "\n", addr );
-        auto iter = m_regionMap.begin();
-        for ( ; iter != m_regionMap.end(); ++iter ) {
-            auto region = iter->second;
-            VirtMemDbg("region %s [%#" PRIx64 " - %#" PRIx64 "] length=%zu perms=%#x\n",
-                    region->name.c_str(),region->addr,region->addr+region->length, region->length,region->perms);
-            if ( addr >= region->addr && addr < (unsigned) (region->addr + region->length ) ) {
-                return region;
-            }
+        if ( m_lastRegion && addr >= m_lastRegion->addr && addr < m_lastRegion->end() ) {
+            return m_lastRegion;
+        }
+        auto iter = m_regionMap.upper_bound( addr );
+        if ( iter == m_regionMap.begin() ) {
+            return nullptr;
+        }
+        auto region = std::prev( iter )->second;
+        VirtMemDbg("region %s [%#" PRIx64 " - %#" PRIx64 "] length=%zu perms=%#x\n",
+                region->name.c_str(),region->addr,region->addr+region->length, region->length,region->perms);
+        if ( addr < region->end() ) {
+            m_lastRegion = region;
+            return region;
         }
         return nullptr;
     }
@@ -460,7 +465,7 @@ public:
         return true;
     }
 
-    void checkpoint( FILE* fp ) {
+    void checkpoint( FILE* fp, bool compress ) {
         fprintf(fp,"#VirtMemMap start\n");
         fprintf(fp,"m_brk: %#" PRIx64 "\n",m_brk);
         fprintf(fp,"m_refCnt: %d\n",m_refCnt);
@@ -468,12 +473,12 @@ public:
 
         for ( auto & x : m_regionMap ) {
             fprintf(fp,"addr: %#" PRIx64 "\n",x.first);
-            x.second->checkpoint(fp);
+            x.second->checkpoint(fp,compress);
         }
         fprintf(fp,"#VirtMemMap end\n");
     }
 
-    VirtMemMap( SST::Output* output, FILE* fp, PhysMemManager* memManager, VanadisELFInfo* elfInfo) {
+    VirtMemMap( SST::Output* output, FILE* fp, PhysMemManager* memManager, VanadisELFInfo* elfInfo) : m_lastRegion(nullptr) {
         char* str = nullptr;
         size_t num = 0;
         (void) !getline( &str, &num, fp );
@@ -515,6 +520,7 @@ private:
     MemoryRegion*   m_heapRegion;
     FreeList*       m_freeList;
     int             m_refCnt;
+    MemoryRegion*   m_lastRegion;
 };
 
 }
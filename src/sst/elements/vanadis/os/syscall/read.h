@@ -23,6 +23,9 @@ namespace SST {
 namespace Vanadis {
 
 class VanadisReadSyscall : public VanadisSyscall {
+    // the file is read in chunks of up to this many bytes, each chunk is written to memory with as many
+    // requests in flight as the OS allows
+    enum { MaxChunk = 1024 * 1024 };
 public:
     VanadisReadSyscall( VanadisNodeOSComponent* os, SST::Link* coreLink, OS::ProcessInfo* process, VanadisSyscallReadEvent* event  )
         : VanadisSyscall( os, coreLink, process, event, "read" ), m_numRead(0), m_eof(false)
@@ -41,13 +44,15 @@ public:
         } else if (event->getBufferCount() == 0) {
             setReturnSuccess(0);
         } else {
-            // get the length of the first memory access, it cannot span a cacheline
-            uint64_t length = vanadis_line_remainder(event->getBufferAddress(),64);
-            length = event->getBufferCount() < length ? event->getBufferCount() : length;
-            readChunk( length );
+            readChunk( calcChunkLength() );
         }
     }
 
+    size_t calcChunkLength() {
+        size_t length = getEvent<VanadisSyscallReadEvent*>()->getBufferCount() - m_numRead;
+        return length > MaxChunk ? (size_t) MaxChunk : length;
+    }
+
     void readChunk(size_t length) {
 
         m_data.resize(length);
@@ -71,17 +76,12 @@ public:
         }
     }
 
-    bool handleMemResp( StandardMem::Request* req ) {
-        delete req; // we don't use the request
-
+    void memReqIsDone(bool) {
         if ( m_eof || m_numRead == getEvent<VanadisSyscallReadEvent*>()->getBufferCount() ) {
             setReturnSuccess( m_numRead );
         } else {
-            size_t length = getEvent<VanadisSyscallReadEvent*>()->getBufferCount() - m_numRead;
-            if ( length > 64 ) { length = 64; }
-            readChunk( length );
+            readChunk( calcChunkLength() );
         }
-        return false;
     }
 
  private:
@@ -56,9 +56,10 @@ private:
     class ReadStringHandler : public MemoryHandler {
     public:
         ReadStringHandler( VanadisSyscall* obj, SST::Output* out, uint64_t addr, std::string& str )
-            : MemoryHandler(obj,out), m_addr(addr), m_str(str), m_isDone(false) {}
+            : MemoryHandler(obj,out), m_addr(addr), m_str(str), m_isDone(false), m_outstanding(false) {}
 
         void handle(StandardMem::ReadResp* req ) override {
+            m_outstanding = false;
             for (size_t i = 0; i < req->size; ++i) {
                 m_str.push_back(req->data[i]);
 
@@ -70,6 +71,10 @@ private:
         }
 
         StandardMem::Request* generateMemReq() override {
+            // we don't know where the string ends so there is only one read in flight
+            if ( m_outstanding || m_isDone ) {
+                return nullptr;
+            }
             uint64_t length;
             if ( m_str.empty() ) {
 
@@ -87,6 +92,7 @@ private:
                 return nullptr;
             } else {
 
+                m_outstanding = true;
                 return new StandardMem::Read( physAddr, length);
             }
         }
@@ -96,23 +102,31 @@ private:
     private:
         uint64_t getAddress() { return m_addr + m_str.length(); };
         bool m_isDone;
+        bool m_outstanding;
         std::string& m_str;
         uint64_t m_addr;
     };
 
+    // Splits the buffer into cache line sized requests. m_offset is where the next request starts and
+    // m_numDone is the number of bytes that have completed, the requests can be pipelined, how many are
+    // in flight is up to the OS. Locked accesses are not pipelined.
     class BlockMemoryHandler : public MemoryHandler {
     public:
         BlockMemoryHandler( VanadisSyscall* obj, SST::Output* out, uint64_t addr, std::vector<uint8_t>& data, bool lock )
-            : MemoryHandler(obj,out), m_addr(addr), m_data(data),  m_offset(0), m_lock(lock) {
+            : MemoryHandler(obj,out), m_addr(addr), m_data(data),  m_offset(0), m_numDone(0), m_lock(lock) {
         }
 
         virtual ~BlockMemoryHandler() {}
 
         bool isDone() {
-            return m_offset == m_data.size();
+            return m_numDone == m_data.size();
         }
 
     protected:
+        bool canIssue() {
+            return m_offset < m_data.size() && ! ( m_lock && m_numDone < m_offset );
+        }
+
         size_t calcLength() {
             uint64_t length;
             if ( 0 == m_offset ) {
@@ -127,6 +141,7 @@ private:
         std::vector<uint8_t>& m_data;
         uint64_t m_addr;
         size_t m_offset;
+        size_t m_numDone;
         int m_lock;
     };
 
@@ -136,11 +151,18 @@ private:
             : BlockMemoryHandler(obj,out,addr,data,lock) {}
 
         void handle(StandardMem::ReadResp* req ) override {
-            memcpy( m_data.data() + m_offset, req->data.data(), req->size );
-            m_offset += req->size;
+            auto iter = m_reqOffset.find( req->getID() );
+            assert( iter != m_reqOffset.end() );
+            memcpy( m_data.data() + iter->second, req->data.data(), req->size );
+            m_reqOffset.erase( iter );
+            m_numDone += req->size;
         }
         StandardMem::Request* generateMemReq() override {
 
+            if ( ! canIssue() ) {
+                return nullptr;
+            }
+
             auto length = calcLength();
 
             auto virtAddr = getAddress();
@@ -152,20 +174,23 @@ private:
                 return nullptr;
             } else {
 
+                StandardMem::Request* req;
                 if ( m_lock ) {
 
-                    auto req =  new StandardMem::LoadLink( physAddr, length, 0, virtAddr, 0, 0 );
+                    req =  new StandardMem::LoadLink( physAddr, length, 0, virtAddr, 0, 0 );
 
-                    obj->m_output->verbose(CALL_INFO, 16, 0, " %s\n",req->getString().c_str());
-                    return req;
                 } else {
 
-                    auto req =  new StandardMem::Read( physAddr, length, 0, virtAddr, 0, 0 );
-                    obj->m_output->verbose(CALL_INFO, 16, 0, " %s\n",req->getString().c_str());
-                    return req;
+                    req =  new StandardMem::Read( physAddr, length, 0, virtAddr, 0, 0 );
                 }
+                obj->m_output->verbose(CALL_INFO, 16, 0, " %s\n",req->getString().c_str());
+                m_reqOffset[req->getID()] = m_offset;
+                m_offset += length;
+                return req;
             }
         }
+    private:
+        std::unordered_map<StandardMem::Request::id_t,size_t> m_reqOffset;
     };
 
     class WriteMemoryHandler : public BlockMemoryHandler {
@@ -174,21 +199,24 @@ private:
             : BlockMemoryHandler(obj,out,addr,data,lock), process( process ) {}
 
         void handle(StandardMem::WriteResp* req ) override {
-            m_offset += req->size;
+            m_numDone += req->size;
         }
 
         StandardMem::Request* generateMemReq() override {
 
-            uint64_t length = calcLength();
+            if ( ! canIssue() ) {
+                return nullptr;
+            }
 
-            std::vector<uint8_t> payload( length );
-            memcpy( payload.data(), m_data.data() + m_offset, length );
+            uint64_t length = calcLength();
 
             auto physAddr = obj->virtToPhys( getAddress(), true, process );
 
             if ( -1 == physAddr ) {
                 return nullptr;
             } else {
+                std::vector<uint8_t> payload( m_data.begin() + m_offset, m_data.begin() + m_offset + length );
+                m_offset += length;
                 if ( m_lock ) {
                     return new StandardMem::StoreConditional( physAddr, payload.size(), payload, 0);
                 } else {
@@ -240,9 +268,11 @@ private:
         return physAddr;
     }
 
+    // returns nullptr if the handler has nothing more to issue right now or if the next request caused a page fault
     StandardMem::Request* getMemoryRequest() {
         m_output->verbose(CALL_INFO, 16, 0,"\n");
         StandardMem::Request* req = nullptr;
+        m_pageFaultAddr = 0;
         if ( m_memHandler ) {
 
             req = m_memHandler->generateMemReq();
@@ -258,6 +288,8 @@ private:
         return req;
     }
 
+    size_t numPendingMem() { return m_pendingMem.size(); }
+
     bool causedPageFault() {
         return (m_pageFaultAddr);
     }
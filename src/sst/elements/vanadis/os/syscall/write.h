@@ -23,6 +23,8 @@ namespace SST {
 namespace Vanadis {
 
 class VanadisWriteSyscall : public VanadisSyscall {
+    // the buffer is read from memory in chunks of up to this many bytes
+    enum { MaxChunk = 1024 * 1024 };
 public:
     VanadisWriteSyscall( VanadisNodeOSComponent* os, SST::Link* coreLink, OS::ProcessInfo* process, VanadisSyscallWriteEvent* event )
         : VanadisSyscall( os, coreLink, process, event, "write" ), m_numWritten(0)
@@ -41,14 +43,16 @@ public:
         } else if (event->getBufferCount() == 0) {
             setReturnSuccess(0);
         } else {
+            readChunk();
+        }
+    }
 
-            // get the length of the first memory access, it cannot span a cacheline
-            uint64_t length = vanadis_line_remainder(event->getBufferAddress(),64);
-            length = event->getBufferCount() < length ? event->getBufferCount() : length;
+    void readChunk() {
+        size_t length = getEvent<VanadisSyscallWriteEvent*>()->getBufferCount() - m_numWritten;
+        if ( length > MaxChunk ) { length = MaxChunk; }
 
-            m_data.resize( length );
-            readMemory( event->getBufferAddress(), m_data );
-        }
+        m_data.resize(length);
+        readMemory( getEvent<VanadisSyscallWriteEvent*>()->getBufferAddress() + m_numWritten, m_data );
     }
 
     void memReqIsDone(bool) {
@@ -60,11 +64,7 @@ public:
         if ( m_numWritten == getEvent<VanadisSyscallWriteEvent*>()->getBufferCount() ) {
             setReturnSuccess( m_numWritten );
         } else {
-            size_t length = getEvent<VanadisSyscallWriteEvent*>()->getBufferCount() - m_numWritten;
-            if ( length > 64 ) { length = 64; }
-
-            m_data.resize(length);
-            readMemory( getEvent<VanadisSyscallWriteEvent*>()->getBufferAddress() + m_numWritten, m_data );
+            readChunk();
         }
     }
 
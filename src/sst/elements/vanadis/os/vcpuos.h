@@ -32,6 +32,7 @@
 #include "os/callev/voscallall.h"
 #include "os/vstartthreadreq.h"
 #include "os/resp/voscallresp.h"
+#include "vinstrace.h"
 
 namespace SST {
 namespace Vanadis {
@@ -50,6 +51,7 @@ public:
         regFile = nullptr;
         isaTable = nullptr;
         tls_address = nullptr;
+        traceRecord = nullptr;
 
         hw_thr = 0;
         core_id = 0;
@@ -71,9 +73,15 @@ public:
         os_link = link;
     }
 
+    // set while a syscall is handled when the core records an instruction trace
+    void setTraceRecord( VanadisTraceRecord* rec ) { traceRecord = rec; }
+
 protected:
 
     void sendSyscallEvent( VanadisSyscallEvent* ev ) {
+        if ( nullptr != traceRecord ) {
+            recordTraceSyscall( ev );
+        }
         os_link->send( ev );
     }
 
@@ -91,7 +99,39 @@ protected:
     uint64_t* tls_address;
 
 private:
+    // the replay does no functional work, so only the syscalls that change the address space are
+    // recorded, a file or device mapping needs the file and is left out
+    void recordTraceSyscall( VanadisSyscallEvent* ev ) {
+        switch ( ev->getOperation() ) {
+        case SYSCALL_OP_BRK:
+            traceRecord->sub_type = SYSCALL_OP_BRK;
+            traceRecord->mem_addr = static_cast<VanadisSyscallBRKEvent*>(ev)->getUpdatedBRK();
+            break;
+        case SYSCALL_OP_MMAP:
+        {
+            VanadisSyscallMemoryMapEvent* map_ev = static_cast<VanadisSyscallMemoryMapEvent*>(ev);
+            if ( map_ev->getAllocationFlags() & MAP_ANONYMOUS ) {
+                traceRecord->sub_type  = SYSCALL_OP_MMAP;
+                traceRecord->mem_addr  = map_ev->getAllocationAddress();
+                traceRecord->next_addr = map_ev->getAllocationLength();
+                traceRecord->mem_width = map_ev->getProtectionFlags();
+                traceRecord->map_flags = map_ev->getAllocationFlags();
+            }
+        } break;
+        case SYSCALL_OP_UNMAP:
+        {
+            VanadisSyscallMemoryUnMapEvent* unmap_ev = static_cast<VanadisSyscallMemoryUnMapEvent*>(ev);
+            traceRecord->sub_type  = SYSCALL_OP_UNMAP;
+            traceRecord->mem_addr  = unmap_ev->getDeallocationAddress();
+            traceRecord->next_addr = unmap_ev->getDeallocationLength();
+        } break;
+        default:
+            break;
+        }
+    }
+
     SST::Link* os_link;
+    VanadisTraceRecord* traceRecord;
 };
 
 } // namespace Vanadis
@@ -18,6 +18,7 @@
 #include <sst/core/component.h>
 
 #include <functional>
+#include <chrono>
 
 #include "vanadisDbgFlags.h"
 
@@ -62,6 +63,7 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
     } else {
         m_checkpoint = NO_CHECKPOINT;
     }
+    m_checkpointCompress = params.find<bool>("checkpointCompress", false);
     m_coreCount = params.find<uint32_t>("cores", 0);
     m_hardwareThreadCount = params.find<uint32_t>("hardwareThreadCount", 1);
     m_numLogicalCores = m_coreCount * m_hardwareThreadCount;
@@ -76,6 +78,12 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
         }
     }
 
+    m_syscallMaxOutstanding = params.find<uint32_t>("syscall_max_outstanding", 1);
+    m_pageXferMaxOutstanding = params.find<uint32_t>("page_xfer_max_outstanding", 6);
+    if ( 0 == m_syscallMaxOutstanding || 0 == m_pageXferMaxOutstanding ) {
+        output->fatal(CALL_INFO, -1, "Error: syscall_max_outstanding and page_xfer_max_outstanding must be at least 1\n");
+    }
+
     m_osStartTimeNano = params.find<uint64_t>("osStartTimeNano",1000000000);
     m_processDebugLevel = params.find<uint32_t>("processDebugLevel",0);
     m_phdr_address = params.find<uint64_t>("program_header_address", 0x60000000);
@@ -113,6 +121,15 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
         // we don't use it
     }
 
+    m_functionalInitIO = params.find<bool>("functional_init_io", false);
+    if ( m_functionalInitIO && nullptr == m_mmu ) {
+        output->fatal(CALL_INFO, -1, "Error: functional_init_io requires useMMU\n");
+    }
+    if ( CHECKPOINT_LOAD == m_checkpoint ) {
+        // the pages of the processes are restored from the checkpoint
+        m_functionalInitIO = false;
+    }
+
     m_nodeNum = params.find<int>("node_id", -1);
 
     m_coreInfoMap.resize( m_coreCount, m_hardwareThreadCount );
@@ -220,6 +237,12 @@ VanadisNodeOSComponent::init(unsigned int phase) {
         m_mmu->init(phase);
     }
 
+    if ( 0 == phase && m_functionalInitIO ) {
+        for ( const auto kv : m_threadMap ) {
+            preloadElfPages( kv.second );
+        }
+    }
+
     // do we need to check for this, really?
     for (Link* next_link : core_links) {
         while (SST::Event* ev = next_link->recvUntimedData()) {
@@ -263,11 +286,13 @@ VanadisNodeOSComponent::checkpoint( std::string dir )
     filename << dir << "/" << getName();
     output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
+    auto start = std::chrono::steady_clock::now();
+
     auto fp = fopen(filename.str().c_str(),"w+");
     assert(fp);
 
-    m_mmu->checkpoint( dir );
-    m_physMemMgr->checkpoint( output, dir );
+    m_mmu->checkpoint( dir, m_checkpointCompress );
+    m_physMemMgr->checkpoint( output, dir, m_checkpointCompress );
 
     // dump ELF map
     fprintf(fp,"m_elfMap.size() %zu\n",m_elfMap.size());
@@ -282,7 +307,7 @@ VanadisNodeOSComponent::checkpoint( std::string dir )
         assert( 100 == x.second->getpid() );
         fprintf(fp,"thread: %d, pid: %d %s\n",x.first,x.second->getpid(), x.second->getElfInfo()->getBinaryPath());
         if ( x.second->getpid() == x.second->gettid() ) {
-            x.second->checkpoint( output, dir );
+            x.second->checkpoint( output, dir, m_checkpointCompress );
         }
     }
 
@@ -321,6 +346,9 @@ VanadisNodeOSComponent::checkpoint( std::string dir )
     assert( m_pendingFault.empty() );
     assert( m_blockMemoryWriteReqQ.empty() );
     assert( m_memRespMap.empty() );
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"checkpoint save took %f seconds\n", elapsed.count());
 }
 
 int VanadisNodeOSComponent::checkpointLoad( std::string dir )
@@ -331,6 +359,8 @@ int VanadisNodeOSComponent::checkpointLoad( std::string dir )
     filename << m_checkpointDir << "/" << getName();
     output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
+    auto start = std::chrono::steady_clock::now();
+
     auto fp = fopen(filename.str().c_str(),"r");
     assert(fp);
 
@@ -478,6 +508,9 @@ int VanadisNodeOSComponent::checkpointLoad( std::string dir )
     assert( 1 == fscanf(fp,"m_currentTid: %d\n",&m_currentTid) );
     output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_currentTid: %d\n",m_currentTid);
 
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"checkpoint load took %f seconds\n", elapsed.count());
+
 //    exit(0);
     return m_threadMap.size();
 }
@@ -530,7 +563,10 @@ VanadisNodeOSComponent::startProcess( OS::HwThreadID& threadID, OS::ProcessInfo*
     int pid = process->getpid();
 
     if ( m_mmu ) {
-        m_mmu->initPageTable( pid );
+        // with functional_init_io the page table was created when the ELF pages were loaded
+        if ( ! m_functionalInitIO ) {
+            m_mmu->initPageTable( pid );
+        }
         m_mmu->setCoreToPageTable( threadID.core, threadID.hwThread, pid );
     }
 
@@ -593,6 +629,62 @@ void VanadisNodeOSComponent::writeMem( OS::ProcessInfo* process, uint64_t virtAd
     writePage( page->getPPN() << m_pageShift, tmp, m_pageSize, callback );
 }
 
+// Maps and loads every page of the process's ELF segments with untimed writes so the process does not
+// take a page fault, and the memory traffic that goes with it, the first time it touches them. This
+// follows what pageFault() does for an ELF backed region, text pages are shared through the page cache.
+void VanadisNodeOSComponent::preloadElfPages( OS::ProcessInfo* process )
+{
+    int pid = process->getpid();
+    VanadisELFInfo* elfInfo = process->getElfInfo();
+
+    m_mmu->initPageTable( pid );
+
+    for ( size_t i = 0; i < elfInfo->countProgramHeaders(); ++i ) {
+        const VanadisELFProgramHeaderEntry* hdr = elfInfo->getProgramHeader(i);
+        if ( PROG_HEADER_LOAD != hdr->getHeaderType() ) {
+            continue;
+        }
+
+        uint32_t startVpn = hdr->getVirtualMemoryStart() >> m_pageShift;
+        uint32_t endVpn = ( hdr->getVirtualMemoryStart() + hdr->getHeaderMemoryLength() + m_pageSize - 1 ) >> m_pageShift;
+
+        for ( uint32_t vpn = startVpn; vpn < endVpn; vpn++ ) {
+            // segments can share a page
+            if ( m_mmu->getPerms( pid, vpn ) != -1 ) {
+                continue;
+            }
+
+            auto region = process->findMemRegion( ( (uint64_t) vpn << m_pageShift ) + 1 );
+            assert( region && region->backing && region->backing->elfInfo );
+            bool isText = 0 == region->name.compare("text");
+
+            OS::Page* page = isText ? checkPageCache( elfInfo, vpn ) : nullptr;
+            if ( page ) {
+                page->incRefCnt();
+            } else {
+                try {
+                    page = allocPage( );
+                } catch ( int err ) {
+                    output->fatal(CALL_INFO, -1, "Error: ran out of physical memory\n");
+                }
+                process->mapVirtToPage( vpn, page );
+
+                uint8_t* data = readElfPage( output, elfInfo, vpn, m_pageSize );
+                std::vector<uint8_t> buffer( data, data + m_pageSize );
+                delete[] data;
+                mem_if->sendUntimedData( new StandardMem::Write( (uint64_t) page->getPPN() << m_pageShift, buffer.size(), buffer ) );
+
+                if ( isText ) {
+                    updatePageCache( elfInfo, vpn, page );
+                }
+            }
+
+            output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"pid=%d vpn=%d -> ppn=%d\n", pid, vpn, page->getPPN());
+            m_mmu->map( pid, vpn, page->getPPN(), m_pageSize, region->perms );
+        }
+    }
+}
+
 void
 VanadisNodeOSComponent::handleIncomingSyscallEvent(SST::Event* ev) {
     VanadisSyscallEvent* sys_ev = dynamic_cast<VanadisSyscallEvent*>(ev);
@@ -666,18 +758,33 @@ void VanadisNodeOSComponent::processSyscallPost( VanadisSyscall* syscall ) {
 
     } else {
         output->verbose(CALL_INFO, 16, 0,"syscall '%s' for core %d get memory reqeust\n",syscall->getName().c_str(),core);
+        issueSyscallMemReqs( syscall );
+    }
+}
+
+void VanadisNodeOSComponent::issueSyscallMemReqs( VanadisSyscall* syscall ) {
+
+    auto core = syscall->getCoreId();
+
+    // keep up to m_syscallMaxOutstanding requests in flight, a page fault is only handled once
+    // the requests ahead of it have drained, their responses will get us back here
+    while ( syscall->numPendingMem() < m_syscallMaxOutstanding ) {
         auto ev = syscall->getMemoryRequest();
 
         if ( ev ) {
             output->verbose(CALL_INFO, 16, 0,"syscall '%s' for core %d has a memory request\n",syscall->getName().c_str(),core);
             sendMemoryEvent(syscall, ev );
         } else if ( syscall->causedPageFault() ) {
-            uint64_t virtAddr;
-            bool isWrite;
-            std::tie( virtAddr, isWrite) = syscall->getPageFault();
-            processOsPageFault( syscall, virtAddr, isWrite );
+            if ( 0 == syscall->numPendingMem() ) {
+                uint64_t virtAddr;
+                bool isWrite;
+                std::tie( virtAddr, isWrite) = syscall->getPageFault();
+                processOsPageFault( syscall, virtAddr, isWrite );
+            }
+            break;
         } else {
             output->verbose(CALL_INFO, 16, 0,"syscall '%s' for core %d is blocked\n",syscall->getName().c_str(),core);
+            break;
         }
     }
 }
@@ -712,9 +819,9 @@ void VanadisNodeOSComponent::pageFaultFini( PageFault* info, bool success )
                 info->link,info->pid,info->vpn, info->vpn << m_pageShift, success ? "success":"fault" );
 
     if( info->syscall ) {
-        auto ev = info->syscall->getMemoryRequest();
-        assert(ev);
-        sendMemoryEvent(info->syscall, ev );
+        assert( 0 == info->syscall->numPendingMem() );
+        issueSyscallMemReqs( info->syscall );
+        assert( info->syscall->numPendingMem() );
     } else {
         m_mmu->faultHandled( info->reqId, info->link, info->pid, info->vpn, success );
     }
@@ -57,6 +57,10 @@ public:
                             { "physMemSize", "Size of available physical memory in bytes, with units. Ex: 2GiB", NULL },
                             { "page_size", "Size of a page, in bytes", "4096" },
                             { "useMMU", "Whether an MMU subcomponent is being used.", "False" },
+                            { "syscall_max_outstanding", "Maximum number of memory requests a syscall can have in flight when copying data to or from the application", "1" },
+                            { "page_xfer_max_outstanding", "Maximum number of memory requests in flight when the OS reads or writes a page", "6" },
+                            { "functional_init_io", "Load the ELF pages of the initial processes into memory during init, taking no simulated time, instead of on first touch. Requires useMMU", "False" },
+                            { "checkpointCompress", "Compress the page tables and page maps of a checkpoint, ignored if libz is not available", "False" },
                             { "process%(processnum)d.env_count", "Number of environment variables to pass to the process", "0"},
                             { "process%(processnum)d.env%(argnum)d", "Environment variable to pass to the process. Example: 'OMPNUMTHREADS=64'. 'argnum' should be contiguous starting at 0 and ending at env_count-1", ""},
                             { "proccess%(processnum)d.exe", "Name of executable, including path", NULL},
@@ -152,6 +156,7 @@ private:
     void handleIncomingSyscallEvent(SST::Event* ev);
     VanadisSyscall* handleIncomingSyscall( OS::ProcessInfo*, VanadisSyscallEvent*, SST::Link* core_link );
     void processSyscallPost( VanadisSyscall* syscall );
+    void issueSyscallMemReqs( VanadisSyscall* syscall );
 
     void handleIncomingMemoryCallback(StandardMem::Request* ev);
 
@@ -197,9 +202,8 @@ private:
 
     void startBlockXfer( PageMemReq* req ) {
         // this specfies how many requests should be initially sent before waiting for a response
-        // this value was choose because hight does not increase performance, for the configuration used to test
-        unsigned startWithNum = 6;
-        for ( int i = 0; i < startWithNum; i++ ) {
+        // the default of 6 was chosen because higher did not increase performance, for the configuration used to test
+        for ( int i = 0; i < m_pageXferMaxOutstanding; i++ ) {
             req->sendReq();
         }
     }
@@ -228,6 +232,8 @@ private:
         m_elfPageCache[elf_info][vpn] = page;
     }
 
+    void preloadElfPages( OS::ProcessInfo* );
+
     void writeMem( OS::ProcessInfo*, uint64_t virtAddr, std::vector<uint8_t>* data, int perms, unsigned pageSize, Callback* callback );
 
     template<typename T>
@@ -381,6 +387,9 @@ private:
     uint32_t                    m_coreCount;
     uint32_t                    m_hardwareThreadCount;
     uint32_t                    m_numLogicalCores;
+    uint32_t                    m_syscallMaxOutstanding;
+    uint32_t                    m_pageXferMaxOutstanding;
+    bool                        m_functionalInitIO;
 
     std::queue<PageFault*>                          m_pendingFault;
     std::map<std::string, VanadisELFInfo* >         m_elfMap;
@@ -404,6 +413,7 @@ private:
 
     std::string m_checkpointDir;
     enum { NO_CHECKPOINT, CHECKPOINT_LOAD, CHECKPOINT_SAVE }  m_checkpoint;
+    bool m_checkpointCompress;
 
     void checkpoint( std::string dir );
     int checkpointLoad( std::string dir );
@@ -26,6 +26,7 @@
 
 #include "output.h"
 #include "vanadisDbgFlags.h"
+#include "sst/elements/mmu/ckptBlock.h"
 
 #define FOUR_KB 4096
 #define TWO_MB ( 1024*1024*2)
@@ -70,30 +71,38 @@ class PhysMemManager {
             assert(0);
         }
 
-        void checkpoint( FILE* fp ) {
+        // only the words with allocated pages are saved
+        void checkpoint( FILE* fp, bool compress ) {
             fprintf(fp,"BitMap size: %zu\n",m_bitMap.size());
+            SST::MMU_Lib::CkptPacker words;
+            size_t numWords = 0;
             for ( auto i = 0; i < m_bitMap.size(); i++ ) {
                 if ( m_bitMap[i] ) {
-                    fprintf(fp,"%d %#018" PRIx64 "\n",i,m_bitMap[i]);
+                    words.pack<uint64_t>( i );
+                    words.pack<uint64_t>( m_bitMap[i] );
+                    ++numWords;
                 }
             }
+            SST::MMU_Lib::writeCkptBlock( fp, "words", numWords, words, compress );
         }
 
         void checkpointLoad( SST::Output* output, FILE* fp ) {
-            int size;
-            assert( 1 == fscanf(fp,"BitMap size: %d\n",&size) );
-            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"BitMap size: %d\n",size);
+            size_t size;
+            assert( 1 == fscanf(fp,"BitMap size: %zu\n",&size) );
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"BitMap size: %zu\n",size);
             m_bitMap.resize(size,0);
-            int index;
-            uint64_t value;
-            while ( 2 == fscanf( fp, "%d %" PRIx64 "\n", &index, &value ) ) {
-                output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%d %#018" PRIx64 "\n",index,value);
-                m_bitMap[index] = value;
+            std::vector<uint8_t> bytes;
+            size_t numWords = SST::MMU_Lib::readCkptBlock( fp, "words", bytes );
+            output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"words: %zu\n",numWords);
+            SST::MMU_Lib::CkptUnpacker words( bytes );
+            for ( size_t i = 0; i < numWords; i++ ) {
+                uint64_t index = words.unpack<uint64_t>();
+                assert( index < size );
+                m_bitMap[index] = words.unpack<uint64_t>();
             }
+            assert( words.done() );
         }
 
-      private:
-
       private:
         std::vector<uint64_t> m_bitMap;
     };
@@ -138,7 +147,7 @@ class PhysMemManager {
         }
     }
 
-    void checkpoint( SST::Output* output, std::string dir ) {
+    void checkpoint( SST::Output* output, std::string dir, bool compress = false ) {
         std::stringstream filename;
         filename << dir << "/" << "PhysMemManager";
         auto fp = fopen(filename.str().c_str(),"w+");
@@ -146,7 +155,8 @@ class PhysMemManager {
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"PhysMemManager %s\n", filename.str().c_str());
 
         fprintf(fp,"m_numAllocated %" PRIu64 "\n",m_numAllocated);
-        m_bitMap.checkpoint(fp);
+        m_bitMap.checkpoint(fp,compress);
+        fclose(fp);
     }
     void checkpointLoad( SST::Output* output , std::string dir ) {
         std::stringstream filename;
@@ -157,6 +167,7 @@ class PhysMemManager {
         assert( 1 == fscanf(fp,"m_numAllocated %" SCNu64 "\n",&m_numAllocated) );
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_numAllocated %" PRIu64 "\n",m_numAllocated);
         m_bitMap.checkpointLoad(output,fp);
+        fclose(fp);
     }
 
   private:
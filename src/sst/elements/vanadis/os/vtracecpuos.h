@@ -0,0 +1,101 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_TRACE_CPU_OS
+#define _H_VANADIS_TRACE_CPU_OS
+
+#include "inst/vtraceinst.h"
+#include "os/callev/voscallbrk.h"
+#include "os/callev/voscallexitgrp.h"
+#include "os/callev/voscallmmap.h"
+#include "os/callev/voscallunmap.h"
+#include "os/vcpuos.h"
+
+namespace SST {
+namespace Vanadis {
+
+// SYSCALL handling for a replayed trace. The effects of the syscalls are already in the trace so
+// they complete as soon as they reach the front of the ROB. The brk, mmap and munmap calls go to
+// the OS again so the replayed heap addresses have pages, and the last one goes to the OS to end
+// the thread.
+class VanadisTraceOSHandler : public VanadisCPUOSHandler {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisTraceOSHandler,
+                                  "vanadis",
+                                  "VanadisTraceOSHandler",
+                                  SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                  "Provides SYSCALL handling for the VanadisTraceDecoder",
+                                  SST::Vanadis::VanadisCPUOSHandler)
+
+    SST_ELI_DOCUMENT_PARAMS({ "verbose", "Set the verbosity of output for the handler", "0" })
+
+    VanadisTraceOSHandler(ComponentId_t id, Params& params) : VanadisCPUOSHandler(id, params) {}
+
+    std::tuple<bool,bool> handleSysCall(VanadisSysCallInstruction* syscallIns) override {
+        VanadisTraceSysCallInstruction* trace_ins = dynamic_cast<VanadisTraceSysCallInstruction*>(syscallIns);
+
+        if ( nullptr != trace_ins && trace_ins->exitsThread() ) {
+            output->verbose(CALL_INFO, 16, 0, "core=%d hw_thr=%d end of trace at syscall-ins: %#" PRIx64 ", exit thread\n",
+                core_id, syscallIns->getHWThread(), syscallIns->getInstructionAddress());
+
+            // the exit code is the only argument and it does not touch memory so the bit type does not matter
+            sendSyscallEvent(new VanadisSyscallExitGroupEvent(core_id, syscallIns->getHWThread(), VanadisOSBitType::VANADIS_OS_64B, 0));
+            return std::make_tuple(false, false);
+        }
+
+        if ( nullptr != trace_ins ) {
+            const VanadisTraceRecord& rec = trace_ins->getRecord();
+            VanadisSyscallEvent*      call_ev = nullptr;
+
+            switch ( rec.sub_type ) {
+            case SYSCALL_OP_BRK:
+                call_ev = new VanadisSyscallBRKEvent(core_id, syscallIns->getHWThread(), VanadisOSBitType::VANADIS_OS_64B, rec.mem_addr);
+                break;
+            case SYSCALL_OP_MMAP:
+                call_ev = new VanadisSyscallMemoryMapEvent(core_id, syscallIns->getHWThread(), VanadisOSBitType::VANADIS_OS_64B,
+                    rec.mem_addr, rec.next_addr, rec.mem_width, rec.map_flags, -1, 0, 0, 0);
+                break;
+            case SYSCALL_OP_UNMAP:
+                call_ev = new VanadisSyscallMemoryUnMapEvent(core_id, syscallIns->getHWThread(), VanadisOSBitType::VANADIS_OS_64B,
+                    rec.mem_addr, rec.next_addr);
+                break;
+            default:
+                break;
+            }
+
+            if ( nullptr != call_ev ) {
+                output->verbose(CALL_INFO, 16, 0, "core=%d hw_thr=%d replayed syscall-ins: %#" PRIx64 ", op=%d addr=%#" PRIx64 " len=%" PRIu64 "\n",
+                    core_id, syscallIns->getHWThread(), syscallIns->getInstructionAddress(), rec.sub_type, rec.mem_addr, rec.next_addr);
+
+                sendSyscallEvent(call_ev);
+                return std::make_tuple(false, false);
+            }
+        }
+
+        output->verbose(CALL_INFO, 16, 0, "core=%d hw_thr=%d replayed syscall-ins: %#" PRIx64 "\n",
+            core_id, syscallIns->getHWThread(), syscallIns->getInstructionAddress());
+
+        return std::make_tuple(true, false);
+    }
+
+    void recvSyscallResp( VanadisSyscallResponse* os_resp ) override {
+        delete os_resp;
+    }
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
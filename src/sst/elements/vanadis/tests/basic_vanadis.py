@@ -6,8 +6,9 @@ mh_debug=0
 dbgAddr="0"
 stopDbg="0"
 
-checkpointDir = ""
-checkpoint = ""
+checkpointDir = os.getenv("VANADIS_CHECKPOINT_DIR", "")
+checkpoint = os.getenv("VANADIS_CHECKPOINT", "")
+checkpointCompress = os.getenv("VANADIS_CHECKPOINT_COMPRESS", "0") != "0"
 
 #checkpointDir = "checkpoint0"
 #checkpoint = "load"
@@ -74,8 +75,12 @@ exe_name= full_exe_name.split("/")[-1]
 
 verbosity = int(os.getenv("VANADIS_VERBOSE", 0))
 os_verbosity = os.getenv("VANADIS_OS_VERBOSE", verbosity)
+os_dbg_mask = int(os.getenv("VANADIS_OS_DBG_MASK", 8))
 pipe_trace_file = os.getenv("VANADIS_PIPE_TRACE", "")
+inst_trace_file = os.getenv("VANADIS_INSTRUCTION_TRACE", "")
+replay_trace_file = os.getenv("VANADIS_REPLAY_TRACE", "")
 lsq_ld_entries = os.getenv("VANADIS_LSQ_LD_ENTRIES", 16)
+branch_unit = os.getenv("VANADIS_BRANCH_UNIT", "vanadis.VanadisBasicBranchUnit")
 lsq_st_entries = os.getenv("VANADIS_LSQ_ST_ENTRIES", 8)
 
 rob_slots = os.getenv("VANADIS_ROB_SLOTS", 64)
@@ -128,6 +133,11 @@ else:
 vanadis_decoder = "vanadis.Vanadis" + vanadis_isa + "Decoder"
 vanadis_os_hdlr = "vanadis.Vanadis" + vanadis_isa + "OSHandler"
 
+# replay an instruction trace recorded with VANADIS_INSTRUCTION_TRACE instead of decoding the binary
+if replay_trace_file != "":
+    vanadis_decoder = "vanadis.VanadisTraceDecoder"
+    vanadis_os_hdlr = "vanadis.VanadisTraceOSHandler"
+
 
 protocol="MESI"
 
@@ -135,7 +145,7 @@ protocol="MESI"
 osParams = {
     "processDebugLevel" : 0,
     "dbgLevel" : os_verbosity,
-    "dbgMask" : 8,
+    "dbgMask" : os_dbg_mask,
     "cores" : numCpus,
     "hardwareThreadCount" : numThreads,
     "page_size"  : 4096,
@@ -145,6 +155,16 @@ osParams = {
     "checkpoint" : checkpoint
 }
 
+syscall_max_outstanding = os.getenv("VANADIS_OS_SYSCALL_MAX_OUTSTANDING", "")
+if syscall_max_outstanding != "":
+    osParams["syscall_max_outstanding"] = syscall_max_outstanding
+
+if os.getenv("VANADIS_OS_FUNCTIONAL_INIT_IO", "0") != "0":
+    osParams["functional_init_io"] = True
+
+if checkpointCompress:
+    osParams["checkpointCompress"] = True
+
 processList = (
     ( 1, {
         "env_count" : 1,
@@ -244,6 +264,10 @@ branchPredParams = {
     "branch_entries" : 32
 }
 
+# the TAGE and perceptron units size their own tables
+if branch_unit != "vanadis.VanadisBasicBranchUnit":
+    branchPredParams = {}
+
 cpuParams = {
     "clock" : cpu_clock,
     "verbose" : verbosity,
@@ -258,6 +282,7 @@ cpuParams = {
     "print_int_reg" : False,
     "print_fp_reg" : False,
     "pipeline_trace_file" : pipe_trace_file,
+    "instruction_trace_file" : inst_trace_file,
     "reorder_slots" : rob_slots,
     "decodes_per_cycle" : decodes_per_cycle,
     "issues_per_cycle" :  issues_per_cycle,
@@ -346,6 +371,8 @@ class CPU_Builder:
         for n in range(numThreads):
             decode     = cpu.setSubComponent( "decoder", vanadis_decoder, n )
             decode.addParams( decoderParams )
+            if replay_trace_file != "":
+                decode.addParam( "trace_file", "{}.{}".format(replay_trace_file, n) )
 
             decode.enableAllStatistics()
 
@@ -354,7 +381,7 @@ class CPU_Builder:
             os_hdlr.addParams( osHdlrParams )
 
             # CPU.decocer.branch_pred
-            branch_pred = decode.setSubComponent( "branch_unit", "vanadis.VanadisBasicBranchUnit" )
+            branch_pred = decode.setSubComponent( "branch_unit", branch_unit )
             branch_pred.addParams( branchPredParams )
             branch_pred.enableAllStatistics()
 
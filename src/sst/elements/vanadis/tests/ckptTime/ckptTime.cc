@@ -0,0 +1,174 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <chrono>
+#include <map>
+
+#include "mmuTypes.h"
+#include "ckptBlock.h"
+
+/*
+ *  Save and restore time of a page table checkpoint for a large memory footprint
+ *
+ *  Builds a SimpleMMU style vpn to PTE map for the footprint given in MiB (default 4096,
+ *  one million 4KiB pages), then saves and restores it as a plain block, a compressed
+ *  block and in the text format the checkpoint used before the blocks. Every restore is
+ *  compared with the original map and the plain block must hold exactly three packed
+ *  32-bit fields per page.
+ *
+ *  The "time:" lines are host timings.
+ */
+
+using namespace SST::MMU_Lib;
+
+typedef std::map<uint32_t,PTE> PteMap;
+
+static void saveBlock( const char* filename, const PteMap& pteMap, bool compress ) {
+    FILE* fp = fopen( filename, "w+" );
+    assert( fp );
+    CkptPacker records;
+    records.reserve( pteMap.size() * 3 * sizeof(uint32_t) );
+    for ( auto & x : pteMap ) {
+        records.pack<uint32_t>( x.first );
+        records.pack<uint32_t>( x.second.ppn );
+        records.pack<uint32_t>( x.second.perms );
+    }
+    writeCkptBlock( fp, "pteMap", pteMap.size(), records, compress );
+    fclose( fp );
+}
+
+static void loadBlock( const char* filename, PteMap& pteMap ) {
+    FILE* fp = fopen( filename, "r" );
+    assert( fp );
+    std::vector<uint8_t> bytes;
+    size_t size = readCkptBlock( fp, "pteMap", bytes );
+    CkptUnpacker records( bytes );
+    for ( size_t i = 0; i < size; i++ ) {
+        uint32_t vpn = records.unpack<uint32_t>();
+        uint32_t ppn = records.unpack<uint32_t>();
+        uint32_t perms = records.unpack<uint32_t>();
+        pteMap.emplace_hint( pteMap.end(), vpn, PTE( ppn, perms ) );
+    }
+    assert( records.done() );
+    fclose( fp );
+}
+
+static void saveText( const char* filename, const PteMap& pteMap ) {
+    FILE* fp = fopen( filename, "w+" );
+    assert( fp );
+    fprintf(fp,"pteMap.size() %zu\n",pteMap.size());
+    for ( auto & x : pteMap ) {
+        fprintf(fp,"vpn: %d, ppn: %d, perms: %d \n", x.first,x.second.ppn,x.second.perms );
+    }
+    fclose( fp );
+}
+
+static void loadText( const char* filename, PteMap& pteMap ) {
+    FILE* fp = fopen( filename, "r" );
+    assert( fp );
+    int size;
+    int ret = fscanf( fp, "pteMap.size() %d\n", &size );
+    assert( 1 == ret );
+    for ( auto i = 0; i < size; i++ ) {
+        uint32_t vpn, ppn, perms;
+        ret = fscanf( fp, "vpn: %d, ppn: %d, perms: %d \n", &vpn, &ppn, &perms );
+        assert( 3 == ret );
+        pteMap[vpn] = PTE( ppn, perms );
+    }
+    fclose( fp );
+}
+
+static bool same( const PteMap& a, const PteMap& b ) {
+    if ( a.size() != b.size() ) {
+        return false;
+    }
+    for ( auto i = a.begin(), j = b.begin(); i != a.end(); ++i, ++j ) {
+        if ( i->first != j->first || i->second.ppn != j->second.ppn || i->second.perms != j->second.perms ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static long fileSize( const char* filename ) {
+    FILE* fp = fopen( filename, "r" );
+    assert( fp );
+    fseek( fp, 0, SEEK_END );
+    long size = ftell( fp );
+    fclose( fp );
+    return size;
+}
+
+int main( int argc, char* argv[] ) {
+    uint64_t footprintMiB = argc > 1 ? strtoull( argv[1], nullptr, 0 ) : 4096;
+    uint32_t numPages = footprintMiB * 256;
+
+    // a heap that grows up from 256MiB with every 64th page left unmapped and
+    // physical pages handed out in a scattered order
+    PteMap pteMap;
+    uint32_t vpn = 0x10000;
+    for ( uint32_t i = 0; i < numPages; i++, vpn++ ) {
+        if ( 0 == vpn % 64 ) {
+            ++vpn;
+        }
+        pteMap.emplace_hint( pteMap.end(), vpn, PTE( ( i * 2654435761u ) & 0x1fffffff, 1 + i % 7 ) );
+    }
+
+    printf("footprint %" PRIu64 " MiB: %zu pages mapped\n", footprintMiB, pteMap.size() );
+
+    struct Format { const char* name; const char* filename; bool block; bool compress; };
+    for ( auto & format : { Format{ "plain", "ckpt-plain", true, false },
+                            Format{ "compressed", "ckpt-compressed", true, true },
+                            Format{ "text", "ckpt-text", false, false } } ) {
+        auto start = std::chrono::steady_clock::now();
+        if ( format.block ) {
+            saveBlock( format.filename, pteMap, format.compress );
+        } else {
+            saveText( format.filename, pteMap );
+        }
+        std::chrono::duration<double> save = std::chrono::steady_clock::now() - start;
+
+        PteMap restored;
+        start = std::chrono::steady_clock::now();
+        if ( format.block ) {
+            loadBlock( format.filename, restored );
+        } else {
+            loadText( format.filename, restored );
+        }
+        std::chrono::duration<double> load = std::chrono::steady_clock::now() - start;
+
+        if ( ! same( pteMap, restored ) ) {
+            printf("FAIL %s: restored page table differs\n", format.name );
+            return 1;
+        }
+        long size = fileSize( format.filename );
+        if ( ! format.compress && format.block ) {
+            // the header line plus three 32-bit fields per page, nothing else
+            char header[80];
+            int headerLen = snprintf( header, sizeof(header), "pteMap: %zu %zu %zu\n", pteMap.size(), pteMap.size() * 12, pteMap.size() * 12 );
+            if ( size != headerLen + (long) pteMap.size() * 12 ) {
+                printf("FAIL %s: %ld bytes, expected %zu\n", format.name, size, headerLen + pteMap.size() * 12 );
+                return 1;
+            }
+            printf("%s: 12 bytes per page\n", format.name );
+        }
+        printf("%s: restored page table matches\n", format.name );
+        printf("time: %s save %.3f s, load %.3f s, %.1f MiB\n", format.name, save.count(), load.count(), size / 1048576.0 );
+        remove( format.filename );
+    }
+    return 0;
+}
@@ -0,0 +1,203 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <deque>
+#include <map>
+#include <set>
+
+#include "output.h"
+#define PRI_ADDR PRIx64
+#include "os/include/virtMemMap.h"
+
+/*
+ *  Test for the node OS page maps
+ *  Contains:
+ *      * PageMap against a std::map with inserts, replacements and lookups that cross
+ *        leaf boundaries, leaves added below the first one, iteration order and copies
+ *      * VirtMemMap region lookups at the boundaries of adjacent regions, unmapping a
+ *        region that is the last region hint, and mapping the range again
+ *
+ *  Prints one line per check, returns non-zero on the first mismatch.
+ */
+
+using namespace SST::Vanadis;
+using namespace SST::Vanadis::OS;
+
+#define CHECK(cond, ...) \
+    if (!(cond)) { printf("FAIL "); printf(__VA_ARGS__); printf("\n"); return false; }
+
+static uint64_t rngState = 0x9E3779B97F4A7C15ULL;
+static uint64_t nextRand() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return rngState;
+}
+
+// PageMap never dereferences the pages, any distinct pointer will do
+static Page* fakePage( unsigned id ) {
+    return reinterpret_cast<Page*>( (uintptr_t) ( id + 1 ) * 16 );
+}
+
+// vpns around the 512 entry leaf boundaries, mostly above a base so later inserts
+// below it have to add leaves in front of the first one
+static unsigned nextVpn() {
+    uint64_t r = nextRand();
+    unsigned base = 0x40000;
+    switch ( r % 8 ) {
+      case 0: return base - 1 - ( r >> 8 ) % 2048;
+      case 1: return base + 512 * ( ( r >> 8 ) % 8 ) - 1 + ( r >> 16 ) % 2;
+      default: return base + ( r >> 8 ) % 4096;
+    }
+}
+
+static bool samePages( const PageMap& map, const std::map<unsigned, Page*>& ref, const char* what ) {
+    CHECK( map.size() == ref.size(), "%s: size %zu, reference %zu", what, map.size(), ref.size() );
+    auto iter = ref.begin();
+    bool ok = true;
+    map.forEach( [&]( unsigned vpn, Page* page ) {
+        if ( ok && ( iter == ref.end() || iter->first != vpn || iter->second != page ) ) {
+            printf("FAIL %s: forEach gave vpn %#x, reference %#x\n", what, vpn, iter == ref.end() ? 0 : iter->first );
+            ok = false;
+        }
+        ++iter;
+    });
+    return ok;
+}
+
+static bool testPageMap( int ops ) {
+    PageMap map;
+    std::map<unsigned, Page*> ref;
+    unsigned replaced = 0, hits = 0, misses = 0;
+
+    CHECK( nullptr == map.find( 0 ), "empty map found vpn 0" );
+
+    for ( int op = 0; op < ops; op++ ) {
+        unsigned vpn = nextVpn();
+        if ( nextRand() % 3 ) {
+            Page* page = map.find( vpn );
+            auto iter = ref.find( vpn );
+            Page* refPage = iter == ref.end() ? nullptr : iter->second;
+            CHECK( page == refPage, "op %d: find(%#x) %p, reference %p", op, vpn, (void*) page, (void*) refPage );
+            if ( page ) {
+                ++hits;
+            } else {
+                ++misses;
+            }
+        } else {
+            Page* page = fakePage( op );
+            Page* old = map.insert( vpn, page );
+            auto iter = ref.find( vpn );
+            Page* refOld = iter == ref.end() ? nullptr : iter->second;
+            CHECK( old == refOld, "op %d: insert(%#x) replaced %p, reference %p", op, vpn, (void*) old, (void*) refOld );
+            if ( old ) {
+                ++replaced;
+            }
+            ref[vpn] = page;
+        }
+    }
+
+    // lookups just outside the mapped span
+    CHECK( nullptr == map.find( ref.begin()->first - 1 ), "found vpn below the lowest mapped vpn" );
+    CHECK( nullptr == map.find( ref.rbegin()->first + 1 ), "found vpn above the highest mapped vpn" );
+    CHECK( nullptr == map.find( ref.rbegin()->first + 512 * 64 ), "found vpn past the last leaf" );
+
+    if ( ! samePages( map, ref, "pagemap" ) ) return false;
+
+    PageMap copy( map );
+    if ( ! samePages( copy, ref, "pagemap copy" ) ) return false;
+    unsigned vpn = ref.rbegin()->first + 1;
+    copy.insert( vpn, fakePage( ops ) );
+    CHECK( nullptr == map.find( vpn ), "insert into a copy changed the original" );
+
+    printf("pagemap: %zu vpns, %u replaced, %u hits, %u misses match std::map\n", ref.size(), replaced, hits, misses );
+    return true;
+}
+
+static bool testRegions() {
+    const size_t pageSize = 4096;
+    const size_t length = 4 * pageSize;
+    PhysMemManager mem( 1024 * 1024 * 64 );
+    VirtMemMap map;
+
+    uint64_t a = map.addRegion( "a", 0, length, 0x6 );
+    uint64_t b = map.addRegion( "b", 0, length, 0x6 );
+    uint64_t c = map.addRegion( "c", 0, length, 0x6 );
+    CHECK( b == a + length && c == b + length, "regions are not adjacent a=%#" PRIx64 " b=%#" PRIx64 " c=%#" PRIx64, a, b, c );
+
+    std::set<unsigned> bPpns;
+    for ( uint64_t addr : { a, b, c } ) {
+        auto region = map.findRegion( addr );
+        for ( uint64_t page = addr; page < addr + length; page += pageSize ) {
+            auto physPage = new Page( &mem );
+            region->mapVirtToPhys( page / pageSize, physPage );
+            if ( addr == b ) {
+                bPpns.insert( physPage->getPPN() );
+            }
+        }
+    }
+
+    // the last byte of one region and the first byte of the next
+    CHECK( map.findRegion( b - 1 ) && "a" == map.findRegion( b - 1 )->name, "findRegion(b-1) is not a" );
+    CHECK( map.findRegion( b ) && "b" == map.findRegion( b )->name, "findRegion(b) is not b" );
+    CHECK( map.findRegion( c - 1 ) && "b" == map.findRegion( c - 1 )->name, "findRegion(c-1) is not b" );
+    CHECK( map.findRegion( c ) && "c" == map.findRegion( c )->name, "findRegion(c) is not c" );
+    CHECK( nullptr == map.findRegion( c + length ), "findRegion found the free range after c" );
+    CHECK( nullptr == map.findRegion( a - 1 ), "findRegion found the free range before a" );
+    for ( uint64_t addr : { a, b, c } ) {
+        auto region = map.findRegion( addr );
+        CHECK( region->getPage( addr / pageSize ) != region->getPage( ( addr + length ) / pageSize - 1 ), "first and last page of %s are the same", region->name.c_str() );
+    }
+    printf("regions: lookups at the region boundaries\n");
+
+    // leave b as the last region hint, then unmap it
+    CHECK( "b" == map.findRegion( b + pageSize )->name, "findRegion(b+page) is not b" );
+    CHECK( 0 == map.unmap( b, length ), "unmap b failed" );
+    CHECK( nullptr == map.findRegion( b ), "findRegion(b) found a region after b was unmapped" );
+    CHECK( nullptr == map.findRegion( b + pageSize ), "findRegion(b+page) found a region after b was unmapped" );
+    CHECK( nullptr == map.findRegion( c - 1 ), "findRegion(c-1) found a region after b was unmapped" );
+    CHECK( "a" == map.findRegion( b - 1 )->name, "findRegion(b-1) is not a after b was unmapped" );
+    CHECK( "c" == map.findRegion( c )->name, "findRegion(c) is not c after b was unmapped" );
+
+    // b's physical pages were freed, they are the first ones handed out again
+    auto page = new Page( &mem );
+    CHECK( bPpns.count( page->getPPN() ), "ppn %u was not one of b's pages", page->getPPN() );
+    page->decRefCnt();
+    delete page;
+    printf("regions: unmapped region is not found through the last region hint\n");
+
+    CHECK( b == map.addRegion( "d", b, length, 0x6 ), "could not map b's range again" );
+    CHECK( "d" == map.findRegion( b + pageSize )->name, "findRegion(b+page) is not d" );
+    CHECK( "d" == map.findRegion( c - 1 )->name, "findRegion(c-1) is not d" );
+
+    // one unmap across the a/d boundary
+    CHECK( 0 == map.unmap( a, 2 * length ), "unmap a and d failed" );
+    CHECK( nullptr == map.findRegion( a ), "findRegion(a) found a region after a and d were unmapped" );
+    CHECK( nullptr == map.findRegion( b ), "findRegion(b) found a region after a and d were unmapped" );
+    CHECK( "c" == map.findRegion( c )->name, "findRegion(c) is not c after a and d were unmapped" );
+    printf("regions: range mapped again and unmapped across a region boundary\n");
+    return true;
+}
+
+int main( int argc, char* argv[] ) {
+    if ( ! testPageMap( 200000 ) ) return 1;
+    if ( ! testRegions() ) return 1;
+    return 0;
+}
@@ -0,0 +1,36 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Stands in for sst/core/output.h so the node OS memory map headers build without SST core
+
+#ifndef _H_VANADIS_TESTS_STUB_OUTPUT
+#define _H_VANADIS_TESTS_STUB_OUTPUT
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define CALL_INFO __LINE__, __FILE__, __FUNCTION__
+
+namespace SST {
+
+class Output {
+  public:
+    void verbose( uint32_t line, const char* file, const char* func, uint32_t level, uint32_t mask, const char* format, ... ) {}
+    void fatal( uint32_t line, const char* file, const char* func, int exitCode, const char* format, ... ) { abort(); }
+};
+
+}
+
+#endif
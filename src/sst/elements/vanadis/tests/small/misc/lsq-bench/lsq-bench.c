@@ -0,0 +1,116 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Load store queue microbenchmark. A pointer chase is a chain of dependent loads, a
+// memcpy keeps the LSQ full of independent loads and stores to nearby addresses. Each
+// kernel prints the number of memory operations it did, divide the host time of the
+// simulation by it to get the simulator cost per memory operation.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <time.h>
+
+#ifndef CHASE_NODES
+#define CHASE_NODES 4096
+#endif
+
+#ifndef CHASE_STEPS
+#define CHASE_STEPS 65536
+#endif
+
+#ifndef COPY_BYTES
+#define COPY_BYTES 65536
+#endif
+
+#ifndef COPY_REPS
+#define COPY_REPS 8
+#endif
+
+static uint64_t now() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static void report( const char* name, uint64_t ops, uint64_t ns ) {
+    printf("%s: %" PRIu64 " memory ops, %" PRIu64 " ns simulated, %" PRIu64 " ps per op\n", name, ops, ns, ns * 1000 / ops );
+}
+
+static uint64_t chase() {
+    void** nodes = malloc( CHASE_NODES * sizeof(void*) );
+    int* order = malloc( CHASE_NODES * sizeof(int) );
+
+    // link the nodes in a random cycle so the loads don't stream
+    for ( int i = 0; i < CHASE_NODES; i++ ) {
+        order[i] = i;
+    }
+    srand( 1 );
+    for ( int i = CHASE_NODES - 1; i > 0; i-- ) {
+        int j = rand() % ( i + 1 );
+        int tmp = order[i]; order[i] = order[j]; order[j] = tmp;
+    }
+    for ( int i = 0; i < CHASE_NODES; i++ ) {
+        nodes[ order[i] ] = &nodes[ order[ ( i + 1 ) % CHASE_NODES ] ];
+    }
+
+    uint64_t start = now();
+    void** p = &nodes[ order[0] ];
+    for ( int i = 0; i < CHASE_STEPS; i++ ) {
+        p = (void**) *p;
+    }
+    report( "pointer-chase", CHASE_STEPS, now() - start );
+
+    uint64_t ret = (uint64_t) ( p - nodes );
+    free( order );
+    free( nodes );
+    return ret;
+}
+
+static uint64_t copy() {
+    uint64_t* src = malloc( COPY_BYTES );
+    uint64_t* dst = malloc( COPY_BYTES );
+    size_t num = COPY_BYTES / sizeof(uint64_t);
+
+    for ( size_t i = 0; i < num; i++ ) {
+        src[i] = i;
+    }
+
+    uint64_t start = now();
+    for ( int rep = 0; rep < COPY_REPS; rep++ ) {
+        // a plain loop so the compiler can't turn it into wider vector operations
+        volatile uint64_t* vsrc = src;
+        for ( size_t i = 0; i < num; i++ ) {
+            dst[i] = vsrc[i] + rep;
+        }
+    }
+    report( "memcpy", (uint64_t) COPY_REPS * num * 2, now() - start );
+
+    uint64_t ret = dst[ num - 1 ];
+    free( src );
+    free( dst );
+    return ret;
+}
+
+int main( int argc, char* argv[] ) {
+    uint64_t a = chase();
+    uint64_t b = copy();
+
+    // keep the results live
+    printf("checksum %" PRIu64 "\n", a + b );
+    return 0;
+}
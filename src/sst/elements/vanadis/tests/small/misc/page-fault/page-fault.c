@@ -0,0 +1,96 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Page fault microbenchmark for the node OS. Maps many regions, touches every page
+// so each one faults, then unmaps every other region and maps them again. The
+// OS time per fault shows up in the simulated time between the phases.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <sys/mman.h>
+#include <time.h>
+
+#ifndef NUM_REGIONS
+#define NUM_REGIONS 64
+#endif
+
+#ifndef PAGES_PER_REGION
+#define PAGES_PER_REGION 16
+#endif
+
+#define PAGE_SIZE 4096
+
+static uint64_t now() {
+    struct timespec ts;
+    clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static char* regions[NUM_REGIONS];
+
+static void mapRegion( int i ) {
+    regions[i] = mmap( NULL, PAGES_PER_REGION * PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+    if ( MAP_FAILED == regions[i] ) {
+        printf("mmap failed, region %d\n",i);
+        exit(-1);
+    }
+}
+
+static uint64_t touch( int stride ) {
+    uint64_t start = now();
+    for ( int i = 0; i < NUM_REGIONS; i += stride ) {
+        for ( int j = 0; j < PAGES_PER_REGION; j++ ) {
+            regions[i][ j * PAGE_SIZE ] = i + j;
+        }
+    }
+    return now() - start;
+}
+
+int main( int argc, char* argv[] ) {
+
+    for ( int i = 0; i < NUM_REGIONS; i++ ) {
+        mapRegion( i );
+    }
+
+    uint64_t first = touch( 1 );
+
+    for ( int i = 0; i < NUM_REGIONS; i += 2 ) {
+        munmap( regions[i], PAGES_PER_REGION * PAGE_SIZE );
+    }
+    for ( int i = 0; i < NUM_REGIONS; i += 2 ) {
+        mapRegion( i );
+    }
+
+    uint64_t second = touch( 2 );
+
+    int errors = 0;
+    for ( int i = 0; i < NUM_REGIONS; i++ ) {
+        for ( int j = 0; j < PAGES_PER_REGION; j++ ) {
+            if ( regions[i][ j * PAGE_SIZE ] != (char) ( i + j ) ) {
+                ++errors;
+            }
+        }
+    }
+
+    int numFaults = NUM_REGIONS * PAGES_PER_REGION;
+    printf("regions %d, pages per region %d\n", NUM_REGIONS, PAGES_PER_REGION );
+    printf("first touch: %d faults %" PRIu64 " ns, %" PRIu64 " ns per fault\n", numFaults, first, first / numFaults );
+    printf("remapped touch: %d faults %" PRIu64 " ns, %" PRIu64 " ns per fault\n", numFaults / 2, second, second / ( numFaults / 2 ) );
+    printf("%s\n", errors ? "FAILED" : "PASSED" );
+
+    return errors;
+}
@@ -4,6 +4,9 @@ from sst_unittest import *
 from sst_unittest_support import *
 from sst_unittest_parameterized import parameterized
 import subprocess
+import re
+import shutil
+import time
 
 module_init = 0
 module_sema = threading.Semaphore()
@@ -167,10 +170,214 @@ class testcase_vanadis(SSTTestCase):
 
 #####
 
-    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120):
+    # The IO tests again with pipelined syscall memory transfers and the ELF loaded during init. The timing
+    # changes so only the output of the application is compared against the gold files.
+    @parameterized.expand([("read-write",), ("fread-fwrite",), ("openat",)])
+    def test_vanadis_bulk_io(self, elffile):
+        self._checkSkipConditions( "riscv64" )
+        os.environ['VANADIS_OS_SYSCALL_MAX_OUTSTANDING'] = "8"
+        os.environ['VANADIS_OS_FUNCTIONAL_INIT_IO'] = "1"
+        try:
+            testname = "small_basic-io_{0}_riscv64_bulk".format(elffile)
+            self.vanadis_test_template(0, testname, "basic_vanadis.py", "small/basic-io", elffile, "riscv64", 1, 1, "", 300, compareSst=False)
+        finally:
+            del os.environ['VANADIS_OS_SYSCALL_MAX_OUTSTANDING']
+            del os.environ['VANADIS_OS_FUNCTIONAL_INIT_IO']
+
+    # The IO tests again with the TAGE and perceptron branch units. The timing changes so only the
+    # output of the application is compared against the gold files.
+    @parameterized.expand([ (unit, elffile, arch)
+                            for unit in [ "TAGE", "Perceptron" ]
+                            for elffile, arch in [ ("hello-world", "mipsel"), ("hello-world", "riscv64"), ("printf-check", "riscv64") ] ])
+    def test_vanadis_branch_unit(self, unit, elffile, arch):
+        self._checkSkipConditions( arch )
+        os.environ['VANADIS_BRANCH_UNIT'] = "vanadis.Vanadis{0}BranchUnit".format(unit)
+        try:
+            testname = "small_basic-io_{0}_{1}_{2}".format(elffile, arch, unit.lower())
+            self.vanadis_test_template(0, testname, "basic_vanadis.py", "small/basic-io", elffile, arch, 1, 1, "", 300, compareSst=False, variant=unit.lower())
+        finally:
+            del os.environ['VANADIS_BRANCH_UNIT']
+
+    # Runs the checkpoint test up to its checkpoint syscall saving a checkpoint, then restores it in a
+    # second simulation that must run the application to the end. The OS checkpoint debug mask is
+    # on so the save and load times are reported.
+    @parameterized.expand([("plain", "0"), ("compressed", "1")])
+    def test_vanadis_checkpoint(self, name, compress):
+        self._checkSkipConditions( "riscv64" )
+        test_path = self.get_testsuite_dir()
+        outdir = "{0}/vanadis_tests/small/misc/checkpoint/riscv64/{1}".format(self.get_test_output_run_dir(), name)
+        ckptdir = "{0}/checkpoint".format(outdir)
+        os.makedirs(ckptdir)
+
+        sdlfile = "{0}/basic_vanadis.py".format(test_path)
+        os_outfile = "{0}/stdout-100".format(outdir)
+
+        os.environ['VANADIS_EXE'] = "{0}/small/misc/checkpoint/riscv64/checkpoint".format(test_path)
+        os.environ['VANADIS_ISA'] = "RISCV64"
+        os.environ['VANADIS_NUM_CORES'] = "1"
+        os.environ['VANADIS_NUM_HW_THREADS'] = "1"
+        os.environ['VANADIS_CHECKPOINT_DIR'] = ckptdir
+        os.environ['VANADIS_CHECKPOINT_COMPRESS'] = compress
+        os.environ['VANADIS_OS_DBG_MASK'] = str(8 | 32)
+        try:
+            for phase in [ "save", "load" ]:
+                os.environ['VANADIS_CHECKPOINT'] = phase
+                sst_outfile = "{0}/test_vanadis_checkpoint_{1}_{2}.out".format(outdir, name, phase)
+                sst_errfile = "{0}/test_vanadis_checkpoint_{1}_{2}.err".format(outdir, name, phase)
+                self.run_sst(sdlfile, sst_outfile, sst_errfile, set_cwd=outdir, timeout_sec=300)
+
+                with open(sst_outfile) as fp:
+                    sst_output = fp.read()
+                self.assertIn("Simulation is complete", sst_output, "Vanadis checkpoint {0} did not complete, see {1}".format(phase, sst_outfile))
+
+                match = re.search(r"checkpoint {0} took ([0-9.]+) seconds".format(phase), sst_output)
+                self.assertIsNotNone(match, "Vanadis checkpoint {0} time not found in {1}".format(phase, sst_outfile))
+                log_testing_note("Vanadis checkpoint {0} {1}: {2} seconds".format(name, phase, match.group(1)))
+
+                self.assertTrue(os.path.isfile(os_outfile), "Vanadis checkpoint {0} stdout-100 not found in {1}".format(phase, outdir))
+                with open(os_outfile) as fp:
+                    app_output = fp.read()
+
+                if phase == "save":
+                    self.assertTrue(len(os.listdir(ckptdir)) > 0, "Vanadis checkpoint save wrote nothing to {0}".format(ckptdir))
+                    self.assertNotIn("exit", app_output, "Vanadis checkpoint save ran past the checkpoint")
+                else:
+                    self.assertIn("Hello World from thread = 0", app_output, "Vanadis checkpoint load did not resume the application")
+                    self.assertIn("exit", app_output, "Vanadis checkpoint load did not run the application to the end")
+        finally:
+            for var in [ 'VANADIS_CHECKPOINT', 'VANADIS_CHECKPOINT_DIR', 'VANADIS_CHECKPOINT_COMPRESS', 'VANADIS_OS_DBG_MASK' ]:
+                os.environ.pop(var, None)
+
+    # Save and restore time of the page table checkpoint block for a 4GiB footprint, against the
+    # text format it replaced.
+    def test_vanadis_checkpoint_time(self):
+        self.vanadis_tool_template("ckptTime", "MMU_DIR={0}/../../mmu".format(self.get_testsuite_dir()))
+
+    # PageMap against a std::map, and VirtMemMap region lookups around unmapped regions
+    def test_vanadis_page_map(self):
+        self.vanadis_tool_template("pageMapCheck", "VANADIS_DIR={0}/..".format(self.get_testsuite_dir()))
+
+    # Builds the page-fault microbenchmark with the musl cross compiler and reports the
+    # simulated time per fault for first touch and for touching remapped regions
+    def test_vanadis_page_fault(self):
+        app_output, wall_sec = self._runMiscBenchmark("page-fault")
+        self.assertIn("PASSED", app_output, "page-fault found wrong data in touched pages")
+        for phase in [ "first touch", "remapped touch" ]:
+            match = re.search(r"{0}: (\d+) faults (\d+) ns, (\d+) ns per fault".format(phase), app_output)
+            self.assertIsNotNone(match, "page-fault {0} time not found".format(phase))
+            log_testing_note("Vanadis page-fault {0}: {1} faults, {2} simulated ns per fault".format(phase, match.group(1), match.group(3)))
+
+    # Builds the LSQ microbenchmark and reports the host time of the simulation per memory
+    # operation the kernels did
+    def test_vanadis_lsq_bench(self):
+        app_output, wall_sec = self._runMiscBenchmark("lsq-bench")
+        ops = 0
+        for kernel in [ "pointer-chase", "memcpy" ]:
+            match = re.search(r"{0}: (\d+) memory ops, (\d+) ns simulated, (\d+) ps per op".format(kernel), app_output)
+            self.assertIsNotNone(match, "lsq-bench {0} result not found".format(kernel))
+            ops += int(match.group(1))
+            log_testing_note("Vanadis lsq-bench {0}: {1} memory ops, {2} simulated ps per op".format(kernel, match.group(1), match.group(3)))
+        self.assertIn("checksum", app_output, "lsq-bench did not run to the end")
+        log_testing_note("Vanadis lsq-bench: {0} memory ops in {1:.2f}s host time, {2:.0f} host ns per memory op".format(ops, wall_sec, wall_sec * 1e9 / ops))
+
+    # Records the instruction trace of hello-world, then replays it through the trace decoder. The
+    # replay must end the thread and retire the same number of instructions as the recording.
+    def test_vanadis_trace_replay(self):
+        self.trace_replay_template("hello-world")
+
+    # fread-fwrite mallocs its buffer, the replay has to make the same brk and mmap calls for the
+    # heap loads and stores to have pages
+    def test_vanadis_trace_replay_heap(self):
+        self.trace_replay_template("fread-fwrite")
+
+    def trace_replay_template(self, testname):
+        self._checkSkipConditions( "riscv64" )
+        test_path = self.get_testsuite_dir()
+        outdir = "{0}/vanadis_tests/small/basic-io/{1}/riscv64/trace_replay".format(self.get_test_output_run_dir(), testname)
+        os.makedirs(outdir)
+
+        sdlfile = "{0}/basic_vanadis.py".format(test_path)
+        trace_file = "{0}/{1}.trace".format(outdir, testname)
+        ref_os_outfile = "{0}/small/basic-io/{1}/riscv64/vanadis.stdout.gold".format(test_path, testname)
+        os_outfile = "{0}/stdout-100".format(outdir)
+
+        os.environ['VANADIS_EXE'] = "{0}/small/basic-io/{1}/riscv64/{1}".format(test_path, testname)
+        os.environ['VANADIS_ISA'] = "RISCV64"
+        os.environ['VANADIS_NUM_CORES'] = "1"
+        os.environ['VANADIS_NUM_HW_THREADS'] = "1"
+        retired = {}
+        try:
+            for phase, var in [ ("record", 'VANADIS_INSTRUCTION_TRACE'), ("replay", 'VANADIS_REPLAY_TRACE') ]:
+                os.environ[var] = trace_file
+                sst_outfile = "{0}/test_vanadis_trace_{1}.out".format(outdir, phase)
+                sst_errfile = "{0}/test_vanadis_trace_{1}.err".format(outdir, phase)
+                try:
+                    self.run_sst(sdlfile, sst_outfile, sst_errfile, set_cwd=outdir, timeout_sec=300)
+                finally:
+                    del os.environ[var]
+
+                with open(sst_outfile) as fp:
+                    sst_output = fp.read()
+                self.assertIn("Simulation is complete", sst_output, "Vanadis trace {0} did not complete, see {1}".format(phase, sst_outfile))
+
+                match = re.search(r"cpu0\.instructions_retired\S* : Accumulator : Sum\.u64 = (\d+);", sst_output)
+                self.assertIsNotNone(match, "Vanadis trace {0} has no instructions_retired statistic in {1}".format(phase, sst_outfile))
+                retired[phase] = int(match.group(1))
+
+                if phase == "record":
+                    self.assertTrue(os.path.getsize("{0}.0".format(trace_file)) > 0, "Vanadis trace record wrote an empty trace")
+                    cmp_result = testing_compare_diff("trace_record", os_outfile, ref_os_outfile)
+                    self.assertTrue(cmp_result, "Vanadis trace record output {0} does not match {1}".format(os_outfile, ref_os_outfile))
+        finally:
+            for var in [ 'VANADIS_EXE', 'VANADIS_ISA', 'VANADIS_NUM_CORES', 'VANADIS_NUM_HW_THREADS' ]:
+                os.environ.pop(var, None)
+
+        self.assertEqual(retired["record"], retired["replay"], "Vanadis trace replay retired {0} instructions, the recording retired {1}".format(retired["replay"], retired["record"]))
+
+#####
+
+    # Builds a standalone tool from tests/<toolname> against the element sources and compares its
+    # output with <toolname>.stdout.gold, the "time:" lines are host timings and only logged
+    def vanadis_tool_template(self, toolname, makeVars, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+        tooldir = "{0}/{1}".format(self.get_test_output_tmp_dir(), toolname)
+        reffile = "{0}/{1}/{1}.stdout.gold".format(test_path, toolname)
+        outfile = "{0}/test_vanadis_{1}.out".format(outdir, toolname)
+
+        if os.path.isdir(tooldir):
+            shutil.rmtree(tooldir, True)
+        os.makedirs(tooldir)
+        shutil.copy("{0}/{1}/Makefile".format(test_path, toolname), tooldir)
+        os_symlink_file("{0}/{1}".format(test_path, toolname), tooldir, "{0}.cc".format(toolname))
+
+        rtn = OSCommand("make {0}".format(makeVars), set_cwd=tooldir).run()
+        log_debug("Make result = {0}; output =\n{1}".format(rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "{0}.cc failed to compile".format(toolname))
+
+        rtn = OSCommand("./{0}".format(toolname), output_file_path=outfile, set_cwd=tooldir).run(timeout_sec=testtimeout)
+        self.assertTrue(rtn.result() == 0, "{0} failed, see {1}".format(toolname, outfile))
+
+        with open(outfile, 'r') as fp:
+            lines = fp.readlines()
+        for line in lines:
+            if line.startswith("time:"):
+                log_testing_note("Vanadis {0} {1}".format(toolname, line.strip()))
+        with open(outfile, 'w') as fp:
+            fp.writelines([ line for line in lines if not line.startswith("time:") ])
+
+        cmp_result = testing_compare_diff(toolname, outfile, reffile)
+        if cmp_result == False:
+            diffdata = testing_get_diff_data(toolname)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
+
+    def vanadis_test_template(self, testnum, testname, sdlfile, elftestdir, elffile, isa, numCores, numHwThreads, goldfiledir, testtimeout=120, compareSst=True, variant="bulk"):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = "{0}/vanadis_tests/{1}/{2}/{3}/{4}".format(self.get_test_output_run_dir(), elftestdir,elffile,isa,goldfiledir)
+        if not compareSst:
+            outdir += "_" + variant
         tmpdir = self.get_test_output_tmp_dir()
         os.makedirs(outdir)
 
@@ -219,7 +426,9 @@ class testcase_vanadis(SSTTestCase):
         self.assertTrue(os_outfileexists, "Vanadis test outfile-os not found in directory {0}".format(outdir))
         self.assertTrue(os_errfileexists, "Vanadis test errfile-os not found in directory {0}".format(outdir))
 
-        if ( os.path.exists( ref_sst_outfile ) ):
+        if not compareSst:
+            log_debug("vanadis test {0} SST output not compared".format(testDataFileName))
+        elif ( os.path.exists( ref_sst_outfile ) ):
             cmp_result = testing_compare_filtered_diff(testname, sst_outfile, ref_sst_outfile ,filters=[StartsWithFilter(" v0.instructions_issued.1")])
             if (cmp_result == False):
                 diffdata = testing_get_diff_data(testname)
@@ -263,6 +472,47 @@ class testcase_vanadis(SSTTestCase):
 
 ###############################################
 
+    # Builds small/misc/<elffile> for riscv64 in the test tmp dir, runs it on one core and
+    # returns the application output and the host time of the simulation
+    def _runMiscBenchmark(self, elffile, timeout_sec=600):
+        self._checkSkipConditions( "riscv64" )
+        if not self._is_musl_compiler_available( "riscv64" ):
+            self.skipTest("Vanadis Skipping Test - musl compiler not available to build {0}".format(elffile))
+        test_path = self.get_testsuite_dir()
+        outdir = "{0}/vanadis_tests/small/misc/{1}/riscv64".format(self.get_test_output_run_dir(), elffile)
+        builddir = "{0}/{1}".format(self.get_test_output_tmp_dir(), elffile)
+        for path in [ outdir, "{0}/riscv64".format(builddir) ]:
+            if not os.path.isdir(path):
+                os.makedirs(path)
+        shutil.copy("{0}/small/misc/{1}/Makefile".format(test_path, elffile), builddir)
+        os_symlink_file("{0}/small/misc/{1}".format(test_path, elffile), builddir, "{0}.c".format(elffile))
+
+        rtn = OSCommand("make ARCH=riscv64", set_cwd=builddir).run()
+        log_debug("Make result = {0}; output =\n{1}".format(rtn.result(), rtn.output()))
+        self.assertTrue(rtn.result() == 0, "{0}.c failed to compile".format(elffile))
+
+        sdlfile = "{0}/basic_vanadis.py".format(test_path)
+        sst_outfile = "{0}/test_vanadis_{1}.out".format(outdir, elffile)
+        sst_errfile = "{0}/test_vanadis_{1}.err".format(outdir, elffile)
+        os_outfile = "{0}/stdout-100".format(outdir)
+
+        os.environ['VANADIS_EXE'] = "{0}/riscv64/{1}".format(builddir, elffile)
+        os.environ['VANADIS_ISA'] = "RISCV64"
+        os.environ['VANADIS_NUM_CORES'] = "1"
+        os.environ['VANADIS_NUM_HW_THREADS'] = "1"
+        try:
+            start = time.time()
+            self.run_sst(sdlfile, sst_outfile, sst_errfile, set_cwd=outdir, timeout_sec=timeout_sec)
+            wall_sec = time.time() - start
+        finally:
+            for var in [ 'VANADIS_EXE', 'VANADIS_ISA', 'VANADIS_NUM_CORES', 'VANADIS_NUM_HW_THREADS' ]:
+                os.environ.pop(var, None)
+
+        self.assertTrue(os.path.isfile(os_outfile), "Vanadis {0} stdout-100 not found in {1}".format(elffile, outdir))
+        with open(os_outfile) as fp:
+            return fp.read(), wall_sec
+
+###
     def _checkSkipConditions(self,isa):
         # Check to see if the musl compiler is missing
         if MakeTests:
@@ -373,6 +373,18 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
         if ( pipelineTrace == nullptr ) { output->fatal(CALL_INFO, -1, "Failed to open pipeline trace file.\n"); }
     }
 
+    std::string inst_trace_path = params.find<std::string>("instruction_trace_file", "");
+
+    if ( inst_trace_path != "" ) {
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            const std::string thr_trace_path = inst_trace_path + "." + std::to_string(i);
+            output->verbose(CALL_INFO, 8, 0, "Recording instruction trace for thread %" PRIu32 " to: %s\n", i, thr_trace_path.c_str());
+            instTraceWriters.push_back(
+                new VanadisTraceWriter(output, thr_trace_path, thread_decoders[i]->getISAName(), isa_options[i],
+                    thread_decoders[i]->getInstructionWidth()));
+        }
+    }
+
     pause_on_retire_address = params.find<uint64_t>("pause_when_retire_address", 0);
     stop_verbose_when_retire_address = params.find<uint64_t>("stop_verbose_when_retire_address", 0);
 
@@ -412,6 +424,10 @@ VANADIS_COMPONENT::~VANADIS_COMPONENT()
 
     if ( pipelineTrace != nullptr ) { fclose(pipelineTrace); }
 
+    for ( VanadisTraceWriter* next_writer : instTraceWriters ) {
+        delete next_writer;
+    }
+
 	for( VanadisFloatingPointFlags* next_fp_flags : fp_flags ) {
 		delete next_fp_flags;
 	}
@@ -953,8 +969,9 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                 }
                 }
                 #endif
-                thr_decoder->getBranchPredictor()->push(
-                spec_ins->getInstructionAddress(), pipeline_reset_addr);
+                thr_decoder->getBranchPredictor()->update(
+                spec_ins->getInstructionAddress(), pipeline_reset_addr, spec_ins->getNotTakenAddress(),
+                spec_ins->getPrediction());
 
                 if ( stop_verbose_when_retire_address > 0 && (rob_front->getInstructionAddress() == stop_verbose_when_retire_address) ) {
                     output->setVerboseLevel(0);
@@ -1013,6 +1030,11 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                 fprintf(pipelineTrace, "0x%08" PRI_ADDR " %s\n", rob_front->getInstructionAddress(), rob_front->getInstCode());
             }
 
+            // syscalls are recorded when they are handed to the OS
+            if ( UNLIKELY(!instTraceWriters.empty()) && INST_SYSCALL != rob_front->getInstFuncType() ) {
+                recordInstructionTrace(rob_front);
+            }
+
 			if(UNLIKELY(rob_front->updatesFPFlags())) {
                 output->verbose(CALL_INFO, 16, VANADIS_DBG_RETIRE_FLG, "------> updating floating-point flags.\n");
 				rob_front->updateFPFlags();
@@ -1055,6 +1077,10 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                         pipelineTrace, "0x%08" PRI_ADDR " %s\n", delay_ins->getInstructionAddress(), delay_ins->getInstCode());
                 }
 
+                if ( UNLIKELY(!instTraceWriters.empty()) ) {
+                    recordInstructionTrace(delay_ins);
+                }
+
 				if(UNLIKELY(rob_front->updatesFPFlags())) {
                     output->verbose(CALL_INFO, 16, VANADIS_DBG_RETIRE_FLG, "------> updating floating-point flags.\n");
 					rob_front->updateFPFlags();
@@ -1145,8 +1171,15 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                         "(ins-addr: 0x%0" PRI_ADDR ")...\n", ins_thread,
                         the_syscall_ins->getInstructionAddress());
                     #endif
+                    // recorded here rather than at retire, the syscall that ends the thread never retires
+                    // and the handler notes the OS call it makes in the record
+                    if ( UNLIKELY(!instTraceWriters.empty()) ) {
+                        thr_decoder->getOSHandler()->setTraceRecord(recordInstructionTrace(the_syscall_ins));
+                    }
+
                     bool ret, flushLSQ;
                     std::tie( ret, flushLSQ) = thr_decoder->getOSHandler()->handleSysCall(the_syscall_ins);
+                    thr_decoder->getOSHandler()->setTraceRecord(nullptr);
 
                     // mark as front of ROB now we can proceed
                     rob_front->markFrontOfROB();
@@ -1867,6 +1900,80 @@ VANADIS_COMPONENT::assignRegistersToInstruction(
     return 0;
 }
 
+VanadisTraceRecord*
+VANADIS_COMPONENT::recordInstructionTrace(VanadisInstruction* ins)
+{
+    const uint32_t      ins_thread = ins->getHWThread();
+    VanadisTraceRecord* rec        = instTraceWriters[ins_thread]->next();
+
+    rec->ins_addr  = ins->getInstructionAddress();
+    rec->func_type = ins->getInstFuncType();
+
+    switch ( ins->getInstFuncType() ) {
+    case INST_LOAD:
+    {
+        VanadisLoadInstruction* load_ins = dynamic_cast<VanadisLoadInstruction*>(ins);
+        load_ins->computeLoadAddress(output, register_files[ins_thread], &rec->mem_addr, &rec->mem_width);
+        rec->sub_type = load_ins->getTransactionType();
+    } break;
+    case INST_STORE:
+    {
+        VanadisStoreInstruction* store_ins = dynamic_cast<VanadisStoreInstruction*>(ins);
+        store_ins->computeStoreAddress(output, register_files[ins_thread], &rec->mem_addr, &rec->mem_width);
+        rec->sub_type = store_ins->getTransactionType();
+    } break;
+    case INST_BRANCH:
+    {
+        VanadisSpeculatedInstruction* spec_ins = dynamic_cast<VanadisSpeculatedInstruction*>(ins);
+        rec->next_addr = spec_ins->getTakenAddress();
+        rec->ins_width = spec_ins->getInstructionWidth();
+        rec->sub_type  = spec_ins->getDelaySlotType();
+    } break;
+    case INST_FENCE:
+    {
+        VanadisFenceInstruction* fence_ins = dynamic_cast<VanadisFenceInstruction*>(ins);
+        rec->sub_type = fence_ins->createsLoadFence()
+                            ? (fence_ins->createsStoreFence() ? VANADIS_LOAD_STORE_FENCE : VANADIS_LOAD_FENCE)
+                            : VANADIS_STORE_FENCE;
+    } break;
+    case INST_SYSCALL:
+        // the replayed syscall takes its registers from the ISA options
+        return rec;
+    default:
+        break;
+    }
+
+    if ( ins->countISAIntRegIn() > VANADIS_TRACE_INT_IN || ins->countISAIntRegOut() > VANADIS_TRACE_INT_OUT ||
+         ins->countISAFPRegIn() > VANADIS_TRACE_FP_IN || ins->countISAFPRegOut() > VANADIS_TRACE_FP_OUT ) {
+        output->fatal(
+            CALL_INFO, -1, "Error: instruction 0x%" PRI_ADDR " (%s) has more registers than an instruction trace record.\n",
+            ins->getInstructionAddress(), ins->getInstCode());
+    }
+
+    rec->int_in_count  = ins->countISAIntRegIn();
+    rec->int_out_count = ins->countISAIntRegOut();
+    rec->fp_in_count   = ins->countISAFPRegIn();
+    rec->fp_out_count  = ins->countISAFPRegOut();
+
+    for ( uint16_t i = 0; i < rec->int_in_count; ++i ) {
+        rec->int_in[i] = ins->getISAIntRegIn(i);
+    }
+
+    for ( uint16_t i = 0; i < rec->int_out_count; ++i ) {
+        rec->int_out[i] = ins->getISAIntRegOut(i);
+    }
+
+    for ( uint16_t i = 0; i < rec->fp_in_count; ++i ) {
+        rec->fp_in[i] = ins->getISAFPRegIn(i);
+    }
+
+    for ( uint16_t i = 0; i < rec->fp_out_count; ++i ) {
+        rec->fp_out[i] = ins->getISAFPRegOut(i);
+    }
+
+    return rec;
+}
+
 int
 VANADIS_COMPONENT::recoverRetiredRegisters(
     VanadisInstruction* ins, VanadisRegisterStack* int_regs, VanadisRegisterStack* fp_regs,
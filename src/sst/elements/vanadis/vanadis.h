@@ -27,6 +27,7 @@
 #include "velf/velfinfo.h"
 #include "vfpflags.h"
 #include "vfuncunit.h"
+#include "vinstrace.h"
 #include "rocc/vroccinterface.h"
 #include "rocc/vbasicrocc.h"
 
@@ -122,6 +123,7 @@ public:
                                         "address is retired, set verbose to 0", ""},
         { "pause_when_retire_address", "If specified, the simulation will stop when this address is retired.", "0"},
         { "pipeline_trace_file", "If specified, a trace of the pipeline activity will be generated to this file.", ""},
+        { "instruction_trace_file", "If specified, the micro-ops committed by each hardware thread are recorded to <file>.<thread> for replay with vanadis.VanadisTraceDecoder.", ""},
         { "max_cycle", "Maximum number of cycles to execute. The core will halt after this many cycles." , "std::numeric_limits<uint64_t>::max()"},
         { "node_id", "Identifier for the node this core belongs to. Each node in the system needs a unique ID between 0 and (number of nodes) - 1. Used to tag output.", "0"},
         { "core_id", "Identifier for this core. Each core in the system needs a unique ID between 0 and (number of cores) - 1.", 0 },
@@ -209,6 +211,8 @@ public:
 
     void clearFuncUnit(const uint32_t hw_thr, std::vector<VanadisFunctionalUnit*>& unit);
 
+    VanadisTraceRecord* recordInstructionTrace(VanadisInstruction* ins);
+
     void syscallReturn(uint32_t thr);
     void setHalt(uint32_t thr, int64_t halt_code);
     void startThread(int thr, uint64_t stackStart, uint64_t instructionPointer );
@@ -344,6 +348,7 @@ private:
     TimeConverter           clock_tc_;
     Clock::HandlerBase*     clock_handler_;
     FILE*           pipelineTrace;
+    std::vector<VanadisTraceWriter*> instTraceWriters;
 
     Statistic<uint64_t>* stat_ins_retired;
     Statistic<uint64_t>* stat_ins_decoded;
@@ -0,0 +1,185 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_DIRECTION
+#define _H_VANADIS_BRANCH_UNIT_DIRECTION
+
+#include "vbranch/vbranchunit.h"
+#include "vbranch/vbtb.h"
+
+#include <chrono>
+#include <cstdint>
+
+namespace SST {
+namespace Vanadis {
+
+// Common part of the branch units that predict a direction and take the target from a
+// branch target buffer. A branch is only reported to the decoder (contains) when it is
+// predicted taken and the BTB has its target, otherwise the decoder falls through.
+//
+// The global history holds the directions of retired branches, so it never has to be
+// repaired after a misspeculation. The history a branch was predicted with travels with the
+// branch (VanadisBranchPrediction) and its update trains the entries that prediction read,
+// even when older branches retired in between.
+class VanadisDirectionBranchUnit : public VanadisBranchUnit {
+
+public:
+    VanadisDirectionBranchUnit(ComponentId_t id, Params& params) :
+        VanadisBranchUnit(id, params),
+        btb(params.find<uint32_t>("btb_entries", 2048), params.find<uint32_t>("btb_associativity", 4)) {
+
+        if ( params.find<uint32_t>("btb_associativity", 4) > 64 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s btb_associativity must be 64 or less.\n",
+                getName().c_str());
+        }
+
+        measure_host_time = params.find<bool>("measure_host_time", false);
+        global_history    = 0;
+        last_lookup_addr  = UINT64_MAX;
+        last_lookup_target = 0;
+        last_lookup_prediction = { 0, false };
+
+        stat_dir_correct     = registerStatistic<uint64_t>("direction_correct", "1");
+        stat_dir_mispredict  = registerStatistic<uint64_t>("direction_mispredict", "1");
+        stat_btb_hit         = registerStatistic<uint64_t>("btb_hit", "1");
+        stat_btb_miss        = registerStatistic<uint64_t>("btb_miss", "1");
+        stat_btb_target_miss = registerStatistic<uint64_t>("btb_target_mispredict", "1");
+        stat_btb_castout     = registerStatistic<uint64_t>("btb_castout", "1");
+        stat_host_time       = registerStatistic<uint64_t>("predictor_host_ns", "1");
+    }
+
+    virtual ~VanadisDirectionBranchUnit() {}
+
+    bool contains(const uint64_t addr) override {
+        const auto start = hostTimeStart();
+
+        uint64_t target = 0;
+        const bool taken = predictTaken(addr, global_history);
+        bool found = false;
+
+        if ( taken ) {
+            found = btb.lookup(addr, &target);
+
+            if ( found ) {
+                stat_btb_hit->addData(1);
+            } else {
+                stat_btb_miss->addData(1);
+            }
+        }
+
+        last_lookup_addr       = addr;
+        last_lookup_target     = target;
+        last_lookup_prediction = { global_history, taken };
+
+        hostTimeEnd(start);
+        return found;
+    }
+
+    VanadisBranchPrediction getPrediction(const uint64_t addr) override {
+        if ( addr == last_lookup_addr ) {
+            return last_lookup_prediction;
+        }
+
+        return { global_history, predictTaken(addr, global_history) };
+    }
+
+    uint64_t predictAddress(const uint64_t addr) override {
+        if ( addr == last_lookup_addr ) {
+            return last_lookup_target;
+        }
+
+        uint64_t target = 0;
+        btb.lookup(addr, &target);
+        return target;
+    }
+
+    // without the not-taken address only the target can be recorded
+    void push(const uint64_t ins_addr, const uint64_t pred_addr) override {
+        if ( btb.update(ins_addr, pred_addr) ) {
+            stat_btb_castout->addData(1);
+        }
+    }
+
+    void update(const uint64_t ins_addr, const uint64_t resolved_addr, const uint64_t not_taken_addr,
+                const VanadisBranchPrediction& prediction) override {
+        const auto start = hostTimeStart();
+        const bool taken = (resolved_addr != not_taken_addr);
+
+        if ( prediction.taken == taken ) {
+            stat_dir_correct->addData(1);
+        } else {
+            stat_dir_mispredict->addData(1);
+        }
+
+        train(ins_addr, taken, prediction.history);
+
+        if ( taken ) {
+            uint64_t btb_target = 0;
+
+            if ( btb.lookup(ins_addr, &btb_target) && (btb_target != resolved_addr) ) {
+                stat_btb_target_miss->addData(1);
+            }
+
+            push(ins_addr, resolved_addr);
+        }
+
+        global_history = (global_history << 1) | (taken ? 1 : 0);
+
+        // a retired branch may have been predicted again since the last lookup
+        last_lookup_addr = UINT64_MAX;
+
+        hostTimeEnd(start);
+    }
+
+protected:
+    // predicted direction of the branch at addr with the given global history
+    virtual bool predictTaken(const uint64_t addr, const uint64_t history) = 0;
+
+    // trains the direction tables with the outcome of a retired branch, history is the
+    // global history the branch was predicted with
+    virtual void train(const uint64_t addr, const bool taken, const uint64_t history) = 0;
+
+    std::chrono::steady_clock::time_point hostTimeStart() const {
+        return measure_host_time ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+    }
+
+    void hostTimeEnd(const std::chrono::steady_clock::time_point start) {
+        if ( measure_host_time ) {
+            stat_host_time->addData(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+        }
+    }
+
+    VanadisBranchTargetBuffer btb;
+    uint64_t global_history;
+    bool measure_host_time;
+
+    uint64_t last_lookup_addr;
+    uint64_t last_lookup_target;
+    VanadisBranchPrediction last_lookup_prediction;
+
+    Statistic<uint64_t>* stat_dir_correct;
+    Statistic<uint64_t>* stat_dir_mispredict;
+    Statistic<uint64_t>* stat_btb_hit;
+    Statistic<uint64_t>* stat_btb_miss;
+    Statistic<uint64_t>* stat_btb_target_miss;
+    Statistic<uint64_t>* stat_btb_castout;
+    Statistic<uint64_t>* stat_host_time;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
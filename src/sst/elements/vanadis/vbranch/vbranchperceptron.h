@@ -0,0 +1,128 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_PERCEPTRON
+#define _H_VANADIS_BRANCH_UNIT_PERCEPTRON
+
+#include "vbranch/vbranchdir.h"
+
+#include <cstdlib>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// Perceptron direction predictor: the branch address selects a row of signed weights, one
+// for a bias and one per global history bit, the branch is predicted taken when the dot
+// product with the history (taken = +1, not-taken = -1) is not negative. The weights are
+// one flat array, a prediction or an update touches a single row.
+class VanadisPerceptronBranchUnit : public VanadisDirectionBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisPerceptronBranchUnit, "vanadis", "VanadisPerceptronBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Implements a perceptron direction predictor with a set associative "
+                                          "branch target buffer",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "btb_entries", "Number of entries in the branch target buffer", "2048" },
+                            { "btb_associativity", "Number of ways in each set of the branch target buffer", "4" },
+                            { "perceptron_entries", "Number of perceptrons (rows of weights)", "512" },
+                            { "history_length", "Global history bits used by each perceptron (1 to 64)", "32" },
+                            { "measure_host_time", "Record the host time spent in the predictor in predictor_host_ns", "0" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "direction_correct", "Retired branches whose direction was predicted correctly", "branches", 1 },
+                                { "direction_mispredict", "Retired branches whose direction was mispredicted", "branches", 1 },
+                                { "btb_hit", "Predicted taken branches with a target in the BTB", "lookups", 1 },
+                                { "btb_miss", "Predicted taken branches without a target in the BTB", "lookups", 1 },
+                                { "btb_target_mispredict", "Retired taken branches whose BTB target was wrong", "branches", 1 },
+                                { "btb_castout", "BTB entries replaced because of capacity limits", "entries", 1 },
+                                { "predictor_host_ns", "Host time spent predicting and updating, if measure_host_time is set", "ns", 1 })
+
+    VanadisPerceptronBranchUnit(ComponentId_t id, Params& params) : VanadisDirectionBranchUnit(id, params) {
+        row_count      = params.find<uint32_t>("perceptron_entries", 512);
+        history_length = params.find<uint32_t>("history_length", 32);
+
+        if ( row_count == 0 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s perceptron_entries must be at least 1.\n",
+                getName().c_str());
+        }
+
+        if ( history_length < 1 || history_length > 64 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s history_length must be between 1 and 64.\n",
+                getName().c_str());
+        }
+
+        row_width = history_length + 1;
+        weights.resize(static_cast<size_t>(row_count) * row_width, 0);
+
+        // training threshold from Jimenez and Lin, "Dynamic Branch Prediction with Perceptrons"
+        threshold = static_cast<int32_t>(1.93 * history_length + 14);
+    }
+
+protected:
+    int32_t dotProduct(const int8_t* row, const uint64_t history) const {
+        int32_t sum = row[0];
+
+        for ( uint32_t i = 0; i < history_length; ++i ) {
+            sum += ((history >> i) & 1) ? row[i + 1] : -row[i + 1];
+        }
+
+        return sum;
+    }
+
+    int8_t* selectRow(const uint64_t addr) {
+        return &weights[((addr >> 1) % row_count) * row_width];
+    }
+
+    static void trainWeight(int8_t& weight, const bool increase) {
+        if ( increase ) {
+            if ( weight < 127 ) { weight++; }
+        } else {
+            if ( weight > -127 ) { weight--; }
+        }
+    }
+
+    bool predictTaken(const uint64_t addr, const uint64_t history) override {
+        return dotProduct(selectRow(addr), history) >= 0;
+    }
+
+    void train(const uint64_t addr, const bool taken, const uint64_t history) override {
+        int8_t* row = selectRow(addr);
+
+        const int32_t sum  = dotProduct(row, history);
+        const bool    pred = (sum >= 0);
+
+        if ( pred != taken || std::abs(sum) <= threshold ) {
+            trainWeight(row[0], taken);
+
+            for ( uint32_t i = 0; i < history_length; ++i ) {
+                trainWeight(row[i + 1], (((history >> i) & 1) != 0) == taken);
+            }
+        }
+    }
+
+    uint32_t row_count;
+    uint32_t row_width;
+    uint32_t history_length;
+    int32_t  threshold;
+
+    std::vector<int8_t> weights;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
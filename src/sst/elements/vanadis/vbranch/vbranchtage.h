@@ -0,0 +1,284 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_TAGE
+#define _H_VANADIS_BRANCH_UNIT_TAGE
+
+#include "vbranch/vbranchdir.h"
+
+#include <cmath>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// TAGE direction predictor: a bimodal base table and a set of tagged tables indexed by the
+// branch address hashed with geometrically longer slices of the global history. The
+// prediction comes from the matching table with the longest history. Every table is a
+// fixed size array, a prediction or an update costs one access per table.
+class VanadisTAGEBranchUnit : public VanadisDirectionBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisTAGEBranchUnit, "vanadis", "VanadisTAGEBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Implements a TAGE direction predictor with a set associative "
+                                          "branch target buffer",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "btb_entries", "Number of entries in the branch target buffer", "2048" },
+                            { "btb_associativity", "Number of ways in each set of the branch target buffer", "4" },
+                            { "base_entries", "Number of two bit counters in the bimodal base table, rounded down to a power of two", "4096" },
+                            { "tagged_tables", "Number of tagged tables (1 to 8)", "4" },
+                            { "tagged_entries", "Number of entries in each tagged table, rounded down to a power of two", "1024" },
+                            { "tag_bits", "Bits of each tag in the tagged tables (4 to 15)", "9" },
+                            { "min_history", "Global history length used by the first tagged table", "4" },
+                            { "max_history", "Global history length used by the last tagged table (at most 64)", "64" },
+                            { "useful_reset_period", "Number of updates between agings of the useful counters", "262144" },
+                            { "measure_host_time", "Record the host time spent in the predictor in predictor_host_ns", "0" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "direction_correct", "Retired branches whose direction was predicted correctly", "branches", 1 },
+                                { "direction_mispredict", "Retired branches whose direction was mispredicted", "branches", 1 },
+                                { "btb_hit", "Predicted taken branches with a target in the BTB", "lookups", 1 },
+                                { "btb_miss", "Predicted taken branches without a target in the BTB", "lookups", 1 },
+                                { "btb_target_mispredict", "Retired taken branches whose BTB target was wrong", "branches", 1 },
+                                { "btb_castout", "BTB entries replaced because of capacity limits", "entries", 1 },
+                                { "tagged_provider", "Retired branches predicted by a tagged table", "branches", 1 },
+                                { "tagged_allocate", "Tagged entries allocated after a misprediction", "entries", 1 },
+                                { "predictor_host_ns", "Host time spent predicting and updating, if measure_host_time is set", "ns", 1 })
+
+    VanadisTAGEBranchUnit(ComponentId_t id, Params& params) : VanadisDirectionBranchUnit(id, params) {
+        table_count = params.find<uint32_t>("tagged_tables", 4);
+        tag_bits    = params.find<uint32_t>("tag_bits", 9);
+
+        const uint32_t min_history = params.find<uint32_t>("min_history", 4);
+        const uint32_t max_history = params.find<uint32_t>("max_history", 64);
+
+        if ( table_count < 1 || table_count > 8 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s tagged_tables must be between 1 and 8.\n",
+                getName().c_str());
+        }
+
+        if ( tag_bits < 4 || tag_bits > 15 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s tag_bits must be between 4 and 15.\n",
+                getName().c_str());
+        }
+
+        if ( min_history < 1 || max_history < min_history || max_history > 64 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1,
+                "Error: %s requires 1 <= min_history <= max_history <= 64.\n", getName().c_str());
+        }
+
+        base_bits   = log2Entries(params.find<uint32_t>("base_entries", 4096));
+        tagged_bits = log2Entries(params.find<uint32_t>("tagged_entries", 1024));
+
+        if ( base_bits < 4 || tagged_bits < 4 ) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: %s base_entries and tagged_entries must be at least 16.\n",
+                getName().c_str());
+        }
+
+        base_ctr.resize(1ULL << base_bits, 0);
+
+        const size_t tagged_size = static_cast<size_t>(table_count) << tagged_bits;
+        tagged_ctr.resize(tagged_size, 0);
+        tagged_tag.resize(tagged_size, INVALID_TAG);
+        tagged_useful.resize(tagged_size, 0);
+
+        for ( uint32_t i = 0; i < table_count; ++i ) {
+            const double ratio = (table_count == 1) ? 0.0 : static_cast<double>(i) / (table_count - 1);
+            history_length[i] = static_cast<uint32_t>(
+                std::lround(min_history * std::pow(static_cast<double>(max_history) / min_history, ratio)));
+        }
+
+        use_alt_on_weak    = 0;
+        reset_period       = params.find<uint64_t>("useful_reset_period", 262144);
+        updates_till_reset = reset_period;
+
+        stat_tagged_provider = registerStatistic<uint64_t>("tagged_provider", "1");
+        stat_tagged_allocate = registerStatistic<uint64_t>("tagged_allocate", "1");
+    }
+
+protected:
+    // tags are at most 15 bits so an empty entry never matches
+    static constexpr uint16_t INVALID_TAG = UINT16_MAX;
+
+    struct Lookup {
+        size_t index[8];
+        uint16_t tag[8];
+        int provider;
+        int alt_provider;
+        bool provider_pred;
+        bool alt_pred;
+        bool pred;
+        size_t base_index;
+    };
+
+    static uint32_t log2Entries(const uint32_t entries) {
+        uint32_t bits = 0;
+        while ( (2ULL << bits) <= entries ) {
+            bits++;
+        }
+        return bits;
+    }
+
+    // xor folds the youngest length bits of the history down to bits bits
+    static uint64_t foldHistory(const uint64_t history, const uint32_t length, const uint32_t bits) {
+        uint64_t hist   = (length >= 64) ? history : (history & ((1ULL << length) - 1));
+        uint64_t folded = 0;
+
+        while ( hist != 0 ) {
+            folded ^= hist & ((1ULL << bits) - 1);
+            hist >>= bits;
+        }
+
+        return folded;
+    }
+
+    void lookup(const uint64_t addr, const uint64_t history, Lookup& result) const {
+        const uint64_t pc         = addr >> 1;
+        const uint64_t index_mask = (1ULL << tagged_bits) - 1;
+        const uint64_t tag_mask   = (1ULL << tag_bits) - 1;
+
+        result.base_index   = pc & ((1ULL << base_bits) - 1);
+        result.provider     = -1;
+        result.alt_provider = -1;
+
+        for ( uint32_t i = 0; i < table_count; ++i ) {
+            const uint64_t index = (pc ^ (pc >> tagged_bits) ^ foldHistory(history, history_length[i], tagged_bits)) & index_mask;
+            const uint64_t tag   = (pc ^ foldHistory(history, history_length[i], tag_bits) ^
+                                    (foldHistory(history, history_length[i], tag_bits - 1) << 1)) & tag_mask;
+
+            result.index[i] = (static_cast<size_t>(i) << tagged_bits) + index;
+            result.tag[i]   = static_cast<uint16_t>(tag);
+
+            if ( tagged_tag[result.index[i]] == result.tag[i] ) {
+                result.alt_provider = result.provider;
+                result.provider     = i;
+            }
+        }
+
+        result.alt_pred = (result.alt_provider >= 0) ? (tagged_ctr[result.index[result.alt_provider]] >= 0)
+                                                     : (base_ctr[result.base_index] >= 0);
+
+        if ( result.provider >= 0 ) {
+            const int8_t ctr     = tagged_ctr[result.index[result.provider]];
+            result.provider_pred = (ctr >= 0);
+
+            // a newly allocated entry is often less accurate than the alternate prediction
+            const bool weak = (ctr == 0 || ctr == -1) && (tagged_useful[result.index[result.provider]] == 0);
+            result.pred     = (weak && use_alt_on_weak >= 0) ? result.alt_pred : result.provider_pred;
+        } else {
+            result.provider_pred = result.alt_pred;
+            result.pred          = result.alt_pred;
+        }
+    }
+
+    bool predictTaken(const uint64_t addr, const uint64_t history) override {
+        Lookup result;
+        lookup(addr, history, result);
+        return result.pred;
+    }
+
+    static void updateCounter(int8_t& ctr, const bool taken, const int8_t min, const int8_t max) {
+        if ( taken ) {
+            if ( ctr < max ) { ctr++; }
+        } else {
+            if ( ctr > min ) { ctr--; }
+        }
+    }
+
+    void train(const uint64_t addr, const bool taken, const uint64_t history) override {
+        Lookup result;
+        lookup(addr, history, result);
+
+        if ( result.provider >= 0 ) {
+            const size_t provider_index = result.index[result.provider];
+            const int8_t ctr            = tagged_ctr[provider_index];
+
+            stat_tagged_provider->addData(1);
+
+            if ( (ctr == 0 || ctr == -1) && tagged_useful[provider_index] == 0 &&
+                 result.provider_pred != result.alt_pred ) {
+                updateCounter(use_alt_on_weak, result.alt_pred == taken, -8, 7);
+            }
+
+            if ( result.provider_pred != result.alt_pred ) {
+                if ( result.provider_pred == taken ) {
+                    if ( tagged_useful[provider_index] < 3 ) { tagged_useful[provider_index]++; }
+                } else {
+                    if ( tagged_useful[provider_index] > 0 ) { tagged_useful[provider_index]--; }
+                }
+            }
+
+            updateCounter(tagged_ctr[provider_index], taken, -4, 3);
+        } else {
+            updateCounter(base_ctr[result.base_index], taken, -2, 1);
+        }
+
+        // allocate an entry with a longer history than the provider, if there is no free one
+        // age the candidates so one becomes free later
+        if ( result.pred != taken && result.provider < static_cast<int>(table_count) - 1 ) {
+            bool allocated = false;
+
+            for ( uint32_t i = result.provider + 1; i < table_count; ++i ) {
+                const size_t index = result.index[i];
+
+                if ( tagged_useful[index] == 0 ) {
+                    tagged_tag[index] = result.tag[i];
+                    tagged_ctr[index] = taken ? 0 : -1;
+                    allocated         = true;
+                    stat_tagged_allocate->addData(1);
+                    break;
+                }
+            }
+
+            if ( !allocated ) {
+                for ( uint32_t i = result.provider + 1; i < table_count; ++i ) {
+                    tagged_useful[result.index[i]]--;
+                }
+            }
+        }
+
+        if ( reset_period > 0 && --updates_till_reset == 0 ) {
+            for ( uint8_t& useful : tagged_useful ) {
+                useful >>= 1;
+            }
+
+            updates_till_reset = reset_period;
+        }
+    }
+
+    uint32_t table_count;
+    uint32_t tag_bits;
+    uint32_t base_bits;
+    uint32_t tagged_bits;
+    uint32_t history_length[8];
+
+    std::vector<int8_t>   base_ctr;
+    std::vector<int8_t>   tagged_ctr;
+    std::vector<uint16_t> tagged_tag;
+    std::vector<uint8_t>  tagged_useful;
+
+    int8_t   use_alt_on_weak;
+    uint64_t reset_period;
+    uint64_t updates_till_reset;
+
+    Statistic<uint64_t>* stat_tagged_provider;
+    Statistic<uint64_t>* stat_tagged_allocate;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
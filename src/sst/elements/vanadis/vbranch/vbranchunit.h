@@ -38,6 +38,20 @@ public:
     virtual ~VanadisBranchUnit() {}
 
     virtual void push(const uint64_t ins_addr, const uint64_t pred_addr) = 0;
+
+    // Called by the core when a branch retires. The not-taken address lets direction
+    // predictors tell a taken branch from one that fell through, units that only cache
+    // targets just record the resolved address. The prediction is the one getPrediction
+    // returned when the branch was decoded.
+    virtual void update(const uint64_t ins_addr, const uint64_t resolved_addr, const uint64_t not_taken_addr,
+                        const VanadisBranchPrediction& prediction) {
+        push(ins_addr, resolved_addr);
+    }
+
+    // Called by the decoder after contains for every branch it issues, the result is stored
+    // with the branch and passed back to update
+    virtual VanadisBranchPrediction getPrediction(const uint64_t addr) { return { 0, false }; }
+
     virtual uint64_t predictAddress(const uint64_t addr) = 0;
     virtual bool contains(const uint64_t addr) = 0;
 };
@@ -0,0 +1,125 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_TARGET_BUFFER
+#define _H_VANADIS_BRANCH_TARGET_BUFFER
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// Set associative branch target buffer held in flat arrays. The sets are indexed by the
+// branch address, each way keeps the full address as its tag and a small age for LRU
+// replacement, so a lookup or an update only touches the ways of one set.
+class VanadisBranchTargetBuffer {
+public:
+    VanadisBranchTargetBuffer(const uint32_t entries, const uint32_t associativity) {
+        ways = (associativity == 0) ? 1 : associativity;
+
+        // round the number of sets down to a power of two so the index is a mask
+        uint32_t set_count = 1;
+        while ( (set_count * 2 * ways) <= entries ) {
+            set_count *= 2;
+        }
+
+        set_mask = set_count - 1;
+
+        tags.resize(set_count * ways, INVALID_TAG);
+        targets.resize(set_count * ways, 0);
+        ages.resize(set_count * ways, 0);
+
+        // the ages in a set are always a permutation of 0 to ways - 1
+        for ( uint32_t i = 0; i < ages.size(); ++i ) {
+            ages[i] = i % ways;
+        }
+    }
+
+    uint32_t getEntryCount() const { return tags.size(); }
+
+    bool lookup(const uint64_t ins_addr, uint64_t* target) {
+        const uint32_t set_start = setStart(ins_addr);
+
+        for ( uint32_t i = set_start; i < set_start + ways; ++i ) {
+            if ( tags[i] == ins_addr ) {
+                (*target) = targets[i];
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // records the target, returns true if a valid entry was cast out to make room for it
+    bool update(const uint64_t ins_addr, const uint64_t target) {
+        const uint32_t set_start = setStart(ins_addr);
+        uint32_t       victim    = set_start;
+
+        for ( uint32_t i = set_start; i < set_start + ways; ++i ) {
+            if ( tags[i] == ins_addr ) {
+                targets[i] = target;
+                touch(set_start, i);
+                return false;
+            }
+
+            // an empty way if there is one, otherwise the least recently used
+            if ( tags[victim] != INVALID_TAG && (tags[i] == INVALID_TAG || ages[i] > ages[victim]) ) {
+                victim = i;
+            }
+        }
+
+        const bool castout = (tags[victim] != INVALID_TAG);
+
+        tags[victim]    = ins_addr;
+        targets[victim] = target;
+        touch(set_start, victim);
+
+        return castout;
+    }
+
+protected:
+    static constexpr uint64_t INVALID_TAG = UINT64_MAX;
+
+    uint32_t setStart(const uint64_t ins_addr) const {
+        // instructions are at least two byte aligned (compressed RISC-V)
+        return static_cast<uint32_t>((ins_addr >> 1) & set_mask) * ways;
+    }
+
+    // the touched way becomes the youngest, the ways younger than it age by one
+    void touch(const uint32_t set_start, const uint32_t way) {
+        const uint8_t way_age = ages[way];
+
+        for ( uint32_t i = set_start; i < set_start + ways; ++i ) {
+            if ( ages[i] < way_age ) {
+                ages[i]++;
+            }
+        }
+
+        ages[way] = 0;
+    }
+
+    uint32_t ways;
+    uint64_t set_mask;
+
+    std::vector<uint64_t> tags;
+    std::vector<uint64_t> targets;
+    std::vector<uint8_t>  ages;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
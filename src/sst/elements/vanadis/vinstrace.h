@@ -0,0 +1,179 @@
+// Copyright 2009-2025 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2025, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_INS_TRACE
+#define _H_VANADIS_INS_TRACE
+
+#include "decoder/visaopts.h"
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <sst/core/output.h>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+// A committed micro-op stream recorded by the core (instruction_trace_file) and replayed by the
+// VanadisTraceDecoder. The file is a VanadisTraceHeader followed by one VanadisTraceRecord per
+// retired micro-op, in retire order. Syscalls are recorded when they are handed to the OS because
+// the final exit never retires. A syscall that changes the address space (brk, anonymous mmap,
+// munmap) records the call in its sub_type so the replay can make the same change in the OS, the
+// other syscalls only record their address.
+
+#define VANADIS_TRACE_MAGIC   "VTRACE3"
+#define VANADIS_TRACE_INT_IN  4
+#define VANADIS_TRACE_INT_OUT 2
+#define VANADIS_TRACE_FP_IN   6
+#define VANADIS_TRACE_FP_OUT  2
+
+struct VanadisTraceHeader {
+    char     magic[8];
+    char     isa[16];
+    uint16_t reg_ignore_writes;
+    uint16_t int_reg_count;
+    uint16_t fp_reg_count;
+    uint16_t syscall_code_reg;
+    uint16_t fp_reg_mode;
+    uint16_t ins_width; // bytes fetched for each instruction
+    uint16_t pad[2];
+};
+
+struct VanadisTraceRecord {
+    uint64_t ins_addr;
+    uint64_t mem_addr;  // effective address of a load or store, address of a brk, mmap or munmap
+    uint64_t next_addr; // address a branch resolved to, length of a mmap or munmap
+    uint16_t mem_width; // protection of a mmap
+    uint8_t  func_type; // VanadisFunctionalUnitType
+    uint8_t  sub_type;  // VanadisMemoryTransaction, VanadisDelaySlotRequirement, VanadisFenceType or VanadisSyscallOp
+    uint8_t  ins_width; // branches only, used for the not-taken prediction
+    uint8_t  int_in_count;
+    uint8_t  int_out_count;
+    uint8_t  fp_in_count;
+    uint8_t  fp_out_count;
+    uint8_t  int_in[VANADIS_TRACE_INT_IN];
+    uint8_t  int_out[VANADIS_TRACE_INT_OUT];
+    uint8_t  fp_in[VANADIS_TRACE_FP_IN];
+    uint8_t  fp_out[VANADIS_TRACE_FP_OUT];
+    uint8_t  map_flags; // host MAP_ flags of a mmap
+};
+
+class VanadisTraceWriter
+{
+public:
+    VanadisTraceWriter(const SST::Output* output, const std::string& path, const char* isa_name,
+        const VanadisDecoderOptions* isa_opts, const uint16_t ins_width) : buffer_count(0)
+    {
+        trace_file = fopen(path.c_str(), "wb");
+
+        if ( nullptr == trace_file ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open instruction trace file %s for writing.\n", path.c_str());
+        }
+
+        VanadisTraceHeader header;
+        memset(&header, 0, sizeof(header));
+        strncpy(header.magic, VANADIS_TRACE_MAGIC, sizeof(header.magic) - 1);
+        strncpy(header.isa, isa_name, sizeof(header.isa) - 1);
+        header.reg_ignore_writes = isa_opts->getRegisterIgnoreWrites();
+        header.int_reg_count     = isa_opts->countISAIntRegisters();
+        header.fp_reg_count      = isa_opts->countISAFPRegisters();
+        header.syscall_code_reg  = isa_opts->getISASysCallCodeReg();
+        header.fp_reg_mode       = isa_opts->getFPRegisterMode();
+        header.ins_width         = ins_width;
+
+        fwrite(&header, sizeof(header), 1, trace_file);
+        buffer.resize(4096);
+    }
+
+    ~VanadisTraceWriter()
+    {
+        flush();
+        fclose(trace_file);
+    }
+
+    VanadisTraceRecord* next()
+    {
+        if ( buffer_count == buffer.size() ) { flush(); }
+
+        VanadisTraceRecord* rec = &buffer[buffer_count++];
+        memset(rec, 0, sizeof(VanadisTraceRecord));
+        return rec;
+    }
+
+    void flush()
+    {
+        if ( buffer_count > 0 ) {
+            fwrite(buffer.data(), sizeof(VanadisTraceRecord), buffer_count, trace_file);
+            buffer_count = 0;
+        }
+    }
+
+private:
+    FILE*                           trace_file;
+    std::vector<VanadisTraceRecord> buffer;
+    size_t                          buffer_count;
+};
+
+class VanadisTraceReader
+{
+public:
+    VanadisTraceReader(const SST::Output* output, const std::string& path) : buffer_count(0), buffer_next(0)
+    {
+        trace_file = fopen(path.c_str(), "rb");
+
+        if ( nullptr == trace_file ) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open instruction trace file %s for reading.\n", path.c_str());
+        }
+
+        if ( 1 != fread(&header, sizeof(header), 1, trace_file) ||
+             0 != strncmp(header.magic, VANADIS_TRACE_MAGIC, sizeof(header.magic)) ) {
+            output->fatal(CALL_INFO, -1, "Error: %s is not a Vanadis instruction trace.\n", path.c_str());
+        }
+
+        buffer.resize(4096);
+    }
+
+    ~VanadisTraceReader() { fclose(trace_file); }
+
+    const VanadisTraceHeader& getHeader() const { return header; }
+
+    // the next record in the trace, nullptr at the end of the trace
+    const VanadisTraceRecord* peek()
+    {
+        if ( buffer_next == buffer_count ) {
+            buffer_count = fread(buffer.data(), sizeof(VanadisTraceRecord), buffer.size(), trace_file);
+            buffer_next  = 0;
+        }
+
+        return (buffer_next < buffer_count) ? &buffer[buffer_next] : nullptr;
+    }
+
+    void pop() { buffer_next++; }
+
+private:
+    FILE*                           trace_file;
+    VanadisTraceHeader              header;
+    std::vector<VanadisTraceRecord> buffer;
+    size_t                          buffer_count;
+    size_t                          buffer_next;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif